@@ -46,6 +46,7 @@ FileExt AddExt={{"*.c",		"GNU-C Files (*.c)"},
 EXPORT BOOL CALLBACK CheckIfYounger (HANDLE hDat, LPSTR module, LPSTR client);
 EXPORT BOOL CALLBACK FileWasCompiled (HANDLE hDat, LPSTR file);
 EXPORT BOOL CALLBACK SourceAvailable (HANDLE hDat, LPSTR module, LPSTR file);
+void FreeBuildDatabase (void);
 
 
 void DBOutString (LPSTR string)
@@ -354,6 +355,7 @@ EXPORT void CALLBACK ExitInterface (HANDLE hDat)
 	// Powsup32.dll wieder freigeben
 	if (!FreeLibrary(hPowSup)) 
 		MessageBox (0, "Error: Unloading POWSUP32.DLL failed!", "Error", MB_OK);
+	FreeBuildDatabase();	// Build-Datenbank freigeben
 	GlobalFree(hDat);	// Globalen Speicherblock freigeben
 }
 
@@ -631,7 +633,7 @@ void DelChars(int i, char strErrOut[])
 
 
 //////////////////////////////////////////////////////////////////////////////
-// BOOL GetErrors(char tempPath[], FARPROC msg, FARPROC err)
+// BOOL GetErrors(char tempPath[], FARPROC msg, FARPROC err, LPDWORD lpdwErrors)
 //////////////////////////////////////////////////////////////////////////////
 // Funktion: Die Datei "tempPath" wird nach Fehler gescannt, welche mittels 
 //					 der Funktion "err" an POW! zur Ausgabe bergeben wird. Weiters
@@ -646,9 +648,11 @@ void DelChars(int i, char strErrOut[])
 //
 // Rckgabe: FALSE, wenn Temporre Datei "tempPath" nicht geffnet werden 
 //					 kann, TRUE sonst.
+//					 Ist "lpdwErrors" nicht NULL, so wird dort die Anzahl der Fehler 
+//					 abgelegt.
 //////////////////////////////////////////////////////////////////////////////
 
-BOOL GetErrors(char tempPath[], FARPROC msg, FARPROC err)
+BOOL GetErrors(char tempPath[], FARPROC msg, FARPROC err, LPDWORD lpdwErrors)
 {
 	BOOL ok, bFound, bWarn, bLinkerCall;
 	DWORD dwFileSize, dwBytesRead;
@@ -758,23 +762,25 @@ BOOL GetErrors(char tempPath[], FARPROC msg, FARPROC err)
 		LocalUnlock(hError); LocalFree(hError); 	CloseHandle(hError);
 	}
 	CloseHandle (hFile);
+	if (lpdwErrors) *lpdwErrors=dwErrors;	// Anzahl der Fehler an Aufrufer
 	return TRUE;
 }
 
 
 
 //////////////////////////////////////////////////////////////////////////////
-// BOOL RunCommand (char strCommandLine[], HANDLE hOutput)
+// HANDLE StartCommand (char strCommandLine[], char strTempFile[])
 //////////////////////////////////////////////////////////////////////////////
 // Funktion: Erzeugt einen Prozess (Aufruf von "strCommandLine") und ber-
 //					 gibt die Ausgabe des Compilers an die Datei strTempFile.
+//					 Es wird nicht auf das Ende des Prozesses gewartet.
 //
-// Rckgabe: TRUE, wenn Prozess erzeugt wurde, FALSE sonst.
+// Rckgabe: Handle des Prozesses, NULL wenn er nicht erzeugt werden konnte.
 //////////////////////////////////////////////////////////////////////////////
 
-BOOL RunCommand (char strCommandLine[], char strTempFile[])
+HANDLE StartCommand (char strCommandLine[], char strTempFile[])
 {
-	BOOL ok=FALSE;
+	HANDLE hProcess=NULL;
 	STARTUPINFO si;
 	SECURITY_ATTRIBUTES sa;
 	PROCESS_INFORMATION pi; 
@@ -809,47 +815,475 @@ BOOL RunCommand (char strCommandLine[], char strTempFile[])
       &si,									// Zeiger auf STARTUPINFO Struktur
       &pi))									// Zeiger auf PROCESS_INFORMATION Struktur
   {
-		ok=TRUE;
-		WaitForSingleObject( pi.hProcess, INFINITE);
-		// Prozess und Thread-Handle schlieen
-		CloseHandle( pi.hProcess );
-		CloseHandle( pi.hThread );
+		hProcess=pi.hProcess;
+		CloseHandle( pi.hThread );	// Thread-Handle wird nicht bentigt
+	}
+	// Handle der Temporren Datei sofort schlieen, damit es nicht an spter
+	// gestartete Prozesse vererbt wird
+	CloseHandle(hFile);
+	return hProcess;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// BOOL RunCommand (char strCommandLine[], char strTempFile[])
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Wie StartCommand, wartet aber auf das Ende des Prozesses.
+//
+// Rckgabe: TRUE, wenn Prozess erzeugt wurde, FALSE sonst.
+//////////////////////////////////////////////////////////////////////////////
+
+BOOL RunCommand (char strCommandLine[], char strTempFile[])
+{
+	HANDLE hProcess;
+
+	if (!(hProcess=StartCommand (strCommandLine, strTempFile)))
+		return FALSE;
+	WaitForSingleObject (hProcess, INFINITE);
+	CloseHandle (hProcess);	// Prozess-Handle schlieen
+	return TRUE;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// Build-Datenbank
+//////////////////////////////////////////////////////////////////////////////
+// Fr jede erfolgreich bersetzte Quelldatei werden Gre und Hashwert des
+// Inhalts in der Datei "<Projekt>.bdb" gespeichert. Ist eine Quelldatei 
+// jnger als ihr Objektfile, inhaltlich aber unverndert (nur berhrt, 
+// Sicherung zurckgespielt, ...), so mu sie nicht neu bersetzt werden.
+//////////////////////////////////////////////////////////////////////////////
+
+#define BDB_VERSION "Pow! build database 1.1"
+
+typedef struct
+{
+	char strFile[_MAX_PATH];	// Quelldatei (klein geschrieben)
+	DWORD dwSize;							// Gre beim letzten bersetzen
+	DWORD dwHash;							// Hashwert von Quelle und lokalen Headern beim letzten bersetzen
+} BDBENTRY;
+typedef BDBENTRY far *LPBDBENTRY;
+
+HANDLE hBdb=NULL;						// Eintrge der Build-Datenbank
+int iBdbNum, iBdbMax;				// Anzahl benutzter bzw. allokierter Eintrge
+char strBdbFile[_MAX_PATH];	// Datei der Build-Datenbank
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// BOOL HashFile (LPSTR file, LPDWORD lpdwSize, LPDWORD lpdwHash)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Berechnet Gre und Hashwert (FNV-1a) des Inhalts von "file".
+//
+// Rckgabe: TRUE, wenn "file" gelesen werden konnte, FALSE sonst
+//////////////////////////////////////////////////////////////////////////////
+
+BOOL HashFile (LPSTR file, LPDWORD lpdwSize, LPDWORD lpdwHash)
+{
+	HANDLE hFile;
+	DWORD i, dwRead, dwHash;
+	BYTE buf[16384];
+
+	hFile = CreateFile (file, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 
+											FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (hFile==INVALID_HANDLE_VALUE)
+		return FALSE;
+	dwHash=0x811C9DC5;
+	*lpdwSize=0;
+	while (ReadFile (hFile, buf, sizeof(buf), &dwRead, NULL) && (dwRead>0))
+	{
+		for (i=0; i<dwRead; i++)
+			dwHash=(dwHash^buf[i])*0x01000193;
+		*lpdwSize+=dwRead;
 	}
-	CloseHandle(hFile);	// Handle der Temporren Datei schlieen
+	CloseHandle (hFile);
+	*lpdwHash=dwHash;
+	return TRUE;
+}
+
+
+
+#define MAX_INCLUDE_DEPTH 8
+#define MAX_INCLUDE_FILES 256
+
+// Header, die whrend eines Aufrufs von HashSource schon eingemischt wurden
+typedef struct
+{
+	int iNum;																		// Anzahl der Eintrge
+	char strFile[MAX_INCLUDE_FILES][_MAX_PATH];	// vollstndige Pfade (klein geschrieben)
+} HASHEDINCLUDES;
+typedef HASHEDINCLUDES far *LPHASHEDINCLUDES;
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// BOOL IncludeAlreadyHashed (LPHASHEDINCLUDES lpSeen, LPSTR file)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Prft, ob der Header "file" schon eingemischt wurde, und trgt
+//					 ihn sonst in "lpSeen" ein. Ist die Tabelle voll, wird der Header
+//					 ohne Eintrag (also eventuell mehrfach) eingemischt.
+//
+// Rckgabe: TRUE, wenn "file" schon eingemischt wurde, FALSE sonst
+//////////////////////////////////////////////////////////////////////////////
+
+BOOL IncludeAlreadyHashed (LPHASHEDINCLUDES lpSeen, LPSTR file)
+{
+	int i;
+	char strPath[_MAX_PATH];
+
+	if (!lpSeen)
+		return FALSE;
+	// verschiedene Schreibweisen desselben Headers ("..\x\defs.h") vereinheitlichen
+	if (!_fullpath (strPath, file, _MAX_PATH))
+		strcpy (strPath, file);
+	_strlwr (strPath);
+	for (i=0; i<lpSeen->iNum; i++)
+		if (!strcmp (lpSeen->strFile[i], strPath))
+			return TRUE;
+	if (lpSeen->iNum<MAX_INCLUDE_FILES)
+		strcpy (lpSeen->strFile[lpSeen->iNum++], strPath);
+	return FALSE;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// void HashIncludes (LPSTR file, LPDWORD lpdwHash, int iDepth, 
+//										LPHASHEDINCLUDES lpSeen)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Mischt die Hashwerte aller mit #include "name" eingebundenen 
+//					 Header von "file" in "lpdwHash" ein, rekursiv bis zur Tiefe 
+//					 MAX_INCLUDE_DEPTH. Header werden relativ zum Verzeichnis von 
+//					 "file" gesucht, fehlende Header gehen als Null ein. Jeder 
+//					 Header wird nur einmal gelesen, auch wenn er ber mehrere 
+//					 Wege eingebunden wird (z.B. ein gemeinsames "defs.h").
+//
+// Rckgabe: -
+//////////////////////////////////////////////////////////////////////////////
+
+void HashIncludes (LPSTR file, LPDWORD lpdwHash, int iDepth, LPHASHEDINCLUDES lpSeen)
+{
+	FILE *f;
+	char *p, *q;
+	DWORD dwSize, dwHash;
+	char strLine[MAX_EDITOR_LINE],
+			 strHeader[_MAX_PATH],
+			 drive[_MAX_DRIVE], dir[_MAX_DIR],
+			 fname[_MAX_FNAME], ext[_MAX_EXT];
+
+	if ((iDepth>MAX_INCLUDE_DEPTH) || ((f=fopen (file, "r"))==NULL))
+		return;
+	_splitpath (file, drive, dir, fname, ext);
+	while (fgets (strLine, sizeof(strLine), f)!=NULL)
+	{
+		// Zeilen der Form: #include "name" (auch auskommentierte, das schadet nicht)
+		for (p=strLine; (*p==' ') || (*p=='\t'); p++);
+		if (*p++!='#')
+			continue;
+		while ((*p==' ') || (*p=='\t')) p++;
+		if (strncmp (p, "include", 7))
+			continue;
+		for (p+=7; (*p==' ') || (*p=='\t'); p++);
+		if ((*p!='"') || ((q=strchr (p+1, '"'))==NULL))
+			continue;
+		*q='\0';
+		sprintf (strHeader, "%s%s%s", drive, dir, p+1);
+		if (IncludeAlreadyHashed (lpSeen, strHeader))
+			continue;
+		if (!HashFile (strHeader, &dwSize, &dwHash))
+			dwHash=0;
+		*lpdwHash=(*lpdwHash^dwHash)*0x01000193;
+		HashIncludes (strHeader, lpdwHash, iDepth+1, lpSeen);
+	}
+	fclose (f);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// BOOL HashSource (LPSTR file, LPDWORD lpdwSize, LPDWORD lpdwHash)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Berechnet Gre und Hashwert von "file" wie HashFile, der 
+//					 Hashwert enthlt zustzlich die lokal eingebundenen Header.
+//					 ndert sich ein solcher Header, wird "file" neu bersetzt.
+//
+// Rckgabe: TRUE, wenn "file" gelesen werden konnte, FALSE sonst
+//////////////////////////////////////////////////////////////////////////////
+
+BOOL HashSource (LPSTR file, LPDWORD lpdwSize, LPDWORD lpdwHash)
+{
+	HANDLE hSeen;
+	LPHASHEDINCLUDES lpSeen=NULL;
+
+	if (!HashFile (file, lpdwSize, lpdwHash))
+		return FALSE;
+	// ohne Speicher fr die Tabelle werden mehrfach eingebundene Header auch
+	// mehrfach eingemischt, der Hashwert bleibt trotzdem gltig
+	if (hSeen=GlobalAlloc (GMEM_MOVEABLE, sizeof(HASHEDINCLUDES)))
+	{
+		lpSeen=(LPHASHEDINCLUDES)GlobalLock (hSeen);
+		lpSeen->iNum=0;
+	}
+	HashIncludes (file, lpdwHash, 1, lpSeen);
+	if (hSeen)
+	{
+		GlobalUnlock (hSeen);
+		GlobalFree (hSeen);
+	}
+	return TRUE;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// void FreeBuildDatabase (void)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Gibt die geladene Build-Datenbank frei.
+//
+// Rckgabe: -
+//////////////////////////////////////////////////////////////////////////////
+
+void FreeBuildDatabase (void)
+{
+	if (hBdb)
+		GlobalFree (hBdb);
+	hBdb=NULL;
+	strBdbFile[0]='\0';
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// void LoadBuildDatabase (LPGLOBALDATA lpGlobDat)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Ldt die Build-Datenbank des aktuellen Projekts, falls sie 
+//					 nicht schon geladen ist.
+//
+// Rckgabe: -
+//////////////////////////////////////////////////////////////////////////////
+
+void LoadBuildDatabase (LPGLOBALDATA lpGlobDat)
+{
+	HANDLE hFile, h;
+	DWORD dwRead;
+	int iNum;
+	LPBDBENTRY lpEnt;
+	char strName[_MAX_PATH],
+			 strVersion[sizeof(BDB_VERSION)],
+			 drive[_MAX_DRIVE], dir[_MAX_DIR],
+			 fname[_MAX_FNAME], ext[_MAX_EXT];
+
+	// Name der Datenbank: Projektname mit Endung .bdb
+	_splitpath (lpGlobDat->prjName, drive, dir, fname, ext);
+	sprintf (strName, "%s%s%s.bdb", drive, dir, fname);
+	if (hBdb && !stricmp (strName, strBdbFile))	// schon geladen?
+		return;
+
+	FreeBuildDatabase();
+	iBdbNum=0; iBdbMax=32;
+	if ((hBdb=GlobalAlloc (GMEM_MOVEABLE, iBdbMax*sizeof(BDBENTRY)))==NULL)
+		return;
+	strcpy (strBdbFile, strName);
+
+	hFile = CreateFile (strBdbFile, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 
+											FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile==INVALID_HANDLE_VALUE)	// noch keine Datenbank vorhanden
+		return;
+	// Version und Anzahl der Eintrge prfen
+	if (ReadFile (hFile, strVersion, sizeof(strVersion), &dwRead, NULL) && 
+			(dwRead==sizeof(strVersion)) && !strcmp (strVersion, BDB_VERSION) &&
+			ReadFile (hFile, &iNum, sizeof(iNum), &dwRead, NULL) && 
+			(dwRead==sizeof(iNum)) && (iNum>0))
+	{
+		if ((iNum>iBdbMax) && ((h=GlobalReAlloc (hBdb, iNum*sizeof(BDBENTRY), GMEM_MOVEABLE))!=NULL))
+		{
+			hBdb=h; iBdbMax=iNum;
+		}
+		if (iNum<=iBdbMax)
+		{
+			lpEnt=(LPBDBENTRY)GlobalLock (hBdb);
+			if (ReadFile (hFile, lpEnt, iNum*sizeof(BDBENTRY), &dwRead, NULL) && 
+					(dwRead==iNum*sizeof(BDBENTRY)))
+				iBdbNum=iNum;
+			GlobalUnlock (hBdb);
+		}
+	}
+	CloseHandle (hFile);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// void SaveBuildDatabase (void)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Schreibt die geladene Build-Datenbank zurck.
+//
+// Rckgabe: -
+//////////////////////////////////////////////////////////////////////////////
+
+void SaveBuildDatabase (void)
+{
+	HANDLE hFile;
+	DWORD dwWritten;
+	LPBDBENTRY lpEnt;
+	char strVersion[sizeof(BDB_VERSION)];
+
+	if (!hBdb) 
+		return;
+	hFile = CreateFile (strBdbFile, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 
+											FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile==INVALID_HANDLE_VALUE)
+		return;
+	strcpy (strVersion, BDB_VERSION);
+	WriteFile (hFile, strVersion, sizeof(strVersion), &dwWritten, NULL);
+	WriteFile (hFile, &iBdbNum, sizeof(iBdbNum), &dwWritten, NULL);
+	lpEnt=(LPBDBENTRY)GlobalLock (hBdb);
+	WriteFile (hFile, lpEnt, iBdbNum*sizeof(BDBENTRY), &dwWritten, NULL);
+	GlobalUnlock (hBdb);
+	CloseHandle (hFile);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// int FindBuildEntry (LPSTR file)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Sucht den Eintrag der Quelldatei "file" in der Build-Datenbank.
+//
+// Rckgabe: Index des Eintrags, -1 wenn nicht vorhanden
+//////////////////////////////////////////////////////////////////////////////
+
+int FindBuildEntry (LPSTR file)
+{
+	int i;
+	LPBDBENTRY lpEnt;
+
+	if (!hBdb)
+		return -1;
+	lpEnt=(LPBDBENTRY)GlobalLock (hBdb);
+	for (i=0; (i<iBdbNum) && stricmp (lpEnt[i].strFile, file); i++);
+	GlobalUnlock (hBdb);
+	return (i<iBdbNum) ? i : -1;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// BOOL SourceUnchanged (HANDLE hDat, LPSTR file)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Prft, ob "file" und seine lokalen Header denselben Inhalt 
+//					 haben wie beim letzten erfolgreichen bersetzen.
+//
+// Rckgabe: TRUE, wenn der Inhalt unverndert ist, FALSE sonst
+//////////////////////////////////////////////////////////////////////////////
+
+BOOL SourceUnchanged (HANDLE hDat, LPSTR file)
+{
+	int i;
+	BOOL ok;
+	DWORD dwSize, dwHash;
+	LPBDBENTRY lpEnt;
+
+	LoadBuildDatabase ((LPGLOBALDATA)GlobalLock (hDat));
+	GlobalUnlock (hDat);
+	if (((i=FindBuildEntry (file))<0) || !HashSource (file, &dwSize, &dwHash))
+		return FALSE;
+	lpEnt=(LPBDBENTRY)GlobalLock (hBdb)+i;
+	ok=(lpEnt->dwSize==dwSize) && (lpEnt->dwHash==dwHash);
+	GlobalUnlock (hBdb);
 	return ok;
 }
 
 
 
 //////////////////////////////////////////////////////////////////////////////
-// EXPORT BOOL CALLBACK CompileFile (HANDLE hDat, LPSTR file, FARPROC msg, 
-// 																	 FARPROC err, HWND fromWnd, FARPROC first, 
-// 																	 FARPROC next, FARPROC fileOpen, 
-//																	 FARPROC fileRead, FARPROC fileClose)
+// void RecordBuild (HANDLE hDat, LPSTR file)
 //////////////////////////////////////////////////////////////////////////////
-// Funktion: Ruft den Compiler "gcc" auf und compiliert die Datei "file".
-//					 Fehler werden mittels der Prozedur "err" bergeben.
+// Funktion: Merkt Gre und Hashwert (mit lokalen Headern) von "file" nach
+//					 erfolgreichem bersetzen in der Build-Datenbank.
 //
-// Rckgabe: TRUE, wenn sich Interface des Moduls gendert hat
+// Rckgabe: -
 //////////////////////////////////////////////////////////////////////////////
 
-EXPORT BOOL CALLBACK CompileFile (HANDLE hDat, 
-																	LPSTR file, 
-																	FARPROC msg, 
-																	FARPROC err,
-																	HWND fromWnd, 
-																	FARPROC first, 
-																	FARPROC next,
-																	FARPROC fileOpen, 
-																	FARPROC fileRead, 
-																	FARPROC fileClose)
+void RecordBuild (HANDLE hDat, LPSTR file)
+{
+	int i;
+	HANDLE h;
+	DWORD dwSize, dwHash;
+	LPBDBENTRY lpEnt;
+
+	if (!HashSource (file, &dwSize, &dwHash))
+		return;
+	LoadBuildDatabase ((LPGLOBALDATA)GlobalLock (hDat));
+	GlobalUnlock (hDat);
+	if (!hBdb)
+		return;
+	if ((i=FindBuildEntry (file))<0)
+	{	// neue Quelldatei -> Eintrag anhngen
+		if (iBdbNum==iBdbMax)
+		{
+			if ((h=GlobalReAlloc (hBdb, 2*iBdbMax*sizeof(BDBENTRY), GMEM_MOVEABLE))==NULL)
+				return;
+			hBdb=h; iBdbMax*=2;
+		}
+		i=iBdbNum++;
+		lpEnt=(LPBDBENTRY)GlobalLock (hBdb)+i;
+		strncpy (lpEnt->strFile, file, _MAX_PATH-1);
+		lpEnt->strFile[_MAX_PATH-1]='\0';
+		_strlwr (lpEnt->strFile);
+	}
+	else
+		lpEnt=(LPBDBENTRY)GlobalLock (hBdb)+i;
+	lpEnt->dwSize=dwSize;
+	lpEnt->dwHash=dwHash;
+	GlobalUnlock (hBdb);
+	SaveBuildDatabase();
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// void CompileTempFile (LPSTR file, char strTempFile[])
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Bestimmt die temporre Datei, in die die Ausgabe beim ber-
+//					 setzen von "file" umgeleitet wird. Die Endung gehrt zum Namen,
+//					 da z.B. "name.c" und "name.rc" gleichzeitig bersetzt werden.
+//////////////////////////////////////////////////////////////////////////////
+
+void CompileTempFile (LPSTR file, char strTempFile[])
+{
+	char drive[_MAX_DRIVE], dir[_MAX_DIR], fname[_MAX_FNAME], ext[_MAX_EXT];
+
+	_splitpath (file, drive, dir, fname, ext);
+	sprintf (strTempFile, "%s%s%s%s.tmp", drive, dir, _strlwr(fname), _strlwr(ext));
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// BOOL PrepareCompile (HANDLE hDat, LPSTR file, FARPROC msg, 
+//											char strCommandLine[], char strTempFile[])
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Wechselt in das Projektverzeichnis und stellt die Befehlszeile
+//					 zum bersetzen der Datei "file" zusammen (gcc, bzw. windres fr
+//					 Resourcen). Befehlszeile und Info werden mit "msg" ausgegeben.
+//
+// Rckgabe: FALSE, wenn "file" nicht bersetzt wird (.h, .def), TRUE sonst.
+//////////////////////////////////////////////////////////////////////////////
+
+BOOL PrepareCompile (HANDLE hDat, 
+										 LPSTR file, 
+										 FARPROC msg, 
+										 char strCommandLine[], 
+										 char strTempFile[])
 {
 	LPGLOBALDATA lpGlobDat;
-	char strCommandLine[_MAX_PATH],						// Befehlszeile: Aufruf des Compilers
-			 strPrjDir[_MAX_PATH],								// Projektverzeichnis
+	BOOL bCompile=FALSE;											// Rckgabewert der Funktion
+	char strPrjDir[_MAX_PATH],								// Projektverzeichnis
 			 strSourceFile[_MAX_FNAME+_MAX_EXT],	// zu kompilierende Datei
 			 strTargetFile[_MAX_PATH],						// kompilierte Datei
-			 strTempFile[_MAX_PATH],							// temporre Datei (Fehlerausgabe speichern)
 			 drive[_MAX_DRIVE], dir[_MAX_DIR],		// werden zum zerlegen eines Pfades "drive:\dir\fname.ext"
 			 fname[_MAX_FNAME], ext[_MAX_EXT],		// in seine Bestandteile bentigt
 			 strSwitches[MAX_SW_LENGTH],					// Compileroptionen fr Aufruf
@@ -872,10 +1306,11 @@ EXPORT BOOL CALLBACK CompileFile (HANDLE hDat,
 	// Prfung, ob es sich um ein Headerfile (.h) oder Definitionfile (.def) handelt
 	if ((strcmp (_strlwr(ext), ".h")) && (strcmp (_strlwr(ext), ".def")))
 	{
+		bCompile=TRUE;
 		_strlwr(fname);	// Umwandlung in Kleinschreibung
 		// Sourcefile und Tempfile bestimmen
 		sprintf (strSourceFile, "%s%s", fname, ext);
-		sprintf (strTempFile, "%s%s%s.tmp", drive, dir, fname);
+		CompileTempFile (file, strTempFile);
 		if (!strcmp(_strlwr(ext), ".rc"))
 		{		// Wenn Quelldatei eine Resource (.rc), dann windres aufrufen 
 			sprintf (strTargetFile, "%s.coff", fname);
@@ -891,26 +1326,88 @@ EXPORT BOOL CALLBACK CompileFile (HANDLE hDat,
 		msg(strCommandLine);	// Ausgeben der Befehlszeile
 		sprintf (strInfo, "Compiling '%s' ...", file);	// Info ausgeben
 		msg(strInfo);
-		GlobalUnlock (hDat);
-		// Aufruf der erstellten Befehlszeile, Fehler werden in strTempFile umgeleitet
-		if (RunCommand (strCommandLine, strTempFile))
+	}
+	GlobalUnlock (hDat);
+	return bCompile;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// void FinishCompile (HANDLE hDat, LPSTR file, char strTempFile[], 
+//										 FARPROC msg, FARPROC err)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Wertet das Ergebnis des beendeten Compilers fr die Datei "file"
+//					 aus. Fehler werden mittels der Prozedur "err" bergeben, fehler-
+//					 frei bersetzte Dateien in die Build-Datenbank eingetragen.
+//////////////////////////////////////////////////////////////////////////////
+
+void FinishCompile (HANDLE hDat, 
+										LPSTR file, 
+										char strTempFile[], 
+										FARPROC msg, 
+										FARPROC err)
+{
+	DWORD dwErrors;														// Anzahl der Fehler beim bersetzen
+	char drive[_MAX_DRIVE], dir[_MAX_DIR], fname[_MAX_FNAME], ext[_MAX_EXT];
+
+	_splitpath (file, drive, dir, fname, ext);
+	if (!strcmp(_strlwr(ext), ".rc"))
+	{
+		// beim Aufruf des Resourcencompilers "windres" ist es nicht mglich die Ausgabe
+		// umzuleiten, deshalb wird nur geprft, ob eine (.coff) Datei erzeugt wurde, 
+		// dann wurde der Compiler-Vorgang korrekt abgschlossen, sonst ist ein Fehler 
+		// aufgetreten. Es kann jedoch nicht bestimmt werden wo im Source.
+		if (!FileWasCompiled(hDat, file))
+			err(-1, 0, 0, FALSE, "Error in resource file.");	// trotzdem Fehler melden!
+		else 
 		{
-			if (!strcmp(_strlwr(ext), ".rc"))
-			{
-				// beim Aufruf des Resourcencompilers "windres" ist es nicht mglich die Ausgabe
-				// umzuleiten, deshalb wird nur geprft, ob eine (.coff) Datei erzeugt wurde, 
-				// dann wurde der Compiler-Vorgang korrekt abgschlossen, sonst ist ein Fehler 
-				// aufgetreten. Es kann jedoch nicht bestimmt werden wo im Source.
-				if (!FileWasCompiled(hDat, file))
-					err(-1, 0, 0, FALSE, "Error in resource file.");	// trotzdem Fehler melden!
-				else msg("0 Error(s), 0 Warning(s)");
-			}
-			else
-			{
-				if (!GetErrors(strTempFile, msg, err))		// Fehler beim kompilieren prfen
-					msg("Error: Could not open Logfile!");	// Fehler beim erstellen der Logdatei 
-			}
+			msg("0 Error(s), 0 Warning(s)");
+			RecordBuild(hDat, file);	// Inhalt der bersetzten Resource merken
 		}
+	}
+	else
+	{
+		if (!GetErrors(strTempFile, msg, err, &dwErrors))		// Fehler beim kompilieren prfen
+			msg("Error: Could not open Logfile!");	// Fehler beim erstellen der Logdatei 
+		else if (dwErrors==0)
+			RecordBuild(hDat, file);	// Inhalt der bersetzten Quelle merken
+	}
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// EXPORT BOOL CALLBACK CompileFile (HANDLE hDat, LPSTR file, FARPROC msg, 
+// 																	 FARPROC err, HWND fromWnd, FARPROC first, 
+// 																	 FARPROC next, FARPROC fileOpen, 
+//																	 FARPROC fileRead, FARPROC fileClose)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Ruft den Compiler "gcc" auf und compiliert die Datei "file".
+//					 Fehler werden mittels der Prozedur "err" bergeben.
+//
+// Rckgabe: TRUE, wenn sich Interface des Moduls gendert hat
+//////////////////////////////////////////////////////////////////////////////
+
+EXPORT BOOL CALLBACK CompileFile (HANDLE hDat, 
+																	LPSTR file, 
+																	FARPROC msg, 
+																	FARPROC err,
+																	HWND fromWnd, 
+																	FARPROC first, 
+																	FARPROC next,
+																	FARPROC fileOpen, 
+																	FARPROC fileRead, 
+																	FARPROC fileClose)
+{
+	char strCommandLine[_MAX_PATH],						// Befehlszeile: Aufruf des Compilers
+			 strTempFile[_MAX_PATH];							// temporre Datei (Fehlerausgabe speichern)
+
+	if (PrepareCompile (hDat, file, msg, strCommandLine, strTempFile))
+	{
+		// Aufruf der erstellten Befehlszeile, Fehler werden in strTempFile umgeleitet
+		if (RunCommand (strCommandLine, strTempFile))
+			FinishCompile (hDat, file, strTempFile, msg, err);
 		else 
 			msg ("Error: Could not start process.");		// Fehler im Prozess !!
 	}
@@ -919,6 +1416,62 @@ EXPORT BOOL CALLBACK CompileFile (HANDLE hDat,
 
 
 
+//////////////////////////////////////////////////////////////////////////////
+// EXPORT HANDLE CALLBACK CompileStart (HANDLE hDat, LPSTR file, FARPROC msg)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Startet den Compiler fr die Datei "file", ohne auf sein Ende
+//					 zu warten. Pow! wartet auf das Handle des Prozesses und ruft
+//					 danach CompileEnd auf; so knnen mehrere Module gleichzeitig
+//					 bersetzt werden.
+//
+// Rckgabe: Handle des Compilerprozesses, NULL wenn kein Prozess gestartet
+//					 wurde (Pow! ruft dann CompileFile auf).
+//////////////////////////////////////////////////////////////////////////////
+
+EXPORT HANDLE CALLBACK CompileStart (HANDLE hDat, 
+																		 LPSTR file, 
+																		 FARPROC msg)
+{
+	char strCommandLine[_MAX_PATH],						// Befehlszeile: Aufruf des Compilers
+			 strTempFile[_MAX_PATH];							// temporre Datei (Fehlerausgabe speichern)
+
+	if (!PrepareCompile (hDat, file, msg, strCommandLine, strTempFile))
+		return NULL;
+	return StartCommand (strCommandLine, strTempFile);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////////////
+// EXPORT BOOL CALLBACK CompileEnd (HANDLE hDat, LPSTR file, HANDLE hProcess,
+//																	FARPROC msg, FARPROC err)
+//////////////////////////////////////////////////////////////////////////////
+// Funktion: Wertet die bersetzung der Datei "file" aus, nachdem der mit
+//					 CompileStart gestartete Prozess "hProcess" beendet ist, und
+//					 schliet sein Handle. Fehler werden mittels "err" bergeben.
+//
+// Rckgabe: TRUE, wenn sich Interface des Moduls gendert hat
+//////////////////////////////////////////////////////////////////////////////
+
+EXPORT BOOL CALLBACK CompileEnd (HANDLE hDat, 
+																 LPSTR file, 
+																 HANDLE hProcess, 
+																 FARPROC msg, 
+																 FARPROC err)
+{
+	char strTempFile[_MAX_PATH],							// temporre Datei (Fehlerausgabe speichern)
+			 strInfo[_MAX_PATH+20];								// Ausgabestring fr Pow!
+
+	CloseHandle (hProcess);	// Prozess-Handle schlieen
+	sprintf (strInfo, "Finished '%s':", file);	// Ergebnisse gehren zu "file"
+	msg(strInfo);
+	CompileTempFile (file, strTempFile);
+	FinishCompile (hDat, file, strTempFile, msg, err);
+	return TRUE;
+}
+
+
+
 //////////////////////////////////////////////////////////////////////////////
 // BOOL CheckHeaderFile (HANDLE hDat, char strFile[])
 //////////////////////////////////////////////////////////////////////////////
@@ -1191,7 +1744,8 @@ EXPORT BOOL CALLBACK SourceAvailable (HANDLE hDat,
 // EXPORT BOOL CALLBACK MustBeBuilt (HANDLE hDat, LPSTR file)
 //////////////////////////////////////////////////////////////////////////////
 // Funktion: "file" mu bersetzt werden, wenn kein dazugehriges Objekt-File
-//					 existiert, bzw. wenn "file" jnger als das Objekt-File ist.
+//					 existiert, bzw. wenn "file" jnger als das Objekt-File ist und
+//					 sich sein Inhalt seit dem letzten bersetzen gendert hat.
 //
 // Rckgabe: TRUE, wenn "file" bersetzt werden mu, FALSE sonst
 //////////////////////////////////////////////////////////////////////////////
@@ -1214,6 +1768,9 @@ EXPORT BOOL CALLBACK MustBeBuilt (HANDLE hDat,
 		else	
 			sprintf (strObjFile, "%s%s%s.o", drive, dir, fname);	// Objektfile
 		ok=CheckIfYounger(hDat, file, strObjFile);	// prfen, ob ObjFile existiert, bzw. ob jnger
+		// Objektfile vorhanden, Quelle aber nur berhrt? -> nicht bersetzen
+		if (ok && (GetFileAttributes (strObjFile)!=0xFFFFFFFF) && SourceUnchanged (hDat, file))
+			ok=FALSE;
 	}
 	return ok;
 }
@@ -1519,7 +2076,7 @@ EXPORT void CALLBACK Link (HANDLE hDat,
 			if (RunCommand(strDLLToolLine, strTempFile)) 
 			{
 				// prfen, ob Fehler
-				if (!GetErrors(strTempFile, msg, NULL)) 
+				if (!GetErrors(strTempFile, msg, NULL, NULL)) 
 					msg("Error: Could not open Logfile!"); 
 			}
 			else 
@@ -1531,7 +2088,7 @@ EXPORT void CALLBACK Link (HANDLE hDat,
 		msg(strCommandLine);
 		if (RunCommand (strCommandLine, strTempFile))
 		{
-			if (!GetErrors(strTempFile, msg, NULL))		// auf Fehler prfen
+			if (!GetErrors(strTempFile, msg, NULL, NULL))		// auf Fehler prfen
 				msg("Error: Could not open Logfile!"); 
 		}
 		else 
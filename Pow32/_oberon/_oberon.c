@@ -91,6 +91,7 @@ typedef INSTDATA far *LPINSTDATA;
 
 HANDLE hInst;                          /* instance handle of dll */
 FARPROC errMsg;                        /* send error message to pow! */
+int errNum;                            /* # of errors in last compilation */
 char homeDir[MAXPATHLENGTH];                      /* home directory of pow! */
 DWORD ddeInstId;                       /* DDEML instance handle of pow! */
 
@@ -154,6 +155,8 @@ FileExt
 void FAR PASCAL NewProject (HANDLE hData);
 void CreateDir (LPSTR dir);
 int ObjectdirValid (LPINSTDATA lpInst);
+BOOL RecordBuild (LPINSTDATA lpInst,LPSTR file,BOOL changed);
+void FreeBuildDatabase (void);
 
 extern BOOL FAR PASCAL Oberon2 (LPSTR command);
 extern void FAR PASCAL GetCompilerVersion (LPSTR version);
@@ -522,6 +525,9 @@ BOOL FAR PASCAL _export CompileOptions (HANDLE hData,HWND hwnd)
 
 void FAR PASCAL _export ErrorCallback (int num,int line,int col,BOOL warn,LPSTR txt)
 {
+   if (!warn)
+      errNum++;
+
    /* pass message to pow! */
    (*(CompErr*)errMsg)(num,line,col,warn,(LPSTR)txt);
 }
@@ -535,57 +541,281 @@ void FAR PASCAL _export ResourceError (int num,int col,int line,BOOL warn,LPSTR
    (*(CompErr*)errMsg)(num,line,col,warn,txt);
 }
 
-/********************************************************************
- * check library for Oberon-2 modules and tell compiler their names *
- ********************************************************************/
+/*****************************************************************
+ * library index: Oberon-2 modules found in project libraries,   *
+ * so that a library is only scanned again after it has changed  *
+ *****************************************************************/
 
-void SearchLibraryForModules (LPSTR lib)
+#define LIXVERSION "Pow! library index 1.0"
+
+typedef struct {
+   char lib[MAXPATHLENGTH];            /* library file */
+   long size;                          /* size of library when it was scanned */
+   time_t time;                        /* modification time of library */
+   UINT len;                           /* length of module names */
+   HANDLE hNames;                      /* module names, each terminated by 0 */
+} LIXENTRY;
+
+typedef LIXENTRY far *LPLIXENTRY;
+
+HANDLE hLix=0;                         /* entries of library index */
+int lixNum,lixMax;                     /* used and allocated entries */
+BOOL lixLoaded=FALSE;                  /* index file has been read */
+BOOL lixChanged=FALSE;                 /* index must be written */
+
+/* library index is shared by all projects (<pow>\_oberon.lix) */
+void LibraryIndexName (LPSTR name)
+{
+   lstrcpy(name,(LPSTR)homeDir);
+   lstrcat(name,"_oberon.lix");
+}
+
+void LoadLibraryIndex (void)
+{
+   int i,n;
+   HFILE fil;
+   LPLIXENTRY lpEnt;
+   char name[MAXPATHLENGTH],version[sizeof(LIXVERSION)];
+
+   lixLoaded=TRUE;
+   lixChanged=FALSE;
+   lixNum=0;
+   lixMax=16;
+   if (!(hLix=GlobalAlloc(GMEM_MOVEABLE,lixMax*sizeof(LIXENTRY))))
+      return;
+
+   LibraryIndexName((LPSTR)name);
+   if ((fil=_lopen((LPSTR)name,OF_READ))==HFILE_ERROR)
+      return;
+   if (_lread(fil,(LPSTR)version,sizeof(version))==sizeof(version) &&
+       strcmp(version,LIXVERSION)==0 &&
+       _lread(fil,(LPSTR)&n,sizeof(n))==sizeof(n) && n>0) {
+      HANDLE h;
+
+      if (n>lixMax && (h=GlobalReAlloc(hLix,n*sizeof(LIXENTRY),GMEM_MOVEABLE))!=0) {
+         hLix=h;
+         lixMax=n;
+      }
+      lpEnt=(LPLIXENTRY)GlobalLock(hLix);
+      for (i=0;i<n && i<lixMax;i++) {
+         if (_lread(fil,(LPSTR)&lpEnt[i],sizeof(LIXENTRY))!=sizeof(LIXENTRY) ||
+             !(lpEnt[i].hNames=GlobalAlloc(GMEM_MOVEABLE,lpEnt[i].len+1)))
+            break;
+         if (_lread(fil,(LPSTR)GlobalLock(lpEnt[i].hNames),lpEnt[i].len)!=lpEnt[i].len) {
+            GlobalUnlock(lpEnt[i].hNames);
+            GlobalFree(lpEnt[i].hNames);
+            break;
+         }
+         GlobalUnlock(lpEnt[i].hNames);
+      }
+      lixNum=i;
+      GlobalUnlock(hLix);
+   }
+   _lclose(fil);
+}
+
+void SaveLibraryIndex (void)
+{
+   int i;
+   HFILE fil;
+   LPLIXENTRY lpEnt;
+   char name[MAXPATHLENGTH],version[sizeof(LIXVERSION)];
+
+   LibraryIndexName((LPSTR)name);
+   if (!hLix || (fil=_lcreat((LPSTR)name,0))==HFILE_ERROR)
+      return;
+
+   strcpy(version,LIXVERSION);
+   _lwrite(fil,(LPSTR)version,sizeof(version));
+   _lwrite(fil,(LPSTR)&lixNum,sizeof(lixNum));
+   lpEnt=(LPLIXENTRY)GlobalLock(hLix);
+   for (i=0;i<lixNum;i++) {
+      _lwrite(fil,(LPSTR)&lpEnt[i],sizeof(LIXENTRY));
+      _lwrite(fil,(LPSTR)GlobalLock(lpEnt[i].hNames),lpEnt[i].len);
+      GlobalUnlock(lpEnt[i].hNames);
+   }
+   GlobalUnlock(hLix);
+   _lclose(fil);
+}
+
+/* write library index if necessary and release it */
+void FreeLibraryIndex (void)
+{
+   int i;
+   LPLIXENTRY lpEnt;
+
+   if (hLix) {
+      if (lixChanged)
+         SaveLibraryIndex();
+      lpEnt=(LPLIXENTRY)GlobalLock(hLix);
+      for (i=0;i<lixNum;i++)
+         GlobalFree(lpEnt[i].hNames);
+      GlobalUnlock(hLix);
+      GlobalFree(hLix);
+      hLix=0;
+   }
+   lixNum=0;
+   lixLoaded=FALSE;
+}
+
+/* search entry of library, return its index or -1 */
+int FindLibraryEntry (LPSTR lib)
+{
+   int i;
+   LPLIXENTRY lpEnt;
+
+   if (!hLix)
+      return -1;
+   lpEnt=(LPLIXENTRY)GlobalLock(hLix);
+   for (i=0;i<lixNum && stricmp(lpEnt[i].lib,lib);i++);
+   GlobalUnlock(hLix);
+   return i<lixNum ? i : -1;
+}
+
+/* remember module names of a library (entry i or a new one), return FALSE if out of memory */
+BOOL StoreLibraryEntry (int i,LPSTR lib,struct _stat *fstat,HANDLE hNames,UINT len)
+{
+   HANDLE h;
+   LPLIXENTRY lpEnt;
+
+   if (!hLix)
+      return FALSE;
+   if (i<0) {
+      if (lixNum==lixMax) {
+         if (!(h=GlobalReAlloc(hLix,2*lixMax*sizeof(LIXENTRY),GMEM_MOVEABLE)))
+            return FALSE;
+         hLix=h;
+         lixMax*=2;
+      }
+      i=lixNum++;
+      lpEnt=(LPLIXENTRY)GlobalLock(hLix);
+   }
+   else {
+      /* library has changed, forget old names */
+      lpEnt=(LPLIXENTRY)GlobalLock(hLix);
+      GlobalFree(lpEnt[i].hNames);
+   }
+   lstrcpy(lpEnt[i].lib,lib);
+   lpEnt[i].size=fstat->st_size;
+   lpEnt[i].time=fstat->st_mtime;
+   lpEnt[i].len=len;
+   lpEnt[i].hNames=hNames;
+   GlobalUnlock(hLix);
+   lixChanged=TRUE;
+   return TRUE;
+}
+
+/******************************************************
+ * check library for Oberon-2 modules, return names   *
+ ******************************************************/
+
+HANDLE ScanLibrary (LPSTR lib,LPUINT names)
 {
-	BOOL done;
+	HANDLE h;
 	HFILE fil;
 	long len;
 	ULONG symbols;
-	LPSTR lp;
+	LPSTR lp,dst;
 	char c;
 	char buf[50000];
 
-	done=TRUE;
-	if ((fil=_lopen((LPSTR)lib,OF_READ))!=HFILE_ERROR) {
-      len=(long)_lread(fil,(LPSTR)buf,sizeof(buf));
-		// ist this a library? (check signature)
-		if (strncmp(buf,"!<arch>\n",strlen("!<arch>\n"))==0) {
-			lp=buf+strlen("!<arch>\n");
-			// is this the first linker member part of the library?
-			if (*lp=='/') {
-				// skip archive member header
-				lp+=60; 
-
-				// get number of symbols (convert to big-endian)
-				c=*lp; *lp=*(lp+3); *(lp+3)=c;
-				c=*(lp+1); *(lp+1)=*(lp+2); *(lp+2)=c;
-				symbols=*(ULONG *)lp;
-
-				// skip symbol offsets
-				lp+=4*(symbols+1);
-
-				// check symbol strings for @@MODNAME entries (made by Pow! linker)
-				while (done && symbols && (lp-buf < len)) {
-					if (*lp=='@' && *(lp+1)=='@') {
-						// found an Oberon-2 module -> notify compiler
-						lp+=2;
-						AddDLLModule(lp,(long)0,strlen(lp),(LPINT)&done);
-						if (!done)
-							MessageBox(0,"Compiler did not accept DLL module name!","Warning",MB_OK|MB_ICONEXCLAMATION);
-					}
-					// go to next symbol
-					while (*lp && (lp-buf<len)) lp++;
-					if (!*lp) lp++;
-					symbols--;
+	if ((fil=_lopen((LPSTR)lib,OF_READ))==HFILE_ERROR)
+		return 0;
+	len=(long)_lread(fil,(LPSTR)buf,sizeof(buf));
+	_lclose(fil);
+	if (len==HFILE_ERROR)
+		return 0;
+
+	// names can not be longer than the part of the library read
+	if (!(h=GlobalAlloc(GMEM_MOVEABLE,len+1)))
+		return 0;
+	dst=(LPSTR)GlobalLock(h);
+	*names=0;
+
+	// ist this a library? (check signature)
+	if (strncmp(buf,"!<arch>\n",strlen("!<arch>\n"))==0) {
+		lp=buf+strlen("!<arch>\n");
+		// is this the first linker member part of the library?
+		if (*lp=='/') {
+			// skip archive member header
+			lp+=60; 
+
+			// get number of symbols (convert to big-endian)
+			c=*lp; *lp=*(lp+3); *(lp+3)=c;
+			c=*(lp+1); *(lp+1)=*(lp+2); *(lp+2)=c;
+			symbols=*(ULONG *)lp;
+
+			// skip symbol offsets
+			lp+=4*(symbols+1);
+
+			// check symbol strings for @@MODNAME entries (made by Pow! linker)
+			while (symbols && (lp-buf < len)) {
+				if (*lp=='@' && *(lp+1)=='@') {
+					// found an Oberon-2 module -> remember its name
+					lp+=2;
+					while (*lp && (lp-buf<len)) dst[(*names)++]=*lp++;
+					dst[(*names)++]=0;
 				}
+				// go to next symbol
+				while (*lp && (lp-buf<len)) lp++;
+				if (!*lp) lp++;
+				symbols--;
 			}
 		}
-	   _lclose(fil);         
 	}
+	GlobalUnlock(h);
+	return h;
+}
+
+/*********************************************************
+ * tell compiler the names of the modules in a library   *
+ * (from the library index, if the library is unchanged) *
+ *********************************************************/
+
+void SearchLibraryForModules (LPSTR lib)
+{
+	int i;
+	BOOL done,temp;
+	UINT len;
+	HANDLE h;
+	LPSTR lp,end;
+	LPLIXENTRY lpEnt;
+	struct _stat fstat;
+
+	if (!lixLoaded)
+		LoadLibraryIndex();
+	if (_stat(lib,&fstat)!=0)
+		return;
+
+	h=0;
+	if ((i=FindLibraryEntry(lib))>=0) {
+		lpEnt=(LPLIXENTRY)GlobalLock(hLix);
+		if (lpEnt[i].size==fstat.st_size && lpEnt[i].time==fstat.st_mtime) {
+			h=lpEnt[i].hNames;
+			len=lpEnt[i].len;
+		}
+		GlobalUnlock(hLix);
+	}
+	temp=FALSE;
+	if (!h) {
+		if (!(h=ScanLibrary(lib,&len)))
+			return;
+		temp=!StoreLibraryEntry(i,lib,&fstat,h,len);
+	}
+
+	done=TRUE;
+	lp=(LPSTR)GlobalLock(h);
+	end=lp+len;
+	while (done && lp<end) {
+		// Oberon-2 module -> notify compiler
+		AddDLLModule(lp,(long)0,strlen(lp),(LPINT)&done);
+		if (!done)
+			MessageBox(0,"Compiler did not accept DLL module name!","Warning",MB_OK|MB_ICONEXCLAMATION);
+		lp+=strlen(lp)+1;
+	}
+	GlobalUnlock(h);
+	if (temp)
+		GlobalFree(h);
 }
 
 /***********************************
@@ -602,6 +832,7 @@ BOOL CallCompiler (LPINSTDATA lpInst,LPSTR file,FARPROC err,FARPROC msg,FARPROC
 				   
    if (!ObjectdirValid(lpInst)) {
 	   MessageBox(0,"Object directory is invalid!","Error",MB_OK|MB_ICONEXCLAMATION);
+	   errNum++; /* nothing compiled, must not be recorded as built */
 	   return FALSE;
    }                               
 				   
@@ -758,8 +989,13 @@ BOOL FAR PASCAL _export CompileFile (HANDLE hData,LPSTR file,FARPROC msg,FARPROC
    lpInst->cSwitches&=(~CSW_LISTIMPORT);
    lpInst->cSwitches&=(~CSW_BROWSESYM);
     
+   errNum=0;
    ret=CallCompiler(lpInst,file,error,msg,NULL,lpInst->cSwitches|CSW_NEWSYMFILE,fromWnd,firstProc,nextProc,openProc,readProc,closeProc,flist);
    FreeProcInstance(error); 
+
+   /* remember source and interface of successful compilation */
+   if (!errNum)
+      ret=RecordBuild(lpInst,file,ret);
     
    GlobalUnlock(hData);
     
@@ -1978,6 +2214,244 @@ BOOL GetFileCreation (char *file,FILETIME *time)
    return FALSE;
 }
 
+/******************************************************************
+ * build database: contents of sources and symbol files as of the *
+ * last successful compilation, so that touched but unchanged     *
+ * files do not force recompilations                              *
+ ******************************************************************/
+
+#define BDBVERSION "Pow! build database 1.0"
+
+typedef struct {
+   char module[_MAX_FNAME];            /* module name */
+   DWORD srcSize;                      /* size of compiled source */
+   DWORD srcHash;                      /* hash of compiled source */
+   DWORD symHash;                      /* hash of produced symbol file */
+   FILETIME symTime;                   /* time, when interface changed last */
+} BDBENTRY;
+
+typedef BDBENTRY far *LPBDBENTRY;
+
+HANDLE hBdb=0;                         /* entries of build database */
+int bdbNum,bdbMax;                     /* used and allocated entries */
+char bdbFile[MAXPATHLENGTH];           /* file of build database */
+
+/* hash contents of a file, return TRUE if file exists */
+BOOL HashFile (LPSTR file,LPDWORD size,LPDWORD hash)
+{
+   HFILE fil;
+   UINT i,len;
+   DWORD h;
+   char buf[16384];
+
+   if ((fil=_lopen(file,OF_READ))==HFILE_ERROR)
+      return FALSE;
+
+   /* FNV-1a */
+   h=0x811C9DC5L;
+   *size=0;
+   while ((len=_lread(fil,(LPSTR)buf,sizeof(buf)))!=0 && len!=HFILE_ERROR) {
+      for (i=0;i<len;i++)
+         h=(h^(BYTE)buf[i])*0x01000193L;
+      *size+=len;
+   }
+   _lclose(fil);
+
+   *hash=h;
+   return TRUE;
+}
+
+void FreeBuildDatabase (void)
+{
+   if (hBdb) {
+      GlobalFree(hBdb);
+      hBdb=0;
+   }
+   *bdbFile=0;
+}
+
+/* load build database of project (<objdir>\<project>.bdb) */
+void LoadBuildDatabase (LPINSTDATA lpInst)
+{
+   HFILE fil;
+   char name[MAXPATHLENGTH],version[sizeof(BDBVERSION)];
+   char drv[_MAX_DRIVE],dir[_MAX_DIR],fname[_MAX_FNAME],ext[_MAX_EXT];
+
+   if (*(lpInst->objDir))
+      strcpy(name,lpInst->objDir);
+   else
+      strcpy(name,lpInst->prjDir);
+   if (*name && name[strlen(name)-1]!='\\')
+      strcat(name,"\\");
+   _splitpath(lpInst->prjFil,drv,dir,fname,ext);
+   strcat(name,fname);
+   strcat(name,".bdb");
+
+   /* already loaded? */
+   if (hBdb && stricmp(name,bdbFile)==0)
+      return;
+
+   FreeBuildDatabase();
+   bdbNum=0;
+   bdbMax=32;
+   if (!(hBdb=GlobalAlloc(GMEM_MOVEABLE,bdbMax*sizeof(BDBENTRY))))
+      return;
+   strcpy(bdbFile,name);
+
+   if ((fil=_lopen(bdbFile,OF_READ))!=HFILE_ERROR) {
+      int n;
+      HANDLE h;
+      LPBDBENTRY lpEnt;
+
+      if (_lread(fil,(LPSTR)version,sizeof(version))==sizeof(version) &&
+          strcmp(version,BDBVERSION)==0 &&
+          _lread(fil,(LPSTR)&n,sizeof(n))==sizeof(n) && n>0) {
+         if (n>bdbMax && (h=GlobalReAlloc(hBdb,n*sizeof(BDBENTRY),GMEM_MOVEABLE))!=0) {
+            hBdb=h;
+            bdbMax=n;
+         }
+         if (n<=bdbMax) {
+            lpEnt=(LPBDBENTRY)GlobalLock(hBdb);
+            if (_lread(fil,(LPSTR)lpEnt,n*sizeof(BDBENTRY))==n*sizeof(BDBENTRY))
+               bdbNum=n;
+            GlobalUnlock(hBdb);
+         }
+      }
+      _lclose(fil);
+   }
+}
+
+void SaveBuildDatabase (void)
+{
+   HFILE fil;
+   LPBDBENTRY lpEnt;
+   char version[sizeof(BDBVERSION)];
+
+   if (!hBdb || (fil=_lcreat(bdbFile,0))==HFILE_ERROR)
+      return;
+
+   strcpy(version,BDBVERSION);
+   _lwrite(fil,(LPSTR)version,sizeof(version));
+   _lwrite(fil,(LPSTR)&bdbNum,sizeof(bdbNum));
+   lpEnt=(LPBDBENTRY)GlobalLock(hBdb);
+   _lwrite(fil,(LPSTR)lpEnt,bdbNum*sizeof(BDBENTRY));
+   GlobalUnlock(hBdb);
+   _lclose(fil);
+}
+
+/* search entry of module, return its index or -1 */
+int FindBuildEntry (LPSTR module)
+{
+   int i;
+   LPBDBENTRY lpEnt;
+
+   if (!hBdb)
+      return -1;
+   lpEnt=(LPBDBENTRY)GlobalLock(hBdb);
+   for (i=0;i<bdbNum && stricmp(lpEnt[i].module,module);i++);
+   GlobalUnlock(hBdb);
+   return i<bdbNum ? i : -1;
+}
+
+/* check, if source has the contents it had at its last compilation */
+BOOL SourceUnchanged (LPINSTDATA lpInst,LPSTR file,LPSTR module)
+{
+   int i;
+   BOOL ret;
+   DWORD size,hash;
+   LPBDBENTRY lpEnt;
+
+   LoadBuildDatabase(lpInst);
+   if ((i=FindBuildEntry(module))<0 || !HashFile(file,&size,&hash))
+      return FALSE;
+
+   lpEnt=(LPBDBENTRY)GlobalLock(hBdb)+i;
+   ret=(lpEnt->srcSize==size && lpEnt->srcHash==hash);
+   GlobalUnlock(hBdb);
+   return ret;
+}
+
+/* check, if the interface in symbol file did not change since client was compiled */
+BOOL InterfaceUnchanged (LPINSTDATA lpInst,LPSTR sym,LPSTR module,FILETIME *clitime)
+{
+   int i;
+   BOOL ret;
+   DWORD size,hash;
+   LPBDBENTRY lpEnt;
+
+   LoadBuildDatabase(lpInst);
+   if ((i=FindBuildEntry(module))<0 || !HashFile(sym,&size,&hash))
+      return FALSE;
+
+   lpEnt=(LPBDBENTRY)GlobalLock(hBdb)+i;
+   ret=(lpEnt->symHash==hash && !WasEarlier(clitime,&lpEnt->symTime));
+   GlobalUnlock(hBdb);
+   return ret;
+}
+
+/* remember contents after successful compilation, */
+/* return FALSE if the symbol file did not really change */
+BOOL RecordBuild (LPINSTDATA lpInst,LPSTR file,BOOL changed)
+{
+   int i;
+   HANDLE h;
+   BOOL known;
+   DWORD size,hash;
+   LPBDBENTRY lpEnt;
+   char sym[MAXPATHLENGTH],drv[_MAX_DRIVE],dir[_MAX_DIR],fil[_MAX_FNAME],ext[_MAX_EXT];
+
+   _splitpath(file,drv,dir,fil,ext);
+   if (stricmp(ext,".rc")==0)
+      return changed;
+
+   if (*(lpInst->objDir))
+      strcpy(sym,lpInst->objDir);
+   else
+      strcpy(sym,lpInst->prjDir);
+   if (*sym && sym[strlen(sym)-1]!='\\')
+      strcat(sym,"\\");
+   strcat(sym,fil);
+   strcat(sym,".sym");
+
+   LoadBuildDatabase(lpInst);
+   if (!hBdb)
+      return changed;
+
+   /* new module -> add entry */
+   known=((i=FindBuildEntry(fil))>=0);
+   if (!known) {
+      if (bdbNum==bdbMax) {
+         if (!(h=GlobalReAlloc(hBdb,2*bdbMax*sizeof(BDBENTRY),GMEM_MOVEABLE)))
+            return changed;
+         hBdb=h;
+         bdbMax*=2;
+      }
+      i=bdbNum++;
+   }
+
+   lpEnt=(LPBDBENTRY)GlobalLock(hBdb)+i;
+   if (!known) {
+      memset(lpEnt,0,sizeof(BDBENTRY));
+      strncpy(lpEnt->module,fil,sizeof(lpEnt->module)-1);
+   }
+   if (!HashFile(file,&lpEnt->srcSize,&lpEnt->srcHash))
+      lpEnt->srcSize=lpEnt->srcHash=0;
+
+   /* interface changed? */
+   if (HashFile(sym,&size,&hash)) {
+      if (known && lpEnt->symHash==hash)
+         changed=FALSE;
+      else {
+         lpEnt->symHash=hash;
+         GetFileCreation(sym,&lpEnt->symTime);
+      }
+   }
+   GlobalUnlock(hBdb);
+
+   SaveBuildDatabase();
+   return changed;
+}
+
 // check, if a project file must be compiled
 BOOL FAR PASCAL _export MustBeBuilt (HANDLE hData,LPSTR file)
 {                                                         
@@ -2010,20 +2484,18 @@ BOOL FAR PASCAL _export MustBeBuilt (HANDLE hData,LPSTR file)
 	   strcat(sym,".sym");
    }
 
-   GlobalUnlock(hData);
-
    if (!GetFileCreation(file,&srctime))
-   	return FALSE;  // source does not exist -> no build necessary
-    
-   if (*sym && !GetFileCreation(sym,&symtime))
-   	return TRUE;   // no symbol file -> build necessary
+      ret=FALSE;     // source does not exist -> no build necessary
+   else if (*sym && !GetFileCreation(sym,&symtime))
+      ret=TRUE;      // no symbol file -> build necessary
+   else if (!GetFileCreation(obj,&objtime))
+      ret=TRUE;      // no object file -> build necessary
+   else
+      ret=WasEarlier(&objtime,&srctime) && (!*sym || !SourceUnchanged(lpInst,file,fil));
+                     // compilation necessary if object older than source and
+                     // source differs from the one compiled last
 
-   if (!GetFileCreation(obj,&objtime))
-   	return TRUE;   // no object file -> build necessary
-	
-   ret=WasEarlier(&objtime,&srctime);
-                     // compilation necessary if object older than source
-	 
+   GlobalUnlock(hData);
    return ret;
 }
 
@@ -2033,7 +2505,7 @@ BOOL FAR PASCAL _export CheckIfYounger (HANDLE hData,LPSTR module,LPSTR client)
    BOOL ret;
    LPINSTDATA lpInst;
    FILETIME modtime,clitime;
-   char drv[_MAX_DRIVE],dir[_MAX_DIR],fil[_MAX_FNAME],ext[_MAX_EXT],cliobj[_MAX_PATH],modsym[_MAX_PATH];
+   char drv[_MAX_DRIVE],dir[_MAX_DIR],fil[_MAX_FNAME],cli[_MAX_FNAME],ext[_MAX_EXT],cliobj[_MAX_PATH],modsym[_MAX_PATH];
 
    lpInst=(LPINSTDATA)GlobalLock(hData);
     
@@ -2050,19 +2522,19 @@ BOOL FAR PASCAL _export CheckIfYounger (HANDLE hData,LPSTR module,LPSTR client)
    strcat(modsym,fil);
    strcat(modsym,".sym");
     
-   _splitpath(client,drv,dir,fil,ext);
-   strcat(cliobj,fil);
+   _splitpath(client,drv,dir,cli,ext);
+   strcat(cliobj,cli);
    strcat(cliobj,".obj");
 
-   GlobalUnlock(hData);
-
    if (!GetFileCreation(modsym,&modtime))
-	   return FALSE;      // no module symbol file -> no compilation of client necessary
-		
-   ret=(!GetFileCreation(cliobj,&clitime) ||
-        WasEarlier(&clitime,&modtime));
-                         // no client object or client object older than module symbols -> compilation necessary
+	   ret=FALSE;         // no module symbol file -> no compilation of client necessary
+   else
+      ret=(!GetFileCreation(cliobj,&clitime) ||
+           (WasEarlier(&clitime,&modtime) && !InterfaceUnchanged(lpInst,modsym,fil,&clitime)));
+                         // no client object or client object older than module symbols,
+                         // whose interface really changed since -> compilation necessary
 	 
+   GlobalUnlock(hData);
    return ret;
 }
 
@@ -2151,6 +2623,8 @@ void FAR PASCAL _export ExitInterface (HANDLE hData)
    PurgeList((LPHANDLE)&lpInst->exports);
    PurgeList((LPHANDLE)&lpInst->imports);
    PurgeList((LPHANDLE)&lpInst->dllModules);
+   FreeBuildDatabase();
+   FreeLibraryIndex();
     
    GlobalUnlock(hData);
    GlobalFree(hData);  
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
+#include <process.h>
 
 #ifndef __LINKER_HPP__
 #include "Linker.h"
@@ -48,6 +49,61 @@
 
 #define MAX_SCOPE_LEVEL	10
 
+#define TYP_MAP_NEW   0	// Typ hat noch keinen globalen Typindex
+#define TYP_MAP_ACT   1	// Typindizes im Typ werden gerade zugeordnet
+#define TYP_MAP_GLO   2	// Typ steht in sstGloTypArr
+#define TYP_MAP_DUP   3	// Gleicher Typ steht bereits in sstGloTypArr
+
+#define GLO_TYP_HSH_SIZ	0x1000
+
+#define CV_HSH_NO_ADR	0xFFFF	// Symbol erhlt keinen Eintrag in der Adretabelle
+
+#define CV_NO_FIX_OFF	0xFFFFFFFF	// Typverweis kommt in diesem Puffer nicht vor
+
+/**************************************************************************************************/
+/*** Auftrge fr das parallele Erstellen der CV Module. Ein Auftrag hlt die Teile einer       ***/
+/*** Objektdatei, die nur von ihr selbst abhngen: den sstModule Eintrag, das sstAlignSym mit   ***/
+/*** den Typindizes der Objektdatei samt der Liste der Typverweise und das sstSrcModule.        ***/
+/**************************************************************************************************/
+
+struct myCVTypFix
+{
+ DWORD objTypInd;			// Typindex in der Objektdatei
+ DWORD alnSymOff;			// Position des Typindexes in alnSymRawDat (ohne alnSymShf)
+ DWORD gloRecOff;			// Position des Typindexes in gloRecRawDat
+ WORD  typSiz;					// sizeof(WORD) bei CV4, sizeof(DWORD) bei CV5
+ WORD  pad;
+};
+
+struct myCVModJob
+{
+ CObjFile   *objFil;
+ WORD       bldCVMod;   // Zu erstellende Teile (CV_MOD_120, CV_MOD_125, CV_MOD_127)
+ WORD       donCVMod;   // Fertige Teile
+ CMyMemFile *sstModRawDat;
+ CObjFile   *sstModObjFil;
+ CMyMemFile *alnSymRawDat;
+ DWORD      alnSymShf;  // Verschiebung durch den vorangestellten Start Search Record
+ CMyMemFile *typFixRawDat;
+ CMyMemFile *gloRecRawDat;
+ CPtrArray  *objFilTypArr;
+ DWORD      objFilTypInd;
+ CMyMemFile *rawDatSecT;
+ DWORD      typVerSgn;
+ CMyMemFile *srcModRawDat;
+};
+
+struct myCVModWork
+{
+ myCVModJob           *jobArr;
+ LONG                 jobNum;
+ LONG                 nxtJob;
+ LONG                 modCur;
+ LONG                 alnCur;
+ LONG                 srcCur;
+ CExeFileDebugSection *dbgSec;
+};
+
 extern void WriteMessageToPow(WORD msgNr, char *str1, char *str2);
 
 BOOL WritePadBytes(CMyMemFile *rawDat, WORD bytTilAlnEnd);
@@ -55,6 +111,9 @@ BOOL SeekNumericLeaf(CMyMemFile *rawDat);
 DWORD GiveTableHash(char *lpbName);
 BOOL AppandCVModAndDirectoryToCVModule(CMyMemFile *modRawDat, CMyMemFile *srcRawDat, CMyMemFile *subSecDirRawDat,
 																																							WORD subDirInd, WORD modInd) ;
+static void InitCVModJob(myCVModJob *aJob, CObjFile *aObjFil, WORD bldCVMod);
+static void FreeCVModJob(myCVModJob *aJob);
+static myCVModJob *GiveCVModJob(CObjFile *aObjFil, WORD cVMod, myCVModWork *modWork);
 
 extern void MessageOut (FARPROC msg, char *error);
 extern void TestHeap(void);
@@ -73,6 +132,8 @@ extern	FILE	*logFil;
 extern	char	*logFilNam;
 extern 	int	logOn;   
 
+extern BOOL parDbg;  // In Linker.cpp definiert
+
 extern BYTE chrBufCC[];
 extern BYTE chrBuf00[];
 
@@ -103,6 +164,10 @@ CExeFileDebugSection::CExeFileDebugSection() : CExeFileDataSection()
  newExeFil= NULL;
 	exeFilSecFrgLst= NULL;
 	sstGloTypArr= NULL;
+	gloTypHshTab= NULL;
+	gloTypHshSiz= 0;
+	actRawDatSecT= NULL;
+	actTypObjFil= NULL;
 	chgDbgTSecLst= NULL;
 
 	bldMisc= TRUE;
@@ -133,6 +198,10 @@ CExeFileDebugSection::CExeFileDebugSection(char *secName, CExeFile *nExeFil, WOR
 	gloDatSymLst= new CMyMapStringToPtr(100);;
 	sstGloTypArr= new CPtrArray();
 	sstGloTypArr-> SetSize(0x400, 0x200);
+	gloTypHshTab= NULL;
+	gloTypHshSiz= 0;
+	actRawDatSecT= NULL;
+	actTypObjFil= NULL;
 	rawDatMisc= NULL;
 	rawDatFpo= NULL;
 	rawDatCV= NULL;
@@ -303,6 +372,13 @@ void CExeFileDebugSection::FreeUsedMemory()
 		sstGloTypArr= NULL;
 	}
 
+	if (gloTypHshTab)
+	{
+		free(gloTypHshTab);
+		gloTypHshTab= NULL;
+		gloTypHshSiz= 0;
+	}
+
 	if (exeFilSecFrgLst)
 	{
 		frgEntPos= exeFilSecFrgLst-> GetStartPosition();
@@ -499,6 +575,7 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 	CMyMapStringToOb		*actDllImpLst;	
 	CDllExportEntry			*actDllExpEnt;
 	CObjFile										*actObjFil;
+	myCVModWork				modWork;
 	
  POSITION   objFilLstPos;
 	POSITION			dllExpLstPos;
@@ -515,6 +592,8 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
  BYTE  *datBuf;
 
 	WORD		bldCVMod;
+	LONG		jobInd;
+	DWORD	cVRawDatSiz;
 
 
 	bldCVMod= CV_MOD_120 +	
@@ -534,13 +613,41 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
  memset(&subSecDirHdr, 0x00, CV_SUB_SEC_DIR_HDR_SIZ);
  memset(&subSecDirEnt, 0x00, CV_SUB_SEC_DIR_ENT_SIZ);
 
+	/*** Die sstModule Eintrge, die sstAlignSym (0x125) und die sstSrcModule (0x127) hngen bis ***/
+	/*** auf die globalen Typen und Symbole nur von ihrer Objektdatei ab und werden vorab parallel ***/
+	/*** erstellt. Das Zusammenfhren mit den globalen Daten erfolgt unten in der Modulreihenfolge ***/
+
+	modWork.jobArr= NULL;
+	modWork.jobNum= 0;
+	modWork.nxtJob= 0;
+	modWork.modCur= 0;
+	modWork.alnCur= 0;
+	modWork.srcCur= 0;
+	modWork.dbgSec= this;
+
+	if (parDbg && (bldCVMod & (CV_MOD_120 | CV_MOD_125 | CV_MOD_127)))
+		BuildCVModulesParallel(obFilLst, dllImpLstLst, bldCVMod, &modWork);
+
+	// Die vorab erstellten Teile bestimmen die Gre der Module, Speicher dafr auf einmal anlegen
+	cVRawDatSiz= rawDatCV-> GetLength();
+	for(jobInd= 0; jobInd < modWork.jobNum; jobInd++)
+	{
+		if (modWork.jobArr[jobInd].sstModRawDat)
+			cVRawDatSiz+= modWork.jobArr[jobInd].sstModRawDat-> GetLength();
+		if (modWork.jobArr[jobInd].alnSymRawDat)
+			cVRawDatSiz+= modWork.jobArr[jobInd].alnSymRawDat-> GetLength() + sizeof(DWORD);
+		if (modWork.jobArr[jobInd].srcModRawDat)
+			cVRawDatSiz+= modWork.jobArr[jobInd].srcModRawDat-> GetLength() + sizeof(DWORD);
+	}
+	rawDatCV-> Reserve(cVRawDatSiz);
+
  /*************/
 	/*** 0x120 ***/
 	/*************/
 
 	if (bldCVMod & CV_MOD_120)
 	{
-		rawDatCVsstMod= BuildCVsstModule(obFilLst, newExeFil, dllImpLstLst); 
+		rawDatCVsstMod= BuildCVsstModule(obFilLst, newExeFil, dllImpLstLst, &modWork); 
 		rawDatCVsstMod-> SeekToBegin(); 
 		datBuf= (BYTE *) rawDatCVsstMod-> ReadWithoutMemcpy(rawDatCVsstMod-> GetLength());
 		rawDatCV-> Write(datBuf, rawDatCVsstMod-> GetLength());
@@ -571,7 +678,7 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 	 	
 				if (bldCVMod & CV_MOD_125)
 				{
-					rawDatCVsstAlnSym= BuildCVsstAlignSym(actObjFil); 	
+					rawDatCVsstAlnSym= GiveCVsstAlignSym(actObjFil, &modWork); 	
 					if (rawDatCVsstAlnSym)
 					{
 						AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstAlnSym, subSecDirCV, 0x0125, actObjFil-> cvModInd);
@@ -589,7 +696,7 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 				{
 					if (!actObjFil-> incDllFun)
 					{
-						rawDatCVsstSrcMod= BuildCVsstSrcModule(actObjFil);
+						rawDatCVsstSrcMod= GiveCVsstSrcModule(actObjFil, &modWork);
 						if (rawDatCVsstSrcMod)
 						{
 							AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstSrcMod, subSecDirCV, 0x0127, actObjFil-> cvModInd);
@@ -620,7 +727,7 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 			{
 				actDllImpLst-> GetNextAssoc(dllLstEntPos, dllEntNam, (CObject *&) actDllExpEnt);
 			
-				rawDatCVsstAlnSym= BuildCVsstAlignSym(actDllExpEnt-> dllObjFil); 	
+				rawDatCVsstAlnSym= GiveCVsstAlignSym(actDllExpEnt-> dllObjFil, &modWork); 	
 				if (rawDatCVsstAlnSym)
 				{
 					AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstAlnSym, subSecDirCV, 0x0125,  actDllExpEnt-> dllObjFil-> cvModInd);
@@ -655,7 +762,7 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 					/* 0x125 */
 					/*-------*/
 									
-					rawDatCVsstAlnSym= BuildCVsstAlignSym(actObjFil); 	
+					rawDatCVsstAlnSym= GiveCVsstAlignSym(actObjFil, &modWork); 	
 					if (rawDatCVsstAlnSym)
 					{
 						AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstAlnSym, subSecDirCV, 0x0125, actObjFil-> cvModInd);
@@ -674,7 +781,7 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 			{
 				if (actObjFil-> linNmbInc && actObjFil-> libObjFil)
 				{
-					rawDatCVsstSrcMod= BuildCVsstSrcModule(actObjFil);
+					rawDatCVsstSrcMod= GiveCVsstSrcModule(actObjFil, &modWork);
 					if (rawDatCVsstSrcMod)
 					{
 						AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstSrcMod, subSecDirCV, 0x0127, actObjFil-> cvModInd);
@@ -691,16 +798,66 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 			
 		}
  }
+
+	// Nicht abgeholte Teile der Auftrge freigeben, sollte nicht vorkommen
+	for(jobInd= 0; jobInd < modWork.jobNum; jobInd++)
+		FreeCVModJob(&modWork.jobArr[jobInd]);
+	if (modWork.jobArr)
+		free(modWork.jobArr);
 	
 
 	/************************************************************************************/
 
+	/*** Die globalen Module werden zuerst erstellt, damit ihre Gre bekannt ist. Danach wird     ***/
+	/*** der Speicher fr sie und das Subsection Directory auf einmal angelegt und die Module in   ***/
+	/*** der bisherigen Reihenfolge angehngt.                                                     ***/
+
+	rawDatCVsstGlbPub= NULL;
+	rawDatCVsstGlbSym= NULL;
+	rawDatCVsstStaSym= NULL;
+	rawDatCVsstLib= NULL;
+	rawDatCVsstGlbTyp= NULL;
+	rawDatCVsstSegMap= NULL;
+	rawDatCVsstFilInd= NULL;
+
+	if (bldCVMod & CV_MOD_12A)
+		rawDatCVsstGlbPub= BuildCVsstGlobalPub(obFilLst);
+	if (bldCVMod & CV_MOD_129)
+		rawDatCVsstGlbSym= BuildCVsstGlobalSym();
+	if (bldCVMod & CV_MOD_134)
+		rawDatCVsstStaSym= BuildCVsstStaSym();
+	if (bldCVMod & CV_MOD_128)
+		rawDatCVsstLib= BuildCVsstLibraries();
+	if (bldCVMod & CV_MOD_12B)
+		rawDatCVsstGlbTyp= BuildCVsstGlobalTypes();
+	if (bldCVMod & CV_MOD_12D)
+	 rawDatCVsstSegMap= BuildCVsstSegMap();
+	if (bldCVMod & CV_MOD_133)
+		rawDatCVsstFilInd= BuildCVsstFileIndex(obFilLst);
+
+	// Subsection Directory, dessen Eintrge fr die globalen Module, Signatur und Verweis
+	cVRawDatSiz= rawDatCV-> GetLength() + subSecDirCV-> GetLength() + 7 * CV_SUB_SEC_DIR_ENT_SIZ + 2 * sizeof(DWORD);
+	if (rawDatCVsstGlbPub)
+		cVRawDatSiz+= rawDatCVsstGlbPub-> GetLength();
+	if (rawDatCVsstGlbSym)
+		cVRawDatSiz+= rawDatCVsstGlbSym-> GetLength();
+	if (rawDatCVsstStaSym)
+		cVRawDatSiz+= rawDatCVsstStaSym-> GetLength();
+	if (rawDatCVsstLib)
+		cVRawDatSiz+= rawDatCVsstLib-> GetLength();
+	if (rawDatCVsstGlbTyp)
+		cVRawDatSiz+= rawDatCVsstGlbTyp-> GetLength();
+	if (rawDatCVsstSegMap)
+		cVRawDatSiz+= rawDatCVsstSegMap-> GetLength();
+	if (rawDatCVsstFilInd)
+		cVRawDatSiz+= rawDatCVsstFilInd-> GetLength();
+	rawDatCV-> Reserve(cVRawDatSiz);
+
 	/*************/
 	/*** 0x12A ***/
 	/*************/
-	if (bldCVMod & CV_MOD_12A)
+	if (rawDatCVsstGlbPub)
 	{
-		rawDatCVsstGlbPub= BuildCVsstGlobalPub(obFilLst);
 		AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstGlbPub, subSecDirCV, 0x012A, 0xFFFF);
 		subSecDirEntNum++;
 		if (BytesTillAlignEnd(rawDatCV-> GetLength(), sizeof(DWORD)))
@@ -712,9 +869,8 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
  /*-- 0x129 --*/
 	/*-----------*/
 
-	if (bldCVMod & CV_MOD_129)
+	if (rawDatCVsstGlbSym)
 	{
-		rawDatCVsstGlbSym= BuildCVsstGlobalSym();
 		AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstGlbSym, subSecDirCV, 0x0129, 0xFFFF);
 		subSecDirEntNum++;
 		if (BytesTillAlignEnd(rawDatCV-> GetLength(), sizeof(DWORD)))
@@ -725,9 +881,8 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
  /*-- 0x134 --*/
 	/*-----------*/
 
-	if (bldCVMod & CV_MOD_134)
+	if (rawDatCVsstStaSym)
 	{
-		rawDatCVsstStaSym= BuildCVsstStaSym();
 		AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstStaSym, subSecDirCV, 0x0134, 0xFFFF);
 		subSecDirEntNum++;
 		if (BytesTillAlignEnd(rawDatCV-> GetLength(), sizeof(DWORD)))
@@ -738,9 +893,8 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
  /*-- 0x128 --*/
 	/*-----------*/
 
-	if (bldCVMod & CV_MOD_128)
+	if (rawDatCVsstLib)
 	{
-		rawDatCVsstLib= BuildCVsstLibraries();
 		AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstLib, subSecDirCV, 0x0128, 0xFFFF);
 		subSecDirEntNum++;
 	}
@@ -748,9 +902,8 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
 	/*-----------*/
  /*-- 0x12B --*/
 	/*-----------*/
-	if (bldCVMod & CV_MOD_12B)
+	if (rawDatCVsstGlbTyp)
 	{
-		rawDatCVsstGlbTyp= BuildCVsstGlobalTypes();
 		AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstGlbTyp, subSecDirCV, 0x012B, 0xFFFF);
 		subSecDirEntNum++;
 		if (BytesTillAlignEnd(rawDatCV-> GetLength(), sizeof(DWORD)))
@@ -761,9 +914,8 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
  /*-- 0x12D --*/
 	/*-----------*/
 
-	if (bldCVMod & CV_MOD_12D)
+	if (rawDatCVsstSegMap)
 	{
-	 rawDatCVsstSegMap= BuildCVsstSegMap();
 	 AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstSegMap, subSecDirCV, 0x012D, 0xFFFF);
 	 subSecDirEntNum++;
 	 if (BytesTillAlignEnd(rawDatCV-> GetLength(), sizeof(DWORD)))
@@ -774,9 +926,8 @@ BOOL CExeFileDebugSection::BuildCVRawDataBlock(CMyMapStringToOb *dllImpLstLst, C
  /*** 0x133 ***/
 	/*************/
 
-	if (bldCVMod & CV_MOD_133)
+	if (rawDatCVsstFilInd)
 	{
-		rawDatCVsstFilInd= BuildCVsstFileIndex(obFilLst);
 		AppandCVModAndDirectoryToCVModule(rawDatCV, rawDatCVsstFilInd, subSecDirCV, 0x0133, 0xFFFF);
 		subSecDirEntNum++;
 		if (BytesTillAlignEnd(rawDatCV-> GetLength(), sizeof(DWORD)))
@@ -946,7 +1097,8 @@ BOOL CExeFileDebugSection::ResRel(CDWordArray *relLst, DWORD	imBas)
 /*** Erstellen des CV sstModules (0x120) **********************************************************/
 /**************************************************************************************************/
 
-CMyMemFile *CExeFileDebugSection::BuildCVsstModule(CMyObList *obFilLst, CExeFile *actExeFil, CMyMapStringToOb *dllImpLstLst)
+CMyMemFile *CExeFileDebugSection::BuildCVsstModule(CMyObList *obFilLst, CExeFile *actExeFil, CMyMapStringToOb *dllImpLstLst,
+																																										myCVModWork *modWork)
 {
 	CExeFileTextSection			*actTxtSec;
  CExeFileDataSection			*actDatSec;
@@ -956,29 +1108,23 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstModule(CMyObList *obFilLst, CExeFile
 	mySstModule																	sstModEnt;
 	mySstModuleSegInfo										sstModEntSegInf;
 			
-	CSectionFragmentEntry *actSecFrgEnt;
 	CDllExportEntry							*actDllExpEnt;
 	CDllExportEntry							*actSpeDllExpEnt;
 	
 	CObjFile														*actObjFil;
 	CObjFile														*hndObjFil;
+	CObjFile														*modObjFil;
 		
 	CMyMapStringToOb						*actDllExpLst;
-	CMyMapStringToOb						*secFrgEntLst;
-	CMyObList													*secFrgObjLst;
- 
 	CMyMemFile												*rawDatCVsstMod;
+	CMyMemFile												*rawDatSstModEnt;
 	LPCTSTR															dllEntNam;
 	LPCTSTR															dllNam;
 
-	POSITION secEntPos;
-	POSITION secFrgObjPos;
-	
 	POSITION objFilLstPos;
 	POSITION dllLstPos;
 	POSITION dllLstEntPos;
 
-	BOOL		sstModEntWritten;
 	BOOL		speDllEntWritten;
 	BOOL		nulTnkDatWritten;
 
@@ -994,7 +1140,7 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstModule(CMyObList *obFilLst, CExeFile
 	char 		*nulImpDes= "__NULL_IMPORT_DESCRIPTOR";
 	char 		*nulTnkDat= "_NULL_THUNK_DATA";
 
-	char		*secEntNam;
+	BYTE		*datBuf;
 
 
 	actTxtSec= actExeFil-> textSec;
@@ -1049,83 +1195,21 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstModule(CMyObList *obFilLst, CExeFile
 			
 			if (hndObjFil)
 			{
-				if (exeFilSecFrgLst-> Lookup(hndObjFil-> objFilNam, (CObject *&) secFrgEntLst))
+				rawDatSstModEnt= GiveCVsstModuleEntry(hndObjFil, &modObjFil, modWork);
+				if (rawDatSstModEnt)
 				{
-					sstModEnt.conCodSegNum= 0;
-					
-					// Bestimmen der Anzahl der sstModule SegInfo Eintrge
-			
-					sstModEnt.conCodSegNum= 0;
-					secEntPos= secFrgEntLst-> GetStartPosition();
-			
-					while(secEntPos)
-					{
-						secFrgEntLst-> GetNextAssoc(secEntPos, secEntNam, (CObject *&) secFrgObjLst);			
-				
-						// Die Eintrge der .text Sektion werden zu einem Block zusammengefat, whrend bei 
-						// Eintrgen der Datensektionen fr jeden Objektmodulblock ein Eintrag erstellt wird.
-								
-						if (!strcmp(secEntNam, ".text"))
-							sstModEnt.conCodSegNum++;
-						else
-							sstModEnt.conCodSegNum+= secFrgObjLst-> GetCount();
-					}
-			
-					// Bestimmen der sstModul SegInfo Eintragsdaten
-
-					secEntPos= secFrgEntLst-> GetStartPosition();
-					sstModEntWritten= FALSE;
-		
-					while(secEntPos)
-					{
-						secFrgEntLst-> GetNextAssoc(secEntPos, secEntNam, (CObject *&) secFrgObjLst);						
-		
-						// Annahme: Es mu immer zumindest ein Element in der Liste sein.
-				
-						secFrgObjPos= secFrgObjLst-> GetHeadPosition();
-						actSecFrgEnt= (CSectionFragmentEntry *) secFrgObjLst-> GetAt(secFrgObjPos);
-
-						// Die Eintrge der .text Sektion werden zu einem Block zusammengefat, whrend bei 
-						// Eintrgen der Datensektionen fr jeden Objektmodulblock ein Eintrag erstellt wird.
-								
-						if (!sstModEntWritten)
-						{
-							subDirEnt.entOff= rawDatCVsstMod-> GetPosition();				
-							sstModEnt.sstLibSubSecInd= actSecFrgEnt-> secFrgObjFil-> libFilInd;
-							rawDatCVsstMod-> Write(&sstModEnt, sizeof(mySstModule));
-							sstModEntWritten= TRUE;
-						}
-
-						while(secFrgObjPos)
-						{
-							actSecFrgEnt= (CSectionFragmentEntry *) secFrgObjLst-> GetNext(secFrgObjPos);
-							sstModEntSegInf.seg= actSecFrgEnt-> actExeSec-> secNum;
-							sstModEntSegInf.codOff= actSecFrgEnt-> secFrgOff;
-							sstModEntSegInf.codLen= actSecFrgEnt-> rawDatSiz + BytesTillAlignEnd(actSecFrgEnt-> rawDatSiz, actSecFrgEnt-> secFrgAln);
-					
-							if (!strcmp(secEntNam, ".text"))
-							{
-								while(secFrgObjPos)
-								{
-									actSecFrgEnt= (CSectionFragmentEntry *) secFrgObjLst-> GetNext(secFrgObjPos);
-									sstModEntSegInf.codLen+= actSecFrgEnt-> rawDatSiz + BytesTillAlignEnd(actSecFrgEnt-> rawDatSiz, actSecFrgEnt-> secFrgAln);
-								}
-							}
-					
-							rawDatCVsstMod-> Write(&sstModEntSegInf, sizeof(mySstModuleSegInfo));
-						}
-					}
-
-					filNamLen= (BYTE )strlen(hndObjFil-> objFilNam);
-					rawDatCVsstMod-> Write(&filNamLen, sizeof(BYTE));
-					rawDatCVsstMod-> Write(hndObjFil-> objFilNam, filNamLen);
-			
-					subDirEnt.bytNum= rawDatCVsstMod-> GetLength() - subDirEnt.entOff;
+					subDirEnt.entOff= rawDatCVsstMod-> GetPosition();
+					subDirEnt.bytNum= rawDatSstModEnt-> GetLength();
+					rawDatSstModEnt-> SeekToBegin();
+					datBuf= (BYTE *) rawDatSstModEnt-> ReadWithoutMemcpy(subDirEnt.bytNum);
+					rawDatCVsstMod-> Write(datBuf, subDirEnt.bytNum);
+					FreeCMyMemFile(rawDatSstModEnt);
+					delete rawDatSstModEnt;
 			
 					if (BytesTillAlignEnd(rawDatCVsstMod-> GetPosition(), sizeof(DWORD)))
 						rawDatCVsstMod-> Write(chrBuf00, BytesTillAlignEnd(rawDatCVsstMod-> GetPosition(), sizeof(DWORD)));
 
-					actSecFrgEnt-> secFrgObjFil-> cvModInd= ++subDirEnt.modInd;
+					modObjFil-> cvModInd= ++subDirEnt.modInd;
 					subSecDirCV-> Write(&subDirEnt, 0x0C);
 					subDirEnt.entOff= rawDatCVsstMod-> GetPosition();
 				}
@@ -1325,11 +1409,139 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstModule(CMyObList *obFilLst, CExeFile
 }
 
 /**************************************************************************************************/
-/*** Erstellen des CV sstAlign Sym Moduls (0x125) *************************************************/
+/*** Erstellen des sstModule Eintrags einer Objektdatei ohne Fllbytes. In modObjFil wird die   ***/
+/*** Objektdatei zurckgegeben, die den CV Modulindex erhlt.                                   ***/
 /**************************************************************************************************/
 
-CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
+CMyMemFile *CExeFileDebugSection::BuildCVsstModuleEntry(CObjFile *aObjFil, CObjFile **modObjFil)
+{
+	mySstModule										sstModEnt;
+	mySstModuleSegInfo				sstModEntSegInf;
+			
+	CSectionFragmentEntry *actSecFrgEnt;
+	CMyMapStringToOb						*secFrgEntLst;
+	CMyObList													*secFrgObjLst;
+	CMyMemFile												*rawDatSstModEnt;
+
+	POSITION secEntPos;
+	POSITION secFrgObjPos;
+
+	BOOL		sstModEntWritten;
+	BYTE		filNamLen;
+	char		*secEntNam;
+
+	*modObjFil= aObjFil;
+
+	if (!exeFilSecFrgLst-> Lookup(aObjFil-> objFilNam, (CObject *&) secFrgEntLst))
+		return NULL;
+
+	rawDatSstModEnt= new CMyMemFile();
+
+	sstModEnt.ovlNum= 0x0000;
+	sstModEnt.sty= 0x5643; // => "CV"
+
+	sstModEntSegInf.pad= 0;
+
+	// Bestimmen der Anzahl der sstModule SegInfo Eintrge
+			
+	sstModEnt.conCodSegNum= 0;
+	secEntPos= secFrgEntLst-> GetStartPosition();
+			
+	while(secEntPos)
+	{
+		secFrgEntLst-> GetNextAssoc(secEntPos, secEntNam, (CObject *&) secFrgObjLst);			
+				
+		// Die Eintrge der .text Sektion werden zu einem Block zusammengefat, whrend bei 
+		// Eintrgen der Datensektionen fr jeden Objektmodulblock ein Eintrag erstellt wird.
+								
+		if (!strcmp(secEntNam, ".text"))
+			sstModEnt.conCodSegNum++;
+		else
+			sstModEnt.conCodSegNum+= secFrgObjLst-> GetCount();
+	}
+			
+	// Bestimmen der sstModul SegInfo Eintragsdaten
+
+	secEntPos= secFrgEntLst-> GetStartPosition();
+	sstModEntWritten= FALSE;
+		
+	while(secEntPos)
+	{
+		secFrgEntLst-> GetNextAssoc(secEntPos, secEntNam, (CObject *&) secFrgObjLst);						
+		
+		// Annahme: Es mu immer zumindest ein Element in der Liste sein.
+				
+		secFrgObjPos= secFrgObjLst-> GetHeadPosition();
+		actSecFrgEnt= (CSectionFragmentEntry *) secFrgObjLst-> GetAt(secFrgObjPos);
+
+		if (!sstModEntWritten)
+		{
+			sstModEnt.sstLibSubSecInd= actSecFrgEnt-> secFrgObjFil-> libFilInd;
+			rawDatSstModEnt-> Write(&sstModEnt, sizeof(mySstModule));
+			sstModEntWritten= TRUE;
+		}
+
+		while(secFrgObjPos)
+		{
+			actSecFrgEnt= (CSectionFragmentEntry *) secFrgObjLst-> GetNext(secFrgObjPos);
+			sstModEntSegInf.seg= actSecFrgEnt-> actExeSec-> secNum;
+			sstModEntSegInf.codOff= actSecFrgEnt-> secFrgOff;
+			sstModEntSegInf.codLen= actSecFrgEnt-> rawDatSiz + BytesTillAlignEnd(actSecFrgEnt-> rawDatSiz, actSecFrgEnt-> secFrgAln);
+					
+			if (!strcmp(secEntNam, ".text"))
+			{
+				while(secFrgObjPos)
+				{
+					actSecFrgEnt= (CSectionFragmentEntry *) secFrgObjLst-> GetNext(secFrgObjPos);
+					sstModEntSegInf.codLen+= actSecFrgEnt-> rawDatSiz + BytesTillAlignEnd(actSecFrgEnt-> rawDatSiz, actSecFrgEnt-> secFrgAln);
+				}
+			}
+					
+			rawDatSstModEnt-> Write(&sstModEntSegInf, sizeof(mySstModuleSegInfo));
+		}
+
+		*modObjFil= actSecFrgEnt-> secFrgObjFil;
+	}
+
+	filNamLen= (BYTE )strlen(aObjFil-> objFilNam);
+	rawDatSstModEnt-> Write(&filNamLen, sizeof(BYTE));
+	rawDatSstModEnt-> Write(aObjFil-> objFilNam, filNamLen);
+
+	return rawDatSstModEnt;
+}
+
+/**************************************************************************************************/
+/*** Rckgabe des sstModule Eintrags einer Objektdatei. Wurde er bereits parallel erstellt,     ***/
+/*** wird er aus dem Auftrag genommen, sonst wird er hier erstellt.                             ***/
+/**************************************************************************************************/
+
+CMyMemFile *CExeFileDebugSection::GiveCVsstModuleEntry(CObjFile *aObjFil, CObjFile **modObjFil, myCVModWork *modWork)
+{
+	myCVModJob *actJob;
+	CMyMemFile *rawDatSstModEnt;
+
+	actJob= GiveCVModJob(aObjFil, CV_MOD_120, modWork);
+	if (!actJob)
+		return BuildCVsstModuleEntry(aObjFil, modObjFil);
+
+	*modObjFil= actJob-> sstModObjFil;
+	rawDatSstModEnt= actJob-> sstModRawDat;
+	actJob-> sstModRawDat= NULL;
+
+	return rawDatSstModEnt;
+}
+
+/**************************************************************************************************/
+/*** Erstellen der Teile des CV sstAlign Sym Moduls (0x125), die nur von der Objektdatei ab-    ***/
+/*** hngen. Die Typindizes bleiben die der Objektdatei, jeder Verweis wird in typFixRawDat     ***/
+/*** festgehalten. UDT, GDATA und GPROC Records fr die globalen Listen landen in gloRecRawDat. ***/
+/*** Mit parWrk (Aufruf aus einem Thread) wird eine Objektdatei, deren Debugformat umgesetzt    ***/
+/*** werden mu, nicht bearbeitet und FALSE zurckgegeben.                                      ***/
+/**************************************************************************************************/
+
+BOOL CExeFileDebugSection::BuildCVsstAlignSymParts(myCVModJob *aJob, BOOL parWrk)
 {
+	CObjFile														*aObjFil;
  CObjFileSection       *actDebObjFilSecS;
 	CObjFileSection							*actRelDbgSec;
 	CSectionFragmentEntry *actDebSecS;
@@ -1341,15 +1553,15 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 	CMyMemFile *retRawDatSstAlnSym;
 	CMyMemFile	*rawDatSecS;
 	CMyMemFile	*rawDatSecT;
-	CMyMemFile *usrDefTypBuf;
- CMyMemFile *usrDefAdrSrtTabBuf;
+	CMyMemFile *typFixRawDat;
+	CMyMemFile *gloRecRawDat;
 
 	mySstGloTypInfRec	*aSstGloTypInf;
 	CPtrArray									*objFilTypArr;
 	DWORD													objFilTypInd;	
 	WORD														sstGloTypSymLen;
+	myCVTypFix								typFix;
 	
- myProcedureReference prcRef;
 	myProcedureStartCV4  gloPrcSrtCV4;
 	myProcedureStartCV5		gloPrcSrtCV5;
 	mySymbolRecord  	    symRecHdr;
@@ -1367,34 +1579,33 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 
 	DWORD actFilPos= 0;
 	DWORD actRawDatPos;
- DWORD adrSrtTabActOff= 0;
- DWORD adrSrtTabActFilPos= 0;
+	DWORD recBdyPos;				// Beginn des Symbolrecords nach dem Header in der .debug$S Sektion
+	DWORD typFldPos;				// Position des Typindexes im Symbolrecord
+	DWORD alnRecPos;
+	DWORD gloRecPos;
 	DWORD bytBufLen;
 	WORD		staSrhSec;
 	WORD  bytTilAln;
- WORD  refLen;
 	WORD		scpLev;
 	WORD		symTypW;
 
 	BYTE  *bytBuf;
 	BYTE  *namBuf;
 
- POSITION      usrDefNamPos;
 	BOOL										chkVerSgn;
 	BOOL										retMemFil;
 	BOOL										insStrSrc;
 	BOOL										chgDbgFor;
-	char          *usrDefNam;
  BYTE          usrDefNamLen;
 	BYTE										msgBuf[256];
 
 	int i;
 
+	aObjFil= aJob-> objFil;
 	chkVerSgn= TRUE;
 	insStrSrc= FALSE;
 	retMemFil= FALSE;
 	actRawDatPos= 0;
-	rawDatSstAlnSym= new CMyMemFile();
 
 	/*** berprfen welches Debugformat (CV40/CV50) vorhanden ist ***/
 
@@ -1422,6 +1633,7 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 			if (!strcmp(actDebObjFilSecS-> secNam, ".debug$S"))
 			{
 				rawDatSecS= actDebObjFilSecS-> actFrgEnt-> rawDat;
+				rawDatSecS-> SeekToBegin();
 				rawDatSecS-> Read(&verSgn, sizeof(DWORD));
 				if (verSgn != verSgnCV)
 					chgDbgFor= TRUE;
@@ -1432,6 +1644,12 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 		}
 	}
 
+	// Das Umsetzen des Debugformats meldet sich ber wrtCV4ToCV5Msg/wrtCV5ToCV4Msg und trgt in
+	// chgDbgTSecLst ein, daher nur im Hauptthread
+
+	if (chgDbgFor && parWrk)
+		return FALSE;
+
 	if (chgDbgFor)		// ndern des vorhandenen Debugformats
 	{
 		if (aObjFil-> dbgTSec)  // Wenn .debug$T Sektion vorhanden -> Format ndern
@@ -1482,32 +1700,24 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 				aSstGloTypInf-> typRefNmb= 0x0;
 				aSstGloTypInf-> typRawDat= (BYTE *) rawDatSecT-> ReadWithoutMemcpy(sstGloTypSymLen);
 				aSstGloTypInf-> sstGloTypInd= 0xFFFFFFFF;
+				aSstGloTypInf-> typMapSta= TYP_MAP_NEW;
 
 				objFilTypArr-> SetAtGrow(objFilTypInd, aSstGloTypInf);
 				objFilTypInd++;
 			}
 
-			/*** Neuzuordnung der Typindizes der selbstdefinierten Typen ***/
-
-			rawDatSecT-> SeekToBegin();
-			rawDatSecT-> Read(&verSgn, sizeof(DWORD));
-
-			while(rawDatSecT-> Read(&symRecHdr, sizeof(mySymbolRecord)))
-			{
-				actRawDatPos= rawDatSecT-> GetPosition();
-				
-				if (verSgn == VER_SGN_CV4)
-					CalculateTypeIndizes40(symRecHdr.symTyp, symRecHdr.recLen, rawDatSecT, (WORD )objFilTypInd, objFilTypArr, aObjFil);
-				else
-					CalculateTypeIndizes50(symRecHdr.symTyp, symRecHdr.recLen, rawDatSecT, objFilTypInd, objFilTypArr, aObjFil);
+			/*** Neuzuordnung der Typindizes beim ersten Verweis, siehe MergeCVsstAlignSym ***/
 
-				rawDatSecT-> Seek(actRawDatPos + symRecHdr.recLen - sizeof(WORD), CFile::begin);
-			}
+			aJob-> rawDatSecT= rawDatSecT;
+			aJob-> typVerSgn= verSgn;
 		}
 	}
 
-	if (!aObjFil-> sstGloTypRawDat)
-		aObjFil-> sstGloTypRawDat= new CMyMemFile();
+	aJob-> typFixRawDat= new CMyMemFile();
+	aJob-> gloRecRawDat= new CMyMemFile();
+	typFixRawDat= aJob-> typFixRawDat;
+	gloRecRawDat= aJob-> gloRecRawDat;
+	rawDatSstAlnSym= new CMyMemFile();
 
 	/* Initialisieren des Start Search Records - Nicht bei Funktionen aus DLL' s */
 	
@@ -1619,6 +1829,8 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 						/*** berprfe ob selbstdefinierter Typ vorhanden -> Neuzuordnung desselben ***/
 					
 						actRawDatPos= rawDatSecS-> GetPosition();
+						recBdyPos= actRawDatPos;
+						typFix.typSiz= 0;
 
 						if (verSgn == VER_SGN_CV4)
 						{
@@ -1642,14 +1854,10 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 
 								case 0x004:	/* User-defined Type */
 							
-										actFilPos= rawDatSecS-> GetPosition();
+										typFldPos= rawDatSecS-> GetPosition();
 										rawDatSecS-> Read(&symTypW, sizeof(WORD));
-										symTypW= SetPESymbolType40(symTypW, (WORD )objFilTypInd, objFilTypArr, aObjFil-> objFilNam);
-										if (symTypW)
-										{
-											rawDatSecS-> Seek(actFilPos, CFile::begin);
-											rawDatSecS-> Write(&symTypW, sizeof(WORD));							
-										}
+										typFix.objTypInd= symTypW;
+										typFix.typSiz= sizeof(WORD);
 															
 									break;
 
@@ -1657,14 +1865,10 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 								case 0x0205:	/* Global Procedure Start 16:32 */
 									
 										rawDatSecS-> Seek(7 * sizeof(DWORD) + sizeof(WORD), CFile::current);
-										actFilPos= rawDatSecS-> GetPosition();
+										typFldPos= rawDatSecS-> GetPosition();
 										rawDatSecS-> Read(&symTypW, sizeof(WORD));
-										symTypW= SetPESymbolType40(symTypW, (WORD )objFilTypInd, objFilTypArr, aObjFil-> objFilNam);
-										if (symTypW)
-										{
-											rawDatSecS-> Seek(actFilPos, CFile::begin);
-											rawDatSecS-> Write(&symTypW, sizeof(WORD));							
-										}
+										typFix.objTypInd= symTypW;
+										typFix.typSiz= sizeof(WORD);
 
 									break;
 						
@@ -1693,14 +1897,10 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 								case 0x1008:	/* Global Data Symbol 16:32 */
 								case 0x1009: /* Public Symobl	16:32 */
 							
-										actFilPos= rawDatSecS-> GetPosition();
+										typFldPos= rawDatSecS-> GetPosition();
 										rawDatSecS-> Read(&symTypDW, sizeof(DWORD));
-										symTypDW= SetPESymbolType50(symTypDW, objFilTypInd, objFilTypArr, aObjFil-> objFilNam);
-										if (symTypDW)
-										{
-											rawDatSecS-> Seek(actFilPos, CFile::begin);
-											rawDatSecS-> Write(&symTypDW, sizeof(DWORD));							
-										}
+										typFix.objTypInd= symTypDW;
+										typFix.typSiz= sizeof(DWORD);
 															
 									break;
 
@@ -1708,14 +1908,10 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 								case 0x100B:	/* Global Procedure Start 16:32 */
 
 										rawDatSecS-> Seek(6 * sizeof(DWORD), CFile::current);
-										actFilPos= rawDatSecS-> GetPosition();
+										typFldPos= rawDatSecS-> GetPosition();
 										rawDatSecS-> Read(&symTypDW, sizeof(DWORD));
-										symTypDW= SetPESymbolType50(symTypDW, objFilTypInd, objFilTypArr, aObjFil-> objFilNam);
-										if (symTypDW)
-										{
-											rawDatSecS-> Seek(actFilPos, CFile::begin);
-											rawDatSecS-> Write(&symTypDW, sizeof(DWORD));							
-										}
+										typFix.objTypInd= symTypDW;
+										typFix.typSiz= sizeof(DWORD);
 
 									break;
 
@@ -1727,6 +1923,9 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 					
 						rawDatSecS-> Seek(actRawDatPos, CFile::begin);
 
+						alnRecPos= rawDatSstAlnSym-> GetPosition();
+						gloRecPos= gloRecRawDat-> GetPosition();
+
 						/*** Verarbeiten der Symbolinformation ***/
 
 						switch (symRecHdr.symTyp)
@@ -1748,48 +1947,18 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 						
 							case 0x0004:	/* User-defined Type (CV4.0) wird nicht in die sstAlignSym aufgenommen */
 							case 0x1003:	/* User-defined Type (CV5.0) */
-									actRawDatPos= rawDatSecS-> GetPosition();
-									aObjFil-> sstGloTypRawDat-> Write(&symRecHdr, sizeof(mySymbolRecord));
+									gloRecRawDat-> Write(&recBdyPos, sizeof(DWORD));
+									gloRecRawDat-> Write(&symRecHdr, sizeof(mySymbolRecord));
 									bytBuf= (BYTE *) rawDatSecS-> ReadWithoutMemcpy(symRecHdr.recLen - sizeof(WORD));       
-									aObjFil-> sstGloTypRawDat-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));  
-									rawDatSecS-> Seek(actRawDatPos, CFile::begin);							
-								
-									bytBuf= (BYTE *) malloc(symRecHdr.recLen - sizeof(WORD));
-			      actFilPos= rawDatSecS-> GetPosition();
-									rawDatSecS-> Read(bytBuf, symRecHdr.recLen - sizeof(WORD));
-			      rawDatSecS-> Seek(actFilPos + sizeof(WORD), CFile::begin);
+									gloRecRawDat-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));  
+
+									// Weiterlesen hinter dem Namen des Typs
+									rawDatSecS-> Seek(recBdyPos + sizeof(WORD), CFile::begin);
 									if (symRecHdr.symTyp == 0x1003)
 										rawDatSecS-> Seek(sizeof(WORD), CFile::current);
+									rawDatSecS-> Read(&usrDefNamLen, sizeof(BYTE));
+									rawDatSecS-> Seek(usrDefNamLen, CFile::current);
 
-			      rawDatSecS-> Read(&usrDefNamLen, sizeof(BYTE));
-	       
-									usrDefNam= (char *) malloc(usrDefNamLen + 1);
-						   memset(usrDefNam, 0x00, usrDefNamLen + 1);       
-					    rawDatSecS-> Read(usrDefNam, usrDefNamLen);
-       
-				     usrDefNamPos= usrDefNamLst-> FindString(usrDefNam);
-			      if (!usrDefNamPos) // Keine doppelten Eintrge zulassen
-			      {      
-						    usrDefNamLst-> AddTail(usrDefNam);
-					     usrDefNamPos= usrDefNamLst-> FindString(usrDefNam);
-									
-										/* Erstellen des Eintrags in die Liste der Selbst definierten Typen */
-									
-										usrDefTypBuf= new CMyMemFile();
-				      bytTilAln= (WORD )BytesTillAlignEnd(symRecHdr.recLen + sizeof(WORD), sizeof(DWORD));
-				      refLen= (WORD )(symRecHdr.recLen + bytTilAln);
-					 				usrDefTypBuf-> Write(&refLen, sizeof(WORD));
-									 usrDefTypBuf-> Write(&symRecHdr.symTyp, sizeof(WORD));
-								  usrDefTypBuf-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));
-							   usrDefTypBuf-> Write(chrBuf00, bytTilAln);
-									 sstGloSymLst-> AddTail(usrDefTypBuf);
-						    adrSrtTabActFilPos+= usrDefTypBuf-> GetLength();
-							  }
-									else
-										free(usrDefNam);
-
-									free(bytBuf);									
-								
 									actRawDatPos-= sizeof(DWORD); // Platz des Symbol Records wird wieder abgezogen
 								break;
 						
@@ -1841,69 +2010,24 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 						
 							case 0x0202:	/* Global Data Symbol 16:32 (CV4.0) */
 							case 0x1008:	/* Global Data Symbol 16:32 (CV5.0) */
-								
-									DWORD *sTypAsPtr;	
-									DWORD sTypBuf;
-									DWORD sTypDW;
-									WORD		sTypW;
-									BOOL		ignTyp;
-									BYTE		nBuf[256];
-									BYTE		namLen;
-
-									ignTyp= FALSE;
-																
-									actFilPos= rawDatSecS-> GetPosition();
-								
-									if (symRecHdr.symTyp == 0x1008)
-									{
-										rawDatSecS-> Read(&sTypDW, sizeof(DWORD));
-										rawDatSecS-> Seek(sizeof(DWORD) + sizeof(WORD), CFile::current);		
-									}
-									else
-									{
-										rawDatSecS-> Seek(sizeof(DWORD), CFile::current);
-										rawDatSecS-> Read(&sTypW, sizeof(WORD));
-										rawDatSecS-> Seek(sizeof(WORD), CFile::current);
-									}
-								
-									memset(&nBuf, 0x00, 256);
-									rawDatSecS-> Read(&namLen, sizeof(BYTE));
-									rawDatSecS-> Read(&nBuf, namLen);
-
-									namBuf= (BYTE *) malloc(namLen + 2);
-									strcpy((char *)namBuf, "_");										// Symbole haben ein zustzliches "_" in der Symboltabelle
-									strcat((char *)namBuf, (char *)nBuf);
-
-
-									if (symRecHdr.symTyp == 0x1008)
-										sTypAsPtr= (DWORD *)sTypDW;
-									else
-									{
-										sTypBuf= 0;
-										sTypBuf+= sTypW;
-										sTypAsPtr= (DWORD *)sTypBuf;
-									}
-
-									if (gloDatSymLst-> Lookup((char *)namBuf, (void *&)sTypAsPtr))
-										free(namBuf);
-									else
-										gloDatSymLst-> SetAt((char *)namBuf, sTypAsPtr);
 									
-									rawDatSecS-> Seek(actFilPos, CFile::begin);
-								
+									// Der Eintrag in gloDatSymLst braucht den globalen Typindex, siehe MergeCVsstAlignSym
+									gloRecRawDat-> Write(&recBdyPos, sizeof(DWORD));
+									gloRecRawDat-> Write(&symRecHdr, sizeof(mySymbolRecord));
+									bytBuf= (BYTE *) rawDatSecS-> ReadWithoutMemcpy(symRecHdr.recLen - sizeof(WORD));
+									gloRecRawDat-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));
+									rawDatSecS-> Seek(recBdyPos, CFile::begin);
+									
 								 bytBuf= (BYTE *) malloc(symRecHdr.recLen - sizeof(WORD));
 									bytTilAln= (WORD )BytesTillAlignEnd(symRecHdr.recLen + sizeof(WORD), sizeof(DWORD));
 									rawDatSecS-> Read(bytBuf, symRecHdr.recLen - sizeof(WORD));       
-									if (!ignTyp)
-									{
-										symRecHdr.recLen+= (WORD )bytTilAln;
-										rawDatSstAlnSym-> Write(&symRecHdr, sizeof(mySymbolRecord));
-										rawDatSstAlnSym-> Write(bytBuf, symRecHdr.recLen - bytTilAln - sizeof(WORD));
-										rawDatSstAlnSym-> Write(chrBuf00, bytTilAln);
-										actRawDatPos+= symRecHdr.recLen + sizeof(WORD);
-										retMemFil= TRUE;
-										insStrSrc= TRUE;
-									}
+									symRecHdr.recLen+= (WORD )bytTilAln;
+									rawDatSstAlnSym-> Write(&symRecHdr, sizeof(mySymbolRecord));
+									rawDatSstAlnSym-> Write(bytBuf, symRecHdr.recLen - bytTilAln - sizeof(WORD));
+									rawDatSstAlnSym-> Write(chrBuf00, bytTilAln);
+									actRawDatPos+= symRecHdr.recLen + sizeof(WORD);
+									retMemFil= TRUE;
+									insStrSrc= TRUE;
 									free(bytBuf);
 							
 							 break;
@@ -1941,9 +2065,10 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 							case 0x100B:	/* Global Procedure Start 16:32 (CV5.0) */
 						
 									actRawDatPos= rawDatSecS-> GetPosition();
-									aObjFil-> sstGloTypRawDat-> Write(&symRecHdr, sizeof(mySymbolRecord));
+									gloRecRawDat-> Write(&actRawDatPos, sizeof(DWORD));
+									gloRecRawDat-> Write(&symRecHdr, sizeof(mySymbolRecord));
 									bytBuf= (BYTE *) rawDatSecS-> ReadWithoutMemcpy(symRecHdr.recLen - sizeof(WORD));       
-									aObjFil-> sstGloTypRawDat-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));  
+									gloRecRawDat-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));  
 									rawDatSecS-> Seek(actRawDatPos, CFile::begin);							
 
 									if (symRecHdr.symTyp == 0x0205)
@@ -1961,35 +2086,6 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 										rawDatSecS-> Read(namBuf, symRecHdr.recLen - sizeof(WORD) - PRO_STA_CV5_LEN);																	
 									}
 								
-									/* Erstellen des Eintrags in die Liste der Selbst definierten Typen */
-       	
-									usrDefTypBuf= new CMyMemFile();
-									prcRef.refLen= 0x0E;
-					    prcRef.ind= 0x0400;
-									namLen= (BYTE ) namBuf[0];
-					    usrDefNam= (char *) malloc(namLen + 1);
-					    memset(usrDefNam, 0x00, namLen + 1);
-						   usrDefNam= (char *) strncpy(usrDefNam,(char *)(namBuf + 1), namLen);
-							  prcRef.chkSum= GiveTableHash(usrDefNam);
-								 free(usrDefNam);
-					    prcRef.off= actRawDatPos;
-									if (symRecHdr.symTyp == 0x0205)
-										prcRef.mod= gloPrcSrtCV4.seg;
-									else
-										prcRef.mod= gloPrcSrtCV5.seg;
-							  prcRef.alnSgn= 0x00;       
-							  usrDefTypBuf-> Write(&prcRef, sizeof(myProcedureReference));
-							  sstGloSymLst-> AddTail(usrDefTypBuf);
-							  usrDefAdrSrtTabBuf= new CMyMemFile();
-							  usrDefAdrSrtTabBuf-> Write(&adrSrtTabActFilPos, sizeof(DWORD));
-							  usrDefAdrSrtTabBuf-> Write(&adrSrtTabActOff, sizeof(DWORD));
-									if (symRecHdr.symTyp == 0x0205)
-										adrSrtTabActOff+= gloPrcSrtCV4.prcLen;
-									else
-										adrSrtTabActOff+= gloPrcSrtCV5.prcLen;
-						   sstGloSymAdrSrtTabLst-> AddTail(usrDefAdrSrtTabBuf);
-						   adrSrtTabActFilPos+= usrDefTypBuf-> GetLength();
-								
 									actRawDatPos= rawDatSstAlnSym-> GetPosition();
 								
 									if (!fstStaSrhSymOff)
@@ -2060,6 +2156,19 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 																WriteMessageToPow(WRN_MSGD_NO_SYM_IND, (char *)msgBuf, aObjFil-> objFilNam);
 																rawDatSecS-> Seek(symRecHdr.recLen - sizeof(WORD), CFile::current);
 						}
+
+						/*** Verweis auf einen Typindex festhalten, gesetzt wird er in MergeCVsstAlignSym ***/
+
+						if (typFix.typSiz)
+						{
+							typFix.alnSymOff= CV_NO_FIX_OFF;
+							typFix.gloRecOff= CV_NO_FIX_OFF;
+							if (rawDatSstAlnSym-> GetPosition() > alnRecPos)
+								typFix.alnSymOff= alnRecPos + sizeof(mySymbolRecord) + typFldPos - recBdyPos;
+							if (gloRecRawDat-> GetPosition() > gloRecPos)
+								typFix.gloRecOff= gloRecPos + sizeof(DWORD) + sizeof(mySymbolRecord) + typFldPos - recBdyPos;
+							typFixRawDat-> Write(&typFix, sizeof(myCVTypFix));
+						}
 					}
 
 					if (chgDbgFor)	// Freigeben der neu erzeugten Debugsektion
@@ -2087,18 +2196,8 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 		}
 	}
 
-		/*** Freigeben des Speichers der nicht bentigten Typinformation ***/
-
-	for(i= 0; i < (WORD )objFilTypInd; i++)
-	{
-		aSstGloTypInf= (mySstGloTypInfRec *) objFilTypArr-> GetAt(i); 
-		if (!aSstGloTypInf-> typRefNmb)
-			free(aSstGloTypInf);
-	}
-
-	objFilTypArr-> RemoveAll();
-	objFilTypArr-> ~CPtrArray();
-	delete objFilTypArr;
+	aJob-> objFilTypArr= objFilTypArr;
+	aJob-> objFilTypInd= objFilTypInd;
 
 	/* Einfgen des Start Search Records - Nicht bei Funktionen aus DLL' s */
 		
@@ -2122,27 +2221,286 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
 	
 		rawDatSstAlnSym-> ~CMyMemFile();
 		delete (rawDatSstAlnSym);
-		return retRawDatSstAlnSym;
+		aJob-> alnSymRawDat= retRawDatSstAlnSym;
+		aJob-> alnSymShf= retRawDatSstAlnSym-> GetLength() - bytBufLen - sizeof(DWORD);
 	}
-
-	if (!retMemFil)
+	else if (!retMemFil)
 	{
 		rawDatSstAlnSym-> ~CMyMemFile();
 		delete (rawDatSstAlnSym);
-		return NULL;
 	}
+	else
+		aJob-> alnSymRawDat= rawDatSstAlnSym;
+
+	aJob-> donCVMod|= CV_MOD_125;
 	
-	return rawDatSstAlnSym;
+	return TRUE;
 }
 
 /**************************************************************************************************/
-/*** Erstellen des CV sstSrcModule (0x127) ********************************************************/
+/*** Zusammenfhren eines vorab erstellten sstAlign Sym Moduls mit den globalen Daten. Die Typ- ***/
+/*** verweise werden in der Reihenfolge ihres Auftretens auf globale Typindizes umgesetzt und   ***/
+/*** eingetragen, danach werden die UDT, GDATA und GPROC Records in gloDatSymLst, sstGloSymLst  ***/
+/*** und sstGloSymAdrSrtTabLst aufgenommen. Die Aufrufe erfolgen in der Reihenfolge der Module, ***/
+/*** damit sind die globalen Typindizes dieselben wie beim seriellen Erstellen.                 ***/
 /**************************************************************************************************/
 
-CMyMemFile *CExeFileDebugSection::BuildCVsstSrcModule(CObjFile *aObjFil)
+void CExeFileDebugSection::MergeCVsstAlignSym(myCVModJob *aJob)
 {
- DWORD					*basSrcLinOffArr;
-	DWORD					*basSrcFilOffArr;
+	CObjFile			*aObjFil;
+	CMyMemFile *typFixRawDat;
+	CMyMemFile *gloRecRawDat;
+	CMyMemFile *usrDefTypBuf;
+ CMyMemFile *usrDefAdrSrtTabBuf;
+
+	mySstGloTypInfRec		*aSstGloTypInf;
+	myCVTypFix								typFix;
+ myProcedureReference prcRef;
+	myProcedureStartCV4  gloPrcSrtCV4;
+	myProcedureStartCV5		gloPrcSrtCV5;
+	mySymbolRecord  	    symRecHdr;
+
+	DWORD *sTypAsPtr;	
+	DWORD gloTypInd;
+	DWORD recSecSOff;
+ DWORD adrSrtTabActOff= 0;
+ DWORD adrSrtTabActFilPos= 0;
+	WORD  bytTilAln;
+ WORD  refLen;
+	BYTE		*bytBuf;
+	BYTE		*namBuf;
+	BYTE		namLen;
+
+ POSITION      usrDefNamPos;
+	char          *usrDefNam;
+
+	int i;
+
+	aObjFil= aJob-> objFil;
+	typFixRawDat= aJob-> typFixRawDat;
+	gloRecRawDat= aJob-> gloRecRawDat;
+
+	/*** Umsetzen der Typindizes der Objektdatei ***/
+
+	if (aJob-> rawDatSecT)
+	{
+		actRawDatSecT= aJob-> rawDatSecT;
+		actTypObjFil= aObjFil;
+		actTypVerSgn= aJob-> typVerSgn;
+	}
+
+	typFixRawDat-> SeekToBegin();
+	while(typFixRawDat-> Read(&typFix, sizeof(myCVTypFix)))
+	{
+		if (typFix.typSiz == sizeof(WORD))
+			gloTypInd= SetPESymbolType40((WORD )typFix.objTypInd, (WORD )aJob-> objFilTypInd, aJob-> objFilTypArr, aObjFil-> objFilNam);
+		else
+			gloTypInd= SetPESymbolType50(typFix.objTypInd, aJob-> objFilTypInd, aJob-> objFilTypArr, aObjFil-> objFilNam);
+
+		if (!gloTypInd)
+			continue;
+
+		if (aJob-> alnSymRawDat && typFix.alnSymOff != CV_NO_FIX_OFF)
+		{
+			aJob-> alnSymRawDat-> Seek(typFix.alnSymOff + aJob-> alnSymShf, CFile::begin);
+			aJob-> alnSymRawDat-> Write(&gloTypInd, typFix.typSiz);
+		}
+		if (typFix.gloRecOff != CV_NO_FIX_OFF)
+		{
+			gloRecRawDat-> Seek(typFix.gloRecOff, CFile::begin);
+			gloRecRawDat-> Write(&gloTypInd, typFix.typSiz);
+		}
+	}
+
+	/*** Aufnehmen der Records in die globalen Listen ***/
+
+	if (!aObjFil-> sstGloTypRawDat)
+		aObjFil-> sstGloTypRawDat= new CMyMemFile();
+
+	gloRecRawDat-> SeekToBegin();
+	while(gloRecRawDat-> Read(&recSecSOff, sizeof(DWORD)))
+	{
+		gloRecRawDat-> Read(&symRecHdr, sizeof(mySymbolRecord));
+		bytBuf= (BYTE *) gloRecRawDat-> ReadWithoutMemcpy(symRecHdr.recLen - sizeof(WORD));
+
+		switch (symRecHdr.symTyp)
+		{
+			case 0x0004:	/* User-defined Type (CV4.0) */
+			case 0x1003:	/* User-defined Type (CV5.0) */
+					aObjFil-> sstGloTypRawDat-> Write(&symRecHdr, sizeof(mySymbolRecord));
+					aObjFil-> sstGloTypRawDat-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));  
+
+					namBuf= bytBuf + sizeof(WORD);
+					if (symRecHdr.symTyp == 0x1003)
+						namBuf+= sizeof(WORD);
+					namLen= namBuf[0];
+
+					usrDefNam= (char *) malloc(namLen + 1);
+					memset(usrDefNam, 0x00, namLen + 1);       
+					memcpy(usrDefNam, namBuf + 1, namLen);
+
+					usrDefNamPos= usrDefNamLst-> FindString(usrDefNam);
+					if (!usrDefNamPos) // Keine doppelten Eintrge zulassen
+					{      
+						usrDefNamLst-> AddTail(usrDefNam);
+
+						/* Erstellen des Eintrags in die Liste der Selbst definierten Typen */
+
+						usrDefTypBuf= new CMyMemFile();
+						bytTilAln= (WORD )BytesTillAlignEnd(symRecHdr.recLen + sizeof(WORD), sizeof(DWORD));
+						refLen= (WORD )(symRecHdr.recLen + bytTilAln);
+						usrDefTypBuf-> Write(&refLen, sizeof(WORD));
+						usrDefTypBuf-> Write(&symRecHdr.symTyp, sizeof(WORD));
+						usrDefTypBuf-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));
+						usrDefTypBuf-> Write(chrBuf00, bytTilAln);
+						sstGloSymLst-> AddTail(usrDefTypBuf);
+						adrSrtTabActFilPos+= usrDefTypBuf-> GetLength();
+					}
+					else
+						free(usrDefNam);
+				break;
+
+			case 0x0202:	/* Global Data Symbol 16:32 (CV4.0) */
+			case 0x1008:	/* Global Data Symbol 16:32 (CV5.0) */
+					if (symRecHdr.symTyp == 0x1008)
+					{
+						sTypAsPtr= (DWORD *)*(DWORD *)bytBuf;
+						namBuf= bytBuf + 2 * sizeof(DWORD) + sizeof(WORD);
+					}
+					else
+					{
+						sTypAsPtr= (DWORD *)(DWORD )*(WORD *)(bytBuf + sizeof(DWORD));
+						namBuf= bytBuf + sizeof(DWORD) + 2 * sizeof(WORD);
+					}
+
+					namLen= namBuf[0];
+					usrDefNam= (char *) malloc(namLen + 2);
+					strcpy(usrDefNam, "_");										// Symbole haben ein zustzliches "_" in der Symboltabelle
+					strncat(usrDefNam, (char *)(namBuf + 1), namLen);
+
+					if (gloDatSymLst-> Lookup(usrDefNam, (void *&)sTypAsPtr))
+						free(usrDefNam);
+					else
+						gloDatSymLst-> SetAt(usrDefNam, sTypAsPtr);
+				break;
+
+			case 0x0205:	/* Global Procedure Start 16:32	(CV4.0) */
+			case 0x100B:	/* Global Procedure Start 16:32 (CV5.0) */
+					aObjFil-> sstGloTypRawDat-> Write(&symRecHdr, sizeof(mySymbolRecord));
+					aObjFil-> sstGloTypRawDat-> Write(bytBuf, symRecHdr.recLen - sizeof(WORD));  
+
+					if (symRecHdr.symTyp == 0x0205)
+					{
+						memcpy(&gloPrcSrtCV4, bytBuf, PRO_STA_CV4_LEN);
+						namBuf= bytBuf + PRO_STA_CV4_LEN;
+					}
+					else
+					{
+						memcpy(&gloPrcSrtCV5, bytBuf, PRO_STA_CV5_LEN);
+						namBuf= bytBuf + PRO_STA_CV5_LEN;
+					}
+
+					/* Erstellen des Eintrags in die Liste der Selbst definierten Typen */
+
+					usrDefTypBuf= new CMyMemFile();
+					prcRef.refLen= 0x0E;
+					prcRef.ind= 0x0400;
+					namLen= namBuf[0];
+					usrDefNam= (char *) malloc(namLen + 1);
+					memset(usrDefNam, 0x00, namLen + 1);
+					usrDefNam= (char *) strncpy(usrDefNam,(char *)(namBuf + 1), namLen);
+					prcRef.chkSum= GiveTableHash(usrDefNam);
+					free(usrDefNam);
+					prcRef.off= recSecSOff;
+					if (symRecHdr.symTyp == 0x0205)
+						prcRef.mod= gloPrcSrtCV4.seg;
+					else
+						prcRef.mod= gloPrcSrtCV5.seg;
+					prcRef.alnSgn= 0x00;       
+					usrDefTypBuf-> Write(&prcRef, sizeof(myProcedureReference));
+					sstGloSymLst-> AddTail(usrDefTypBuf);
+					usrDefAdrSrtTabBuf= new CMyMemFile();
+					usrDefAdrSrtTabBuf-> Write(&adrSrtTabActFilPos, sizeof(DWORD));
+					usrDefAdrSrtTabBuf-> Write(&adrSrtTabActOff, sizeof(DWORD));
+					if (symRecHdr.symTyp == 0x0205)
+						adrSrtTabActOff+= gloPrcSrtCV4.prcLen;
+					else
+						adrSrtTabActOff+= gloPrcSrtCV5.prcLen;
+					sstGloSymAdrSrtTabLst-> AddTail(usrDefAdrSrtTabBuf);
+					adrSrtTabActFilPos+= usrDefTypBuf-> GetLength();
+				break;
+		}
+	}
+
+	/*** Freigeben des Speichers der nicht bentigten Typinformation ***/
+
+	for(i= 0; i < (WORD )aJob-> objFilTypInd; i++)
+	{
+		aSstGloTypInf= (mySstGloTypInfRec *) aJob-> objFilTypArr-> GetAt(i); 
+		if (aSstGloTypInf-> typMapSta != TYP_MAP_GLO)
+			free(aSstGloTypInf);
+	}
+
+	actRawDatSecT= NULL;
+	actTypObjFil= NULL;
+
+	aJob-> objFilTypArr-> RemoveAll();
+	aJob-> objFilTypArr-> ~CPtrArray();
+	delete aJob-> objFilTypArr;
+	aJob-> objFilTypArr= NULL;
+
+	FreeCMyMemFile(typFixRawDat);
+	delete typFixRawDat;
+	aJob-> typFixRawDat= NULL;
+	FreeCMyMemFile(gloRecRawDat);
+	delete gloRecRawDat;
+	aJob-> gloRecRawDat= NULL;
+}
+
+/**************************************************************************************************/
+/*** Erstellen des CV sstAlign Sym Moduls (0x125) *************************************************/
+/**************************************************************************************************/
+
+CMyMemFile *CExeFileDebugSection::BuildCVsstAlignSym(CObjFile *aObjFil)
+{
+	myCVModJob alnSymJob;
+
+	InitCVModJob(&alnSymJob, aObjFil, CV_MOD_125);
+	BuildCVsstAlignSymParts(&alnSymJob, FALSE);
+	MergeCVsstAlignSym(&alnSymJob);
+
+	return alnSymJob.alnSymRawDat;
+}
+
+/**************************************************************************************************/
+/*** Rckgabe des sstAlign Sym Moduls einer Objektdatei. Wurde es bereits parallel vorbereitet, ***/
+/*** wird es hier mit den globalen Daten zusammengefhrt, sonst vollstndig erstellt.           ***/
+/**************************************************************************************************/
+
+CMyMemFile *CExeFileDebugSection::GiveCVsstAlignSym(CObjFile *aObjFil, myCVModWork *modWork)
+{
+	myCVModJob *actJob;
+	CMyMemFile *rawDatSstAlnSym;
+
+	actJob= GiveCVModJob(aObjFil, CV_MOD_125, modWork);
+	if (!actJob)
+		return BuildCVsstAlignSym(aObjFil);
+
+	MergeCVsstAlignSym(actJob);
+	rawDatSstAlnSym= actJob-> alnSymRawDat;
+	actJob-> alnSymRawDat= NULL;
+
+	return rawDatSstAlnSym;
+}
+
+/**************************************************************************************************/
+/*** Erstellen des CV sstSrcModule (0x127) ********************************************************/
+/**************************************************************************************************/
+
+CMyMemFile *CExeFileDebugSection::BuildCVsstSrcModule(CObjFile *aObjFil)
+{
+ DWORD					*basSrcLinOffArr;
+	DWORD					*basSrcFilOffArr;
  staEndRec *staEndOffArr; 
  
  BYTE  srcFilNamLen;
@@ -2344,6 +2702,264 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstSrcModule(CObjFile *aObjFil)
 	return sstSrcModRawDat;
 }
 
+/**************************************************************************************************/
+/*** Vorbereiten, Abholen und Freigeben der Auftrge fr das parallele Erstellen der CV Module. ***/
+/*** Die Threads holen sich ber nxtJob den nchsten Auftrag, beim Zusammensetzen werden die    ***/
+/*** Teile ber modCur, alnCur und srcCur in der Reihenfolge der Auftrge abgeholt.             ***/
+/**************************************************************************************************/
+
+static void InitCVModJob(myCVModJob *aJob, CObjFile *aObjFil, WORD bldCVMod)
+{
+	memset(aJob, 0x00, sizeof(myCVModJob));
+	aJob-> objFil= aObjFil;
+	aJob-> bldCVMod= bldCVMod;
+}
+
+static void FreeCVModJob(myCVModJob *aJob)
+{
+	mySstGloTypInfRec *aSstGloTypInf;
+	int i;
+
+	if (aJob-> sstModRawDat)
+	{
+		FreeCMyMemFile(aJob-> sstModRawDat);
+		delete aJob-> sstModRawDat;
+	}
+	if (aJob-> alnSymRawDat)
+	{
+		FreeCMyMemFile(aJob-> alnSymRawDat);
+		delete aJob-> alnSymRawDat;
+	}
+	if (aJob-> typFixRawDat)
+	{
+		FreeCMyMemFile(aJob-> typFixRawDat);
+		delete aJob-> typFixRawDat;
+	}
+	if (aJob-> gloRecRawDat)
+	{
+		FreeCMyMemFile(aJob-> gloRecRawDat);
+		delete aJob-> gloRecRawDat;
+	}
+	if (aJob-> objFilTypArr)
+	{
+		for(i= 0; i < (WORD )aJob-> objFilTypInd; i++)
+		{
+			aSstGloTypInf= (mySstGloTypInfRec *) aJob-> objFilTypArr-> GetAt(i); 
+			free(aSstGloTypInf);
+		}
+		aJob-> objFilTypArr-> RemoveAll();
+		aJob-> objFilTypArr-> ~CPtrArray();
+		delete aJob-> objFilTypArr;
+	}
+	if (aJob-> srcModRawDat)
+	{
+		FreeCMyMemFile(aJob-> srcModRawDat);
+		delete aJob-> srcModRawDat;
+	}
+	memset(aJob, 0x00, sizeof(myCVModJob));
+}
+
+// Liefert den Auftrag von aObjFil, wenn dessen Teil cVMod fertig ist. Der nchste Auftrag mit
+// diesem Teil mu zu aObjFil gehren, sonst wird der Teil seriell erstellt.
+
+static myCVModJob *GiveCVModJob(CObjFile *aObjFil, WORD cVMod, myCVModWork *modWork)
+{
+	myCVModJob *actJob;
+	LONG							*actCur;
+	LONG							jobInd;
+
+	switch (cVMod)
+	{
+		case CV_MOD_120: actCur= &modWork-> modCur; break;
+		case CV_MOD_125: actCur= &modWork-> alnCur; break;
+		default:									actCur= &modWork-> srcCur;
+	}
+
+	for(jobInd= *actCur; jobInd < modWork-> jobNum; jobInd++)
+	{
+		actJob= &modWork-> jobArr[jobInd];
+		if (actJob-> bldCVMod & cVMod)
+		{
+			if (actJob-> objFil != aObjFil)
+				return NULL;
+			*actCur= jobInd + 1;
+			if (actJob-> donCVMod & cVMod)
+				return actJob;
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+
+unsigned __stdcall CExeFileDebugSection::CVModWorker(void *aWork)
+{
+	myCVModWork *actWork= (myCVModWork *)aWork;
+	myCVModJob  *actJob;
+	LONG        jobInd;
+
+	while((jobInd= InterlockedIncrement(&actWork-> nxtJob) - 1) < actWork-> jobNum)
+	{
+		actJob= &actWork-> jobArr[jobInd];
+
+		if (actJob-> bldCVMod & CV_MOD_120)
+		{
+			actJob-> sstModRawDat= actWork-> dbgSec-> BuildCVsstModuleEntry(actJob-> objFil, &actJob-> sstModObjFil);
+			actJob-> donCVMod|= CV_MOD_120;
+		}
+		if (actJob-> bldCVMod & CV_MOD_125)
+			actWork-> dbgSec-> BuildCVsstAlignSymParts(actJob, TRUE);
+		if (actJob-> bldCVMod & CV_MOD_127)
+		{
+			actJob-> srcModRawDat= actWork-> dbgSec-> BuildCVsstSrcModule(actJob-> objFil);
+			actJob-> donCVMod|= CV_MOD_127;
+		}
+	}
+
+	return 0;
+}
+
+/**************************************************************************************************/
+/*** Paralleles Erstellen der sstModule Eintrge, der sstAlignSym Teile und der sstSrcModule.   ***/
+/*** Die Auftrge werden in der Reihenfolge und unter den Bedingungen angelegt, in der Build-   ***/
+/*** CVsstModule und BuildCVRawDataBlock die Module einfgen: zuerst die Objektdateien, danach  ***/
+/*** die Funktionen aus DLL' s und zuletzt die Module aus den Bibliotheken.                     ***/
+/**************************************************************************************************/
+
+void CExeFileDebugSection::BuildCVModulesParallel(CMyObList *obFilLst, CMyMapStringToOb *dllImpLstLst, WORD bldCVMod,
+																																																		myCVModWork *modWork)
+{
+	CObjFile									*actObjFil;
+	CMyMapStringToOb	*actDllImpLst;	
+	CDllExportEntry			*actDllExpEnt;
+	myCVModJob        *actJob;
+	SYSTEM_INFO 					sysInf;
+	HANDLE      					thrHdl[MAX_CV_MOD_THR];
+	POSITION    					objFilLstPos;
+	POSITION										dllExpLstPos;
+	POSITION										dllLstEntPos;
+	char												*dllNam;
+	char												*dllEntNam;
+
+	DWORD thrNum= 0;
+	DWORD i;
+	LONG  dllEntNum= 0;
+	BOOL		dllFil;
+
+	dllExpLstPos= dllImpLstLst-> GetStartPosition();
+	while(dllExpLstPos)
+	{
+		dllImpLstLst-> GetNextAssoc(dllExpLstPos, dllNam, (CObject *&) actDllImpLst);
+		dllEntNum+= actDllImpLst-> GetCount();
+	}
+
+	modWork-> jobArr= (myCVModJob *) malloc((obFilLst-> GetCount() + dllEntNum + 1) * sizeof(myCVModJob));
+
+	// Objektdateien
+
+	objFilLstPos= obFilLst-> GetHeadPosition();
+	while(objFilLstPos)
+	{
+		actObjFil= (CObjFile *)obFilLst-> GetNext(objFilLstPos);
+		if (actObjFil-> libObjFil)
+			continue;
+
+		actJob= &modWork-> jobArr[modWork-> jobNum++];
+		InitCVModJob(actJob, actObjFil, bldCVMod & (CV_MOD_120 | CV_MOD_125));
+		if ((bldCVMod & CV_MOD_127) && !actObjFil-> incDllFun)
+			actJob-> bldCVMod|= CV_MOD_127;
+	}
+
+	// Funktionen aus DLL' s, die Importmodule stammen aus den Bibliotheken
+
+	if (bldCVMod & CV_MOD_125)
+	{
+		dllExpLstPos= dllImpLstLst-> GetStartPosition();
+		while(dllExpLstPos)
+		{
+			dllImpLstLst-> GetNextAssoc(dllExpLstPos, dllNam, (CObject *&) actDllImpLst);
+			dllLstEntPos= actDllImpLst-> GetStartPosition();
+			while(dllLstEntPos)
+			{
+				actDllImpLst-> GetNextAssoc(dllLstEntPos, dllEntNam, (CObject *&) actDllExpEnt);
+				if (actDllExpEnt-> dllObjFil && actDllExpEnt-> dllObjFil-> libObjFil)
+					InitCVModJob(&modWork-> jobArr[modWork-> jobNum++], actDllExpEnt-> dllObjFil, CV_MOD_125);
+			}
+		}
+	}
+
+	// Module aus den Bibliotheken
+
+	objFilLstPos= obFilLst-> GetHeadPosition();
+	while(objFilLstPos)
+	{
+		actObjFil= (CObjFile *)obFilLst-> GetNext(objFilLstPos);
+		if (!actObjFil-> libObjFil)
+			continue;
+
+		actJob= &modWork-> jobArr[modWork-> jobNum++];
+		InitCVModJob(actJob, actObjFil, bldCVMod & CV_MOD_120);
+
+		if ((bldCVMod & CV_MOD_125) && (bldCVMod & CV_MOD_127))
+		{
+			dllFil= !_stricmp(&actObjFil-> objFilNam[strlen(actObjFil-> objFilNam) - 3], "DLL");
+			if (!actObjFil-> incDllFun && !dllFil)
+				actJob-> bldCVMod|= CV_MOD_125;
+			if (actObjFil-> linNmbInc && !dllFil)
+				actJob-> bldCVMod|= CV_MOD_127;
+		}
+
+		if (!actJob-> bldCVMod)
+			modWork-> jobNum--;
+	}
+
+	// Der aufrufende Thread arbeitet selbst mit, daher ein Thread weniger als Prozessoren
+	GetSystemInfo(&sysInf);
+	if (sysInf.dwNumberOfProcessors > 1)
+		thrNum= min(sysInf.dwNumberOfProcessors, MAX_CV_MOD_THR + 1) - 1;
+	if (thrNum > (DWORD)modWork-> jobNum)
+		thrNum= modWork-> jobNum;
+
+	for (i= 0; i < thrNum; i++)
+	{
+		thrHdl[i]= (HANDLE)_beginthreadex(NULL, 0, CVModWorker, modWork, 0, NULL);
+		if (!thrHdl[i])
+		{
+			thrNum= i;
+			break;
+		}
+	}
+
+	CVModWorker(modWork);
+
+	if (thrNum)
+	{
+		WaitForMultipleObjects(thrNum, thrHdl, TRUE, INFINITE);
+		for (i= 0; i < thrNum; i++)
+			CloseHandle(thrHdl[i]);
+	}
+}
+
+/**************************************************************************************************/
+/*** Rckgabe des sstSrcModule einer Objektdatei. Wurde es bereits parallel erstellt, wird es   ***/
+/*** aus dem Auftrag genommen, sonst wird es hier erstellt.                                     ***/
+/**************************************************************************************************/
+
+CMyMemFile *CExeFileDebugSection::GiveCVsstSrcModule(CObjFile *aObjFil, myCVModWork *modWork)
+{
+	myCVModJob *actJob;
+	CMyMemFile *rawDatSstSrcMod;
+
+	actJob= GiveCVModJob(aObjFil, CV_MOD_127, modWork);
+	if (!actJob)
+		return BuildCVsstSrcModule(aObjFil);
+
+	rawDatSstSrcMod= actJob-> srcModRawDat;
+	actJob-> srcModRawDat= NULL;
+
+	return rawDatSstSrcMod;
+}
+
 /**************************************************************************************************/
 /*** Erstellen des CV sstLibrary Moduls (0x128) ***************************************************/
 /**************************************************************************************************/
@@ -2372,6 +2988,116 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstLibraries()
 	return sstLibRawDat;
 }
 
+/**************************************************************************************************/
+/*** Eintrag der Hash- und Adretabellen von sstGlobalSym und sstGlobalPub. Die Eintrge werden ***/
+/*** beim Schreiben der Symbole gesammelt und erst danach auf die Ketten verteilt.              ***/
+/**************************************************************************************************/
+
+struct myCVHshEnt
+{
+ DWORD symOff;  // Offset des Symbols in der Symboltabelle
+ DWORD chkSum;  // GiveTableHash() des Symbolnamens
+ DWORD secOff;
+ WORD  adrInd;  // Kette in der Adretabelle oder CV_HSH_NO_ADR
+};
+
+/**************************************************************************************************/
+/*** Anzahl der Hashketten: ein Zehntel der Eintrge, mindestens 6. Gerechnet wird mit 32 Bit,  ***/
+/*** in der Tabelle steht die Anzahl aber nur als WORD (cHash) und wird deshalb begrenzt.       ***/
+/**************************************************************************************************/
+
+static DWORD GiveCVHashBucketNumber(DWORD entNum)
+{
+	DWORD bukNum= entNum / 10;
+
+	if (bukNum < 6) bukNum= 6;
+	if (bukNum > 0xFFFF) bukNum= 0xFFFF;
+	return bukNum;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+static int __cdecl CompareCVAdrChnEnt(const void *chnEnt1, const void *chnEnt2)
+{
+	DWORD secOff1= ((DWORD *)chnEnt1)[1];
+	DWORD secOff2= ((DWORD *)chnEnt2)[1];
+
+	if (secOff1 < secOff2) return -1;
+	if (secOff1 > secOff2) return 1;
+	return 0;
+}
+
+/**************************************************************************************************/
+/*** Schreibt Offsets, Zhler und Ketten einer Hashtabelle (adrChn == FALSE) bzw. Adretabelle  ***/
+/*** (adrChn == TRUE). Gezhlt, aufsummiert und verteilt wird in einem einzigen Puffer, der wie ***/
+/*** die Tabelle in der Datei aufgebaut ist. Zurckgegeben wird die Lnge der Ketten.           ***/
+/**************************************************************************************************/
+
+static DWORD WriteCVHashChains(CMyMemFile *rawDat, myCVHshEnt *entArr, DWORD entNum, DWORD chnNum, BOOL adrChn)
+{
+	DWORD *tabBuf;
+	DWORD *chnOff;
+	DWORD *chnCnt;
+	DWORD *chnEnt;
+	DWORD entInd;
+	DWORD chnInd;
+	DWORD chnEntPos;
+	DWORD chnEntNum= 0;
+
+	for(entInd= 0; entInd < entNum; entInd++)
+		if (!adrChn || entArr[entInd].adrInd != CV_HSH_NO_ADR)
+			chnEntNum++;
+
+	tabBuf= (DWORD *) malloc((2 * chnNum + 2 * chnEntNum) * sizeof(DWORD));
+	chnOff= tabBuf;
+	chnCnt= chnOff + chnNum;
+	chnEnt= chnCnt + chnNum;
+	memset(chnCnt, 0, chnNum * sizeof(DWORD));
+
+	for(entInd= 0; entInd < entNum; entInd++)
+	{
+		if (!adrChn)
+			chnCnt[entArr[entInd].chkSum % chnNum]++;
+		else if (entArr[entInd].adrInd != CV_HSH_NO_ADR)
+			chnCnt[entArr[entInd].adrInd]++;
+	}
+
+	// chnOff enthlt zunchst den Index des nchsten freien Eintrags der Kette
+
+	chnEntPos= 0;
+	for(chnInd= 0; chnInd < chnNum; chnInd++)
+	{
+		chnOff[chnInd]= chnEntPos;
+		chnEntPos+= chnCnt[chnInd];
+	}
+
+	for(entInd= 0; entInd < entNum; entInd++)
+	{
+		if (!adrChn)
+			chnInd= entArr[entInd].chkSum % chnNum;
+		else if ((chnInd= entArr[entInd].adrInd) == CV_HSH_NO_ADR)
+			continue;
+		chnEntPos= 2 * chnOff[chnInd]++;
+		chnEnt[chnEntPos]= entArr[entInd].symOff;
+		chnEnt[chnEntPos + 1]= adrChn ? entArr[entInd].secOff : entArr[entInd].chkSum;
+	}
+
+	for(chnInd= 0; chnInd < chnNum; chnInd++)
+	{
+		chnOff[chnInd]-= chnCnt[chnInd];
+		if (adrChn && chnCnt[chnInd] > 1) // Die Adreketten werden nach dem Offset sortiert
+			qsort(chnEnt + 2 * chnOff[chnInd], chnCnt[chnInd], 2 * sizeof(DWORD), CompareCVAdrChnEnt);
+		chnOff[chnInd]*= 2 * sizeof(DWORD);
+	}
+
+	rawDat-> Write(tabBuf, (2 * chnNum + 2 * chnEntNum) * sizeof(DWORD));
+	free(tabBuf);
+
+	return 2 * chnEntNum * sizeof(DWORD);
+}
+
 /**************************************************************************************************/
 /*** Erstellen des CV sstGlobalSym Moduls	(0x129) *************************************************/
 /**************************************************************************************************/
@@ -2384,17 +3110,10 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
  mySymbolRecord          glbSymRec;
 	mySymbolRecord          alnStaRec;
 	mySymbolEntry											*actSymEnt;
+	myCVHshEnt														*hshEntArr;
 	
 	CMyMemFile *rawDatGlbSymEnt;
 	CMyMemFile	*rawDatCVsstGlbSym;
-	CMyMemFile	*rawDatBukCnt;
-	CMyMemFile	*rawDatChnTab;
-	CMyMemFile	*rawDatHshChnEnt;
-	CMyMemFile	*rawDatAdrEnt;
-	CMyMemFile	*rawDatSecCnt;
-	CMyMemFile	*rawDatAdrTab;
-	CMyObArray	*symHshFunChnArr;
-	CMyObArray	*symAdrFunChnArr;
 	
 	POSITION	symLstPos;
 
@@ -2405,19 +3124,16 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
 	DWORD chkSum;
 	DWORD nxtSymInfEnt= 0;
 	DWORD oldNxtSymInfEnt= 0;
-	DWORD nxtChnTabEnt= 0;
+	DWORD nxtChnTabEnt;
 	DWORD nxtAdrTabEnt= 0;
-	DWORD chnTabEntLen;
 	DWORD adrTabEntLen;
-	DWORD bukNumCnt;
+	DWORD hshEntNum= 0;
+	DWORD bukNum;
 	DWORD alnEndSgn;
 	DWORD *sSymTypPtr;
 	DWORD sSymTypDW;
 	WORD		sSymTypW;
 	WORD  bytTilAlnEnd;
-	WORD  hshFunChnInd;
-	WORD  adrFunChnInd;
-	WORD  bukNum= 0;
 	WORD  secNum= 1;
 	BYTE  *bytBuf;
  BYTE  symPagAlnBuf[8]= {0x06, 0x00, 0x02, 0x04, 0xFF, 0xFF, 0xFF, 0xFF};
@@ -2433,27 +3149,7 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
 	rawDatCVsstGlbSym= new CMyMemFile();
 	rawDatCVsstGlbSym-> Write(&sstGloSymPubHdr, sizeof(mySstGSymGPubSSymHeader));
 
-	bukNum= gloDatSymLst-> GetCount();
-	bukNum+= sstGloSymLst-> GetCount();
-	bukNum= bukNum / sstGloSymPubHdr.symHshInd;
- if (bukNum < 6) bukNum= 6;
-	
-	symHshFunChnArr= new CMyObArray();
-	symHshFunChnArr-> SetSize(bukNum);
-	symAdrFunChnArr= new CMyObArray();
-	symAdrFunChnArr-> SetSize(secNum);
-	
-	for(hshFunChnInd= 0; hshFunChnInd < bukNum; hshFunChnInd++)
-	{
-		rawDatHshChnEnt= new CMyMemFile();
-		symHshFunChnArr-> SetAt(hshFunChnInd, rawDatHshChnEnt);
-	}
-
-	for(adrFunChnInd= 0; adrFunChnInd < secNum; adrFunChnInd++)
-	{
-		rawDatAdrEnt= new CMyMemFile();
-		symAdrFunChnArr-> SetAt(adrFunChnInd, rawDatAdrEnt);
-	}
+	hshEntArr= (myCVHshEnt *) malloc((gloDatSymLst-> GetCount() + sstGloSymLst-> GetCount() + 1) * sizeof(myCVHshEnt));
 	
 	symLstPos= gloDatSymLst-> GetStartPosition();
 	while(symLstPos)
@@ -2509,14 +3205,11 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
 				nxtSymInfEnt+= alnStaRec.recLen + sizeof(WORD);
 			}
 				
-			chkSum= GiveTableHash(actSymEnt-> symNam);
-			rawDatHshChnEnt= (CMyMemFile *)symHshFunChnArr-> GetAt(chkSum % bukNum);
-			rawDatHshChnEnt-> Write(&oldNxtSymInfEnt, sizeof(DWORD));
-			rawDatHshChnEnt-> Write(&chkSum, sizeof(DWORD));
-
-			rawDatAdrEnt= (CMyMemFile *)symAdrFunChnArr-> GetAt((actSymEnt-> secNum - 1) % secNum);
-			rawDatAdrEnt-> Write(&oldNxtSymInfEnt, sizeof(DWORD));
-			rawDatAdrEnt-> Write(&actSymEnt-> secOff, sizeof(DWORD));
+			hshEntArr[hshEntNum].symOff= oldNxtSymInfEnt;
+			hshEntArr[hshEntNum].chkSum= GiveTableHash(actSymEnt-> symNam);
+			hshEntArr[hshEntNum].secOff= actSymEnt-> secOff;
+			hshEntArr[hshEntNum].adrInd= (WORD )((actSymEnt-> secNum - 1) % secNum);
+			hshEntNum++;
 
 			if (verSgnCV == VER_SGN_CV4)
 			{
@@ -2577,9 +3270,10 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
 			nxtSymInfEnt+= alnStaRec.recLen + sizeof(WORD);
 		}
 
-		rawDatHshChnEnt= (CMyMemFile *)symHshFunChnArr-> GetAt(chkSum % bukNum);
-		rawDatHshChnEnt-> Write(&nxtSymInfEnt, sizeof(DWORD));
-		rawDatHshChnEnt-> Write(&chkSum, sizeof(DWORD));
+		hshEntArr[hshEntNum].symOff= oldNxtSymInfEnt;
+		hshEntArr[hshEntNum].chkSum= chkSum;
+		hshEntArr[hshEntNum].adrInd= CV_HSH_NO_ADR;
+		hshEntNum++;
 
   rawDatGlbSymEnt-> SeekToBegin();
   bytBuf= (BYTE *) rawDatGlbSymEnt-> ReadWithoutMemcpy(rawDatGlbSymEnt-> GetLength());
@@ -2597,6 +3291,8 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
 		
 	/* Zusammenhngen der einzelnen CMemFiles des CV sstGlobalPublic Moduls */
 	
+	bukNum= GiveCVHashBucketNumber(hshEntNum);
+
 	sstGloSymPubHdr.symTabLen= rawDatCVsstGlbSym-> GetLength() - sizeof(mySstGSymGPubSSymHeader);
 	sstGloSymPubHdr.symHshTabLen= 2 * sizeof(WORD) + 2 * bukNum * sizeof(DWORD);
 	sstGloSymPubHdr.adrHshTabLen= 2 * sizeof(WORD) + 2 * secNum * sizeof(DWORD);
@@ -2604,40 +3300,9 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
 	rawDatCVsstGlbSym-> Write(&bukNum, sizeof(WORD));
 	rawDatCVsstGlbSym-> Write(chrBuf00, sizeof(WORD));
 
-	rawDatBukCnt= new CMyMemFile();
-	rawDatChnTab= new CMyMemFile();
-	
-	for(hshFunChnInd= 0; hshFunChnInd < bukNum; hshFunChnInd++)
-	{
-		rawDatCVsstGlbSym-> Write(&nxtChnTabEnt, sizeof(DWORD));
-		rawDatHshChnEnt= (CMyMemFile *)symHshFunChnArr-> GetAt(hshFunChnInd);
-		nxtChnTabEnt+= chnTabEntLen= rawDatHshChnEnt-> GetLength();
-		bukNumCnt= chnTabEntLen / (2 * sizeof (DWORD));
-		rawDatBukCnt-> Write(&bukNumCnt, sizeof(DWORD));
-		if (chnTabEntLen)
-		{
-			rawDatHshChnEnt-> SeekToBegin();
-			bytBuf= (BYTE *)rawDatHshChnEnt-> ReadWithoutMemcpy(chnTabEntLen);
-			rawDatChnTab-> Write(bytBuf, chnTabEntLen);
-		}
-		FreeCMyMemFile(rawDatHshChnEnt);
-		delete rawDatHshChnEnt;
-	}
-
+	nxtChnTabEnt= WriteCVHashChains(rawDatCVsstGlbSym, hshEntArr, hshEntNum, bukNum, FALSE);
 	sstGloSymPubHdr.symHshTabLen+= nxtChnTabEnt;
 
-	rawDatBukCnt-> SeekToBegin();
- bytBuf= (BYTE *) rawDatBukCnt-> ReadWithoutMemcpy(bukNum * sizeof(DWORD));
-	rawDatCVsstGlbSym-> Write(bytBuf, bukNum * sizeof(DWORD));
-	
-	rawDatChnTab-> SeekToBegin();
-	bytBuf= (BYTE *) rawDatChnTab-> ReadWithoutMemcpy(rawDatChnTab-> GetLength());
-	rawDatCVsstGlbSym-> Write(bytBuf, rawDatChnTab-> GetLength());
- 
-	sstGloSymPubHdr.symHshTabLen+= nxtAdrTabEnt;
-
-	rawDatSecCnt= new CMyMemFile();
-	rawDatAdrTab= new CMyMemFile();
  sstGloSymPubHdr.adrHshTabLen= rawDatCVsstGlbSym-> GetLength() * -1;
 	rawDatCVsstGlbSym-> Write(&secNum, sizeof(WORD));
 	rawDatCVsstGlbSym-> Write(chrBuf00, sizeof(WORD));
@@ -2656,51 +3321,16 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalSym()
   rawDatCVsstGlbSym-> Write(bytBuf, 2 * sizeof(DWORD));
  }
 	
- for(adrFunChnInd= 0; adrFunChnInd < secNum; adrFunChnInd++)
-	{                             
-		rawDatCVsstGlbSym-> Write(&nxtAdrTabEnt, sizeof(DWORD));
-		rawDatAdrEnt= (CMyMemFile *)symAdrFunChnArr-> GetAt(adrFunChnInd);
-		nxtAdrTabEnt+= adrTabEntLen= rawDatAdrEnt-> GetLength();
-		bukNumCnt= adrTabEntLen / (2 * sizeof (DWORD));
-		rawDatSecCnt-> Write(&bukNumCnt, sizeof(DWORD));
-		if (adrTabEntLen)
-		{
-			rawDatAdrEnt-> SeekToBegin();
-			bytBuf= (BYTE *) rawDatAdrEnt-> ReadWithoutMemcpy(adrTabEntLen);
-			rawDatAdrTab-> Write(bytBuf, adrTabEntLen);
-		}
-		FreeCMyMemFile(rawDatAdrEnt);
-		delete rawDatAdrEnt;
-	}
- 
+	nxtAdrTabEnt= WriteCVHashChains(rawDatCVsstGlbSym, hshEntArr, hshEntNum, secNum, TRUE);
 	sstGloSymPubHdr.symHshTabLen+= nxtAdrTabEnt;
 
-	rawDatSecCnt-> SeekToBegin();
-	bytBuf= (BYTE *) rawDatSecCnt-> ReadWithoutMemcpy(secNum * sizeof(DWORD));
-	rawDatCVsstGlbSym-> Write(bytBuf, secNum * sizeof(DWORD));
-	FreeCMyMemFile(rawDatSecCnt);
-	delete rawDatSecCnt;
-	
-	rawDatAdrTab-> SeekToBegin();
-	bytBuf= (BYTE *) rawDatAdrTab-> ReadWithoutMemcpy(nxtAdrTabEnt);
-	rawDatCVsstGlbSym-> Write(bytBuf, nxtAdrTabEnt);
-	FreeCMyMemFile(rawDatAdrTab);
-	delete rawDatAdrTab;
-
 	rawDatCVsstGlbSym-> SeekToBegin();
 	sstGloSymPubHdr.adrHshTabLen+= rawDatCVsstGlbSym-> GetLength();
 	rawDatCVsstGlbSym-> Write(&sstGloSymPubHdr, sizeof(mySstGSymGPubSSymHeader));
  
 	/* Freigeben des allokierten Speichers */
 
-	FreeCMyMemFile(rawDatBukCnt);
-	delete rawDatBukCnt;
-	FreeCMyMemFile(rawDatChnTab);
-	delete rawDatChnTab;
-	FreeCMyObArray(symHshFunChnArr);
-	delete symHshFunChnArr;
-	FreeCMyObArray(symAdrFunChnArr);
-	delete symAdrFunChnArr;
+	free(hshEntArr);
 		
 	return rawDatCVsstGlbSym;
 
@@ -2717,20 +3347,13 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 	myDatSym32CV5											pub32RecEntCV5;
  mySymbolRecord          alnStaRec;
 
-	CMyMapStringToPtr							*sstGloSymNamLst;
 	CObjFileSection									*resSymSec;
 	mySymbolEntry											*actSymEnt;
+	mySymbolEntry											**symNamTab;
+	myCVHshEnt														*hshEntArr;
 
 	CObjFile	  *actObjFil;
 	CMyMemFile	*rawDatCVsstGlbPub;
-	CMyMemFile	*rawDatBukCnt;
-	CMyMemFile	*rawDatChnTab;
-	CMyMemFile	*rawDatHshChnEnt;
-	CMyMemFile	*rawDatAdrEnt;
-	CMyMemFile	*rawDatSecCnt;
-	CMyMemFile	*rawDatAdrTab;
-	CMyObArray	*symHshFunChnArr;
-	CMyObArray	*symAdrFunChnArr;
 
 	POSITION	objLstPos;
 	POSITION	symLstPos;
@@ -2738,19 +3361,16 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 	DWORD chkSum;
 	DWORD nxtSymInfEnt= 0;
  DWORD oldNxtSymInfEnt= 0;
-	DWORD nxtChnTabEnt= 0;
-	DWORD nxtAdrTabEnt= 0;
-	DWORD chnTabEntLen;
-	DWORD adrTabEntLen;
-	DWORD bukNumCnt;
+	DWORD nxtChnTabEnt;
+	DWORD nxtAdrTabEnt;
  DWORD alnEndSgn;
-	DWORD *aPtr= 0x0000;
-	WORD  hshFunChnInd;
-	WORD  adrFunChnInd;
+	DWORD pubSymNum= 0;
+	DWORD hshEntNum= 0;
+	DWORD symNamTabSiz;
+	DWORD symNamInd;
+	DWORD bukNum;
 	WORD  bytTilAlnEnd;
-	WORD  bukNum= 0;
 	WORD  secNum= 5;
-	BYTE  *bytBuf;
 
 	sstGloSymPubHdr.symHshInd= 0xA;
 	sstGloSymPubHdr.adrHshInd= 0xC;
@@ -2766,29 +3386,16 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 	while(objLstPos)
 	{
 		actObjFil= (CObjFile *)obFilLst-> GetNext(objLstPos);
-		bukNum+= actObjFil-> gloPubSymLst-> GetCount();
+		pubSymNum+= actObjFil-> gloPubSymLst-> GetCount();
 	}
 	
-	bukNum= bukNum / sstGloSymPubHdr.symHshInd;
-	
-	symHshFunChnArr= new CMyObArray();
-	symHshFunChnArr-> SetSize(bukNum);
-	symAdrFunChnArr= new CMyObArray();
-	symAdrFunChnArr-> SetSize(secNum);
-	
-	for(hshFunChnInd= 0; hshFunChnInd < bukNum; hshFunChnInd++)
-	{
-		rawDatHshChnEnt= new CMyMemFile();
-		symHshFunChnArr-> SetAt(hshFunChnInd, rawDatHshChnEnt);
-	}
+	hshEntArr= (myCVHshEnt *) malloc((pubSymNum + 1) * sizeof(myCVHshEnt));
 
-	for(adrFunChnInd= 0; adrFunChnInd < secNum; adrFunChnInd++)
-	{
-		rawDatAdrEnt= new CMyMemFile();
-		symAdrFunChnArr-> SetAt(adrFunChnInd, rawDatAdrEnt);
-	}
-	
-	sstGloSymNamLst= new CMyMapStringToPtr();
+	// Bereits aufgenommene Namen (offene Adressierung, hchstens zur Hlfte gefllt)
+
+	for(symNamTabSiz= 0x10; symNamTabSiz < 2 * pubSymNum; symNamTabSiz<<= 1);
+	symNamTab= (mySymbolEntry **) malloc(symNamTabSiz * sizeof(mySymbolEntry *));
+	memset(symNamTab, 0, symNamTabSiz * sizeof(mySymbolEntry *));
 	
 	objLstPos= obFilLst-> GetHeadPosition();
 
@@ -2819,9 +3426,14 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
     }
 			}
    
-			if (!sstGloSymNamLst-> Lookup(actSymEnt-> symNam, (void *&) aPtr))
+			chkSum= GiveTableHash(actSymEnt-> symNam);
+			symNamInd= chkSum & (symNamTabSiz - 1);
+			while(symNamTab[symNamInd] && strcmp(symNamTab[symNamInd]-> symNam, actSymEnt-> symNam))
+				symNamInd= (symNamInd + 1) & (symNamTabSiz - 1);
+
+			if (!symNamTab[symNamInd])
 			{
-				sstGloSymNamLst-> SetAt(actSymEnt-> symNam, aPtr);
+				symNamTab[symNamInd]= actSymEnt;
 
 				if (verSgnCV == VER_SGN_CV4)
 				{
@@ -2865,14 +3477,11 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 					nxtSymInfEnt+= alnStaRec.recLen + sizeof(WORD);
 				}
 				
-				chkSum= GiveTableHash(actSymEnt-> symNam);
-				rawDatHshChnEnt= (CMyMemFile *)symHshFunChnArr-> GetAt(chkSum % bukNum);
-				rawDatHshChnEnt-> Write(&oldNxtSymInfEnt, sizeof(DWORD));
-				rawDatHshChnEnt-> Write(&chkSum, sizeof(DWORD));
-
-				rawDatAdrEnt= (CMyMemFile *)symAdrFunChnArr-> GetAt((actSymEnt-> secNum - 1) % secNum);
-				rawDatAdrEnt-> Write(&oldNxtSymInfEnt, sizeof(DWORD));
-				rawDatAdrEnt-> Write(&actSymEnt-> secOff, sizeof(DWORD));
+				hshEntArr[hshEntNum].symOff= oldNxtSymInfEnt;
+				hshEntArr[hshEntNum].chkSum= chkSum;
+				hshEntArr[hshEntNum].secOff= actSymEnt-> secOff;
+				hshEntArr[hshEntNum].adrInd= (WORD )((actSymEnt-> secNum - 1) % secNum);
+				hshEntNum++;
 
 				if (verSgnCV == VER_SGN_CV4)
 				{
@@ -2892,8 +3501,7 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 		}
 	}
 
-	sstGloSymNamLst-> RemoveAll();
-	delete(sstGloSymNamLst);
+	free(symNamTab);
 	
  // Abschlieendes P_ALIGN Symbol
 
@@ -2906,6 +3514,8 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 	
 	/* Zusammenhngen der einzelnen CMemFiles des CV sstGlobalPublic Moduls */
 		
+	bukNum= GiveCVHashBucketNumber(hshEntNum);
+
 	sstGloSymPubHdr.symTabLen= nxtSymInfEnt + BytesTillAlignEnd(nxtSymInfEnt, sizeof(DWORD));
 	sstGloSymPubHdr.symHshTabLen= 2 * sizeof(WORD) + 2 * bukNum * sizeof(DWORD);
 	sstGloSymPubHdr.adrHshTabLen= 2 * sizeof(WORD) + 2 * secNum * sizeof(DWORD);
@@ -2913,71 +3523,15 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 	rawDatCVsstGlbPub-> Write(&bukNum, sizeof(WORD));
 	rawDatCVsstGlbPub-> Write(chrBuf00, sizeof(WORD));
 
-	rawDatBukCnt= new CMyMemFile();
-	rawDatChnTab= new CMyMemFile();
-	
-	for(hshFunChnInd= 0; hshFunChnInd < bukNum; hshFunChnInd++)
-	{
-		rawDatCVsstGlbPub-> Write(&nxtChnTabEnt, sizeof(DWORD));
-		rawDatHshChnEnt= (CMyMemFile *)symHshFunChnArr-> GetAt(hshFunChnInd);
-		nxtChnTabEnt+= chnTabEntLen= rawDatHshChnEnt-> GetLength();
-		bukNumCnt= chnTabEntLen / (2 * sizeof (DWORD));
-		rawDatBukCnt-> Write(&bukNumCnt, sizeof(DWORD));
-		if (chnTabEntLen)
-		{
-			rawDatHshChnEnt-> SeekToBegin();
-			bytBuf= (BYTE *)rawDatHshChnEnt-> ReadWithoutMemcpy(chnTabEntLen);
-			rawDatChnTab-> Write(bytBuf, chnTabEntLen);
-		}
-		FreeCMyMemFile(rawDatHshChnEnt);
-		delete rawDatHshChnEnt;
-	}
-
+	nxtChnTabEnt= WriteCVHashChains(rawDatCVsstGlbPub, hshEntArr, hshEntNum, bukNum, FALSE);
 	sstGloSymPubHdr.symHshTabLen+= nxtChnTabEnt;
 
-	rawDatBukCnt-> SeekToBegin();
-	bytBuf= (BYTE *)rawDatBukCnt-> ReadWithoutMemcpy(bukNum * sizeof(DWORD));
-	rawDatCVsstGlbPub-> Write(bytBuf, bukNum * sizeof(DWORD));
-	
-	rawDatChnTab-> SeekToBegin();
-	bytBuf= (BYTE *)rawDatChnTab-> ReadWithoutMemcpy(nxtChnTabEnt);
-	rawDatCVsstGlbPub-> Write(bytBuf, nxtChnTabEnt);
-
  // Build Address Sort Table
 	
-	rawDatSecCnt= new CMyMemFile();
-	rawDatAdrTab= new CMyMemFile();
 	rawDatCVsstGlbPub-> Write(&secNum, sizeof(WORD));  // Number of logical Segments/Sections
 	rawDatCVsstGlbPub-> Write(chrBuf00, sizeof(WORD)); // Alignment Filer
 
-	for(adrFunChnInd= 0; adrFunChnInd < secNum; adrFunChnInd++)
-	{
-		rawDatCVsstGlbPub-> Write(&nxtAdrTabEnt, sizeof(DWORD));
-		rawDatAdrEnt= (CMyMemFile *)symAdrFunChnArr-> GetAt(adrFunChnInd);
-		nxtAdrTabEnt+= adrTabEntLen= rawDatAdrEnt-> GetLength();
-		bukNumCnt= adrTabEntLen / (2 * sizeof (DWORD));
-		rawDatSecCnt-> Write(&bukNumCnt, sizeof(DWORD));
-		if (adrTabEntLen)
-		{
-			rawDatAdrEnt-> SeekToBegin();
-			bytBuf= (BYTE *)rawDatAdrEnt-> ReadWithoutMemcpy(adrTabEntLen);
-			rawDatAdrTab-> Write(bytBuf, adrTabEntLen);
-		}
-		FreeCMyMemFile(rawDatAdrEnt);
-		delete rawDatAdrEnt;
-	}
-
-	rawDatSecCnt-> SeekToBegin();
-	bytBuf= (BYTE *)rawDatSecCnt-> ReadWithoutMemcpy(secNum * sizeof(DWORD));
-	rawDatCVsstGlbPub-> Write(bytBuf, secNum * sizeof(DWORD));
-	FreeCMyMemFile(rawDatSecCnt);
-	delete rawDatSecCnt;
-	
-	rawDatAdrTab-> SeekToBegin();
-	bytBuf= (BYTE *) rawDatAdrTab-> ReadWithoutMemcpy(nxtAdrTabEnt);
-	rawDatCVsstGlbPub-> Write(bytBuf, nxtAdrTabEnt);
-	FreeCMyMemFile(rawDatAdrTab);
-	delete rawDatAdrTab;
+	nxtAdrTabEnt= WriteCVHashChains(rawDatCVsstGlbPub, hshEntArr, hshEntNum, secNum, TRUE);
 
 	rawDatCVsstGlbPub-> SeekToBegin();
 	sstGloSymPubHdr.adrHshTabLen+= nxtAdrTabEnt;
@@ -2985,14 +3539,7 @@ CMyMemFile *CExeFileDebugSection::BuildCVsstGlobalPub(CMyObList *obFilLst)
 
 	/* Freigeben des allokierten Speichers */
 
-	FreeCMyMemFile(rawDatBukCnt);
-	delete rawDatBukCnt;
-	FreeCMyMemFile(rawDatChnTab);
-	delete rawDatChnTab;
-	FreeCMyObArray(symHshFunChnArr);
-	delete symHshFunChnArr;
-	FreeCMyObArray(symAdrFunChnArr);
-	delete symAdrFunChnArr;
+	free(hshEntArr);
 		
 	return rawDatCVsstGlbPub;
 }
@@ -3727,12 +4274,7 @@ WORD CExeFileDebugSection::SetPESymbolType40(WORD sTyp, WORD objFilTypInd, CPtrA
 		if (sTyp < objFilTypInd + 0x1000)
 		{
 			aSstGloTypInf= (mySstGloTypInfRec *) objFilTypArr-> GetAt(sTyp - 0x1000); 
-			if (aSstGloTypInf-> sstGloTypInd == 0xFFFFFFFF)
-			{
-				aSstGloTypInf-> sstGloTypInd= sstGloTypInd + 0x1000;
-				sstGloTypArr-> SetAtGrow(sstGloTypInd, aSstGloTypInf);
-				sstGloTypInd++;
-			}
+			MapTypeRecord(aSstGloTypInf, objFilTypInd, objFilTypArr);
 		aSstGloTypInf-> typRefNmb++;
 		}
 		else
@@ -3761,12 +4303,7 @@ DWORD CExeFileDebugSection::SetPESymbolType50(DWORD sTyp, DWORD objFilTypInd, CP
 		if (sTyp < objFilTypInd + 0x1000)
 		{
 			aSstGloTypInf= (mySstGloTypInfRec *) objFilTypArr-> GetAt(sTyp - 0x1000); 
-			if (aSstGloTypInf-> sstGloTypInd == 0xFFFFFFFF)
-			{
-				aSstGloTypInf-> sstGloTypInd= sstGloTypInd + 0x1000;
-				sstGloTypArr-> SetAtGrow(sstGloTypInd, aSstGloTypInf);
-				sstGloTypInd++;
-			}
+			MapTypeRecord(aSstGloTypInf, objFilTypInd, objFilTypArr);
 		aSstGloTypInf-> typRefNmb++;
 		}
 		else
@@ -3781,6 +4318,157 @@ DWORD CExeFileDebugSection::SetPESymbolType50(DWORD sTyp, DWORD objFilTypInd, CP
 	return 0x0000;
 }
 
+/**************************************************************************************************/
+/*** Zuordnen des globalen Typindexes eines Typs der Objektdatei. Zuerst werden die Typindizes  ***/
+/*** im Typ selbst (rekursiv) auf globale Typindizes umgesetzt, danach wird in der Hashtabelle  ***/
+/*** nach einem Typ mit gleichem Inhalt gesucht. Ein solcher Typ wird auch fr diesen Typ ver-  ***/
+/*** wendet, damit landen gleiche Typen verschiedener Objektdateien nur einmal im sstGlobal-    ***/
+/*** Types. Ein Typ, der ber einen Zyklus auf sich selbst verweist, erhlt sofort einen eigenen***/
+/*** globalen Typindex und wird nicht zusammengefat.                                           ***/
+/**************************************************************************************************/
+
+void CExeFileDebugSection::MapTypeRecord(mySstGloTypInfRec *aTypInf, DWORD objFilTypInd, CPtrArray *objFilTypArr)
+{
+	mySstGloTypInfRec *canTypInf;
+	DWORD             actFilPos;
+
+	if (aTypInf-> typMapSta == TYP_MAP_ACT)
+	{
+		AddGlobalType(aTypInf);
+		return;
+	}
+
+	if (aTypInf-> typMapSta != TYP_MAP_NEW)
+		return;
+
+	aTypInf-> typMapSta= TYP_MAP_ACT;
+
+	// Die Typindizes werden in den Rohdaten der .debug$T Sektion hinter dem Typ-Tag gepatcht
+	actFilPos= actRawDatSecT-> GetPosition();
+	actRawDatSecT-> Seek(aTypInf-> typRawDat - actRawDatSecT-> GetBufferStart() + sizeof(WORD), CFile::begin);
+
+	if (actTypVerSgn == VER_SGN_CV4)
+		CalculateTypeIndizes40(*(WORD *)aTypInf-> typRawDat, aTypInf-> symLen, actRawDatSecT, (WORD )objFilTypInd, objFilTypArr, actTypObjFil);
+	else
+		CalculateTypeIndizes50(*(WORD *)aTypInf-> typRawDat, aTypInf-> symLen, actRawDatSecT, objFilTypInd, objFilTypArr, actTypObjFil);
+
+	actRawDatSecT-> Seek(actFilPos, CFile::begin);
+
+	if (aTypInf-> typMapSta == TYP_MAP_GLO)	// ber einen Zyklus bereits eingetragen
+	{
+		InsertGlobalType(aTypInf);
+		return;
+	}
+
+	canTypInf= LookupGlobalType(aTypInf);
+	if (canTypInf)
+	{
+		aTypInf-> sstGloTypInd= canTypInf-> sstGloTypInd;
+		aTypInf-> typMapSta= TYP_MAP_DUP;
+	}
+	else
+	{
+		AddGlobalType(aTypInf);
+		InsertGlobalType(aTypInf);
+	}
+}
+
+/**************************************************************************************************/
+/*** Anhngen eines Typs an sstGloTypArr                                                        ***/
+/**************************************************************************************************/
+
+void CExeFileDebugSection::AddGlobalType(mySstGloTypInfRec *aTypInf)
+{
+	aTypInf-> sstGloTypInd= sstGloTypInd + 0x1000;
+	aTypInf-> typMapSta= TYP_MAP_GLO;
+	sstGloTypArr-> SetAtGrow(sstGloTypInd, aTypInf);
+	sstGloTypInd++;
+}
+
+/**************************************************************************************************/
+/*** Hashwert (FNV-1a) ber den Inhalt eines Typs mit bereits umgesetzten Typindizes            ***/
+/**************************************************************************************************/
+
+static DWORD GetTypeHash(mySstGloTypInfRec *aTypInf)
+{
+	DWORD hshVal= 2166136261;
+	WORD  i;
+
+	for(i= 0; i < aTypInf-> symLen; i++)
+	{
+		hshVal^= aTypInf-> typRawDat[i];
+		hshVal*= 16777619;
+	}
+	return hshVal;
+}
+
+/**************************************************************************************************/
+/*** Eintragen eines Typs aus sstGloTypArr in die Hashtabelle (offene Adressierung). Ist die    ***/
+/*** Tabelle zur Hlfte gefllt, wird sie verdoppelt und neu aufgebaut.                         ***/
+/**************************************************************************************************/
+
+void CExeFileDebugSection::InsertGlobalType(mySstGloTypInfRec *aTypInf)
+{
+	mySstGloTypInfRec *hshTypInf;
+	DWORD             *oldHshTab;
+	DWORD             oldHshSiz;
+	DWORD             hshInd;
+	DWORD             i;
+
+	if (!gloTypHshTab || 2 * sstGloTypInd > gloTypHshSiz)
+	{
+		oldHshTab= gloTypHshTab;
+		oldHshSiz= gloTypHshSiz;
+		gloTypHshSiz= oldHshTab ? 2 * oldHshSiz : GLO_TYP_HSH_SIZ;
+		while(2 * sstGloTypInd > gloTypHshSiz)
+			gloTypHshSiz*= 2;
+		gloTypHshTab= (DWORD *) malloc(gloTypHshSiz * sizeof(DWORD));
+		memset(gloTypHshTab, 0, gloTypHshSiz * sizeof(DWORD));
+
+		for(i= 0; i < oldHshSiz; i++)
+		{
+			if (!oldHshTab[i])
+				continue;
+			hshTypInf= (mySstGloTypInfRec *) sstGloTypArr-> GetAt(oldHshTab[i] - 1);
+			hshInd= GetTypeHash(hshTypInf) & (gloTypHshSiz - 1);
+			while(gloTypHshTab[hshInd])
+				hshInd= (hshInd + 1) & (gloTypHshSiz - 1);
+			gloTypHshTab[hshInd]= oldHshTab[i];
+		}
+
+		if (oldHshTab)
+			free(oldHshTab);
+	}
+
+	hshInd= GetTypeHash(aTypInf) & (gloTypHshSiz - 1);
+	while(gloTypHshTab[hshInd])
+		hshInd= (hshInd + 1) & (gloTypHshSiz - 1);
+	gloTypHshTab[hshInd]= aTypInf-> sstGloTypInd - 0x1000 + 1;
+}
+
+/**************************************************************************************************/
+/*** Suchen eines Typs mit gleichem Inhalt in sstGloTypArr, Rckgabe NULL wenn keiner vorhanden ***/
+/**************************************************************************************************/
+
+mySstGloTypInfRec *CExeFileDebugSection::LookupGlobalType(mySstGloTypInfRec *aTypInf)
+{
+	mySstGloTypInfRec *hshTypInf;
+	DWORD             hshInd;
+
+	if (!gloTypHshTab)
+		return NULL;
+
+	hshInd= GetTypeHash(aTypInf) & (gloTypHshSiz - 1);
+	while(gloTypHshTab[hshInd])
+	{
+		hshTypInf= (mySstGloTypInfRec *) sstGloTypArr-> GetAt(gloTypHshTab[hshInd] - 1);
+		if (hshTypInf-> symLen == aTypInf-> symLen && !memcmp(hshTypInf-> typRawDat, aTypInf-> typRawDat, aTypInf-> symLen))
+			return hshTypInf;
+		hshInd= (hshInd + 1) & (gloTypHshSiz - 1);
+	}
+	return NULL;
+}
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
@@ -8,6 +8,9 @@
 #ifndef __DEBUG_HPP__
 #define __DEBUG_HPP__
 
+struct myCVModJob;
+struct myCVModWork;
+
 #ifndef __LINKER_H__
 #include "Linker.h"
 #endif
@@ -52,6 +55,12 @@ class CExeFileDebugSection : public CExeFileDataSection
 
 		CPtrArray		*sstGloTypArr;
 		DWORD						sstGloTypInd;	
+		DWORD						*gloTypHshTab;											// Hashtabelle ber den Inhalt der Typen in sstGloTypArr,
+		DWORD						gloTypHshSiz;											// Eintrag ist Index in sstGloTypArr + 1, 0 ist frei
+
+		CMyMemFile	*actRawDatSecT;										// .debug$T Sektion, Objektdatei und Debugformat der
+		CObjFile			*actTypObjFil;										// Typen, die gerade zugeordnet werden
+		DWORD						actTypVerSgn;
 
 		DWORD						verSgnCV;																	// CodeView Versionsnummer; gibt an, welches Debugformat
 																																							// erstellt werden soll.
@@ -100,9 +109,18 @@ private:
 		virtual BOOL GiveSecRawDataBlock(CMyMemFile *exeFilRawDat, WORD fAlign);
 
 	private:
-		CMyMemFile *BuildCVsstModule(CMyObList *obFilLst, CExeFile *actExeFil, CMyMapStringToOb *dllImpLstLst); // 0x120
+		CMyMemFile *BuildCVsstModule(CMyObList *obFilLst, CExeFile *actExeFil, CMyMapStringToOb *dllImpLstLst,
+																															myCVModWork *modWork); // 0x120
+		CMyMemFile *BuildCVsstModuleEntry(CObjFile *aObjFil, CObjFile **modObjFil);
+		CMyMemFile *GiveCVsstModuleEntry(CObjFile *aObjFil, CObjFile **modObjFil, myCVModWork *modWork);
 		CMyMemFile *BuildCVsstAlignSym(CObjFile *aObjFil); // 0x125
+		BOOL BuildCVsstAlignSymParts(myCVModJob *aJob, BOOL parWrk);
+		void MergeCVsstAlignSym(myCVModJob *aJob);
+		CMyMemFile *GiveCVsstAlignSym(CObjFile *aObjFil, myCVModWork *modWork);
 		CMyMemFile *BuildCVsstSrcModule(CObjFile *aObjFil); // 0x127
+		void BuildCVModulesParallel(CMyObList *obFilLst, CMyMapStringToOb *dllImpLstLst, WORD bldCVMod, myCVModWork *modWork);
+		CMyMemFile *GiveCVsstSrcModule(CObjFile *aObjFil, myCVModWork *modWork);
+		static unsigned __stdcall CVModWorker(void *aWork);
 		CMyMemFile *BuildCVsstLibraries(); // 0x128
 		CMyMemFile *BuildCVsstGlobalSym(); // 0x129
 		CMyMemFile *BuildCVsstGlobalPub(CMyObList *obFilLst); // 0x12A
@@ -116,6 +134,10 @@ private:
 		BOOL CalculateTypeIndizes50(WORD symTyp, WORD symLen, CMyMemFile *rawDatSecT, DWORD objFilTypInd, CPtrArray *objFilTypArr, CObjFile *aObjFil);	
 		WORD SetPESymbolType40(WORD sTyp, WORD oFilTypInd, CPtrArray	*objFilTypArr, char *objFilNam);	// Ermittlen des Symboltypindexes in der PE-Datei
 		DWORD SetPESymbolType50(DWORD sTyp, DWORD oFilTypInd, CPtrArray	*objFilTypArr, char *objFilNam);	
+		void MapTypeRecord(mySstGloTypInfRec *aTypInf, DWORD objFilTypInd, CPtrArray *objFilTypArr);
+		void AddGlobalType(mySstGloTypInfRec *aTypInf);
+		void InsertGlobalType(mySstGloTypInfRec *aTypInf);
+		mySstGloTypInfRec *LookupGlobalType(mySstGloTypInfRec *aTypInf);
 
 		CMyMemFile *ChgDbgForSecTToCV4(CMyMemFile *oldRawDatSecT);
 		CMyMemFile *ChgDbgForSecTToCV5(CMyMemFile *oldRawDatSecT);
@@ -5,6 +5,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <process.h>
 
 #ifndef __EXEFILE_HPP__
 #include "ExeFile.hpp"
@@ -40,6 +41,13 @@ extern void FreeCExeFileRelocSection(CExeFileRelocSection *);
 extern void FreeCExeFileDebugSection(CExeFileDebugSection *);
 extern void FreeCSection(CSection *);	
 extern void FreeCMyMemFile(CMyMemFile *);
+extern void FreeCMyPtrList(CMyPtrList *);
+extern void FreeCDWordArray(CDWordArray *);
+
+extern BOOL parRel;                  // In Linker.cpp definiert
+extern BOOL strmExe;                 // In Linker.cpp definiert
+extern BOOL optRef;                  // In Linker.cpp definiert
+extern BOOL optIcf;                  // In Linker.cpp definiert
 
 extern BYTE chrBuf00[];
 
@@ -179,7 +187,7 @@ BOOL CExeFile::FreeUsedMemory()
 /*** Initialisieren und Anlegen aller bentigter Sektionen der zu erzeugenden PE-Datei									 ***/
 /**************************************************************************************************/
 
-BOOL CExeFile::InitExeFileSec(CMyObList *obFilLst, CMyObList *srObjFilLst, CMyMapStringToPtr *pSymLst)
+BOOL CExeFile::InitExeFileSec(CMyObList *obFilLst, CMyObList *srObjFilLst, CMySymbolTable *pSymLst)
 {
 	WORD actSecNum= 0;
 	char secNamBuf[9];
@@ -291,6 +299,84 @@ BOOL CExeFile::IncludeDllImport(CDllExportEntry *dllExpEnt)
 	return TRUE;
 }
 
+/**************************************************************************************************/
+/*** Entfernen nicht referenzierter Sektionen (wie /OPT:REF): Ausgehend vom Startupsymbol und   ***/
+/*** den exportierten Funktionen werden alle Fragmente der .TEXT, .RDATA und .DATA Sektion      ***/
+/*** markiert, die ber Relokationen erreichbar sind. BuildSecRawDataBlockParts bernimmt nur   ***/
+/*** markierte Fragmente. Mit Debuginformation entfllt das Entfernen, da die CodeView Module   ***/
+/*** alle Fragmente ihrer Objektdatei beschreiben.                                              ***/
+/**************************************************************************************************/
+
+BOOL CExeFile::MarkReferencedSections()
+{
+	CSectionFragmentEntry *actFrgEnt;
+	CMyPtrList           *wrkLst;
+	POSITION             expPos;
+
+	DWORD canNum= 0;
+	DWORD refNum= 0;
+
+	if (!optRef || includeDebugInfo)
+		return TRUE;
+
+	wrkLst= new CMyPtrList(100);
+
+	canNum+= textSec-> MarkSecFrags(wrkLst);
+	canNum+= rdataSec-> MarkSecFrags(wrkLst);
+	canNum+= dataSec-> MarkSecFrags(wrkLst);
+
+	if (textSec-> startUpSym)
+		if (CSectionFragmentEntry::MarkSymFrag(textSec-> startUpSym, wrkLst))
+			refNum++;
+
+	if (edataSec)
+	{
+		expPos= edataSec-> expFncLst-> GetHeadPosition();
+		while(expPos)
+			if (CSectionFragmentEntry::MarkSymFrag((mySymbolEntry *)edataSec-> expFncLst-> GetNext(expPos), wrkLst))
+				refNum++;
+	}
+
+	while(!wrkLst-> IsEmpty())
+	{
+		actFrgEnt= (CSectionFragmentEntry *)wrkLst-> RemoveHead();
+		refNum+= actFrgEnt-> MarkRelFrags(wrkLst);
+	}
+
+	FreeCMyPtrList(wrkLst);
+	delete wrkLst;
+
+	printf("\nNicht referenzierte Sektionsfragmente: %lu von %lu\n", canNum - refNum, canNum);
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Zusammenfassen identischer Sektionsfragmente der .TEXT und .RDATA Sektion (wie /OPT:ICF).  ***/
+/*** Fragmente der .RDATA Sektion knnen auf Code verweisen und umgekehrt, daher wird wieder-   ***/
+/*** holt, bis in keiner der beiden Sektionen mehr ein Fragment zusammengefat wird. Mit Debug- ***/
+/*** information entfllt das Zusammenfassen, siehe MarkReferencedSections.                     ***/
+/**************************************************************************************************/
+
+BOOL CExeFile::FoldIdenticalSections()
+{
+	DWORD fldNum= 0;
+	DWORD pasFldNum;
+
+	if (!optIcf || includeDebugInfo)
+		return TRUE;
+
+	do
+	{
+		pasFldNum= rdataSec-> FoldSecFrags();
+		pasFldNum+= textSec-> FoldSecFrags();
+		fldNum+= pasFldNum;
+	}
+	while(pasFldNum);
+
+	printf("\nZusammengefate Sektionsfragmente: %lu\n", fldNum);
+	return TRUE;
+}
+
 /**************************************************************************************************/
 /*** Zusammensetzen der Sektionsfragmente der .TEXT, .BSS, .RDATA und .DATA Sektionen, sowie    ***/
 /*** Aufruf der Methoden zum Erzeugen der .IDATA Sektion und der DLL Forwarder Chain der .TEXT  ***/
@@ -305,6 +391,9 @@ BOOL CExeFile::BuildExeFileRawDataSections()
 	DWORD  exeSecAln;
 
 	nxtVirSecAdr= exeSecAln= exeOptHdrNtSpcFds.secAln;	
+
+	MarkReferencedSections();
+	FoldIdenticalSections();
 	
 	textSec-> SetVirSecAdr(exeOptHdrStdFds.codBas);
  textSec-> BuildSecRawDataBlock();
@@ -407,6 +496,9 @@ BOOL CExeFile::ResolveRelocations()
 {
 	BOOL lnkOK= TRUE;
 
+	if (parRel)
+		return ResolveRelocationsParallel();
+
  if (textSec) 
  {
   if (!textSec-> ResRel(relocSec-> relLst, exeOptHdrNtSpcFds.imgBas))
@@ -429,6 +521,135 @@ BOOL CExeFile::ResolveRelocations()
 	return lnkOK;
 }
 
+/**************************************************************************************************/
+/*** Gemeinsame Daten der Threads beim parallelen Auflsen der Relokationen. Jeder Thread holt  ***/
+/*** sich ber nxtJob den nchsten noch nicht bearbeiteten Teilauftrag aus jobArr.              ***/
+/**************************************************************************************************/
+
+struct myResRelWork
+{
+ myResRelJob **jobArr;
+ LONG        jobNum;
+ LONG        nxtJob;
+ DWORD       imgBas;
+};
+
+static unsigned __stdcall ResRelWorker(void *aWork)
+{
+	myResRelWork *actWork= (myResRelWork *)aWork;
+	myResRelJob  *actJob;
+	LONG         jobInd;
+
+	while((jobInd= InterlockedIncrement(&actWork-> nxtJob) - 1) < actWork-> jobNum)
+	{
+		actJob= actWork-> jobArr[jobInd];
+		actJob-> lnkOK= actJob-> exeSec-> ResRel(actJob-> relLst, actWork-> imgBas, actJob-> frgPos, actJob-> frgNum);
+	}
+
+	return 0;
+}
+
+/**************************************************************************************************/
+/*** Paralleles Auflsen der Relokationen. Die Sektionsfragmente von .TEXT, .RDATA und .DATA    ***/
+/*** werden in Teilauftrge zerlegt, die jeweils ihre eigene .RELOC Adressliste fllen. Danach  ***/
+/*** werden die Listen in der Reihenfolge der Fragmente zusammengefgt, damit die .RELOC        ***/
+/*** Sektion genau wie beim sequentiellen Auflsen aufgebaut wird.                              ***/
+/**************************************************************************************************/
+
+BOOL CExeFile::ResolveRelocationsParallel()
+{
+	CMyPtrList   *jobLst;
+	myResRelJob  *actJob;
+	myResRelWork actWork;
+	SYSTEM_INFO  sysInf;
+	HANDLE       thrHdl[MAX_RES_REL_THR];
+	POSITION     jobPos;
+
+	DWORD thrNum= 0;
+	DWORD i;
+	LONG  txtJobNum= 0;
+	BOOL  lnkOK= TRUE;
+
+	jobLst= new CMyPtrList();
+
+	if (textSec)
+	{
+		textSec-> GiveResRelJobs(jobLst, RES_REL_FRG_PER_JOB);
+		txtJobNum= jobLst-> GetCount();
+	}
+	if (rdataSec)
+		rdataSec-> GiveResRelJobs(jobLst, RES_REL_FRG_PER_JOB);
+	if (dataSec)
+		dataSec-> GiveResRelJobs(jobLst, RES_REL_FRG_PER_JOB);
+
+	actWork.jobNum= jobLst-> GetCount();
+	actWork.nxtJob= 0;
+	actWork.imgBas= exeOptHdrNtSpcFds.imgBas;
+	actWork.jobArr= (myResRelJob **) malloc((actWork.jobNum + 1) * sizeof(myResRelJob *));
+
+	i= 0;
+	jobPos= jobLst-> GetHeadPosition();
+	while(jobPos)
+		actWork.jobArr[i++]= (myResRelJob *)jobLst-> GetNext(jobPos);
+
+	// Der aufrufende Thread arbeitet selbst mit, daher ein Thread weniger als Prozessoren
+	GetSystemInfo(&sysInf);
+	if (sysInf.dwNumberOfProcessors > 1)
+		thrNum= min(sysInf.dwNumberOfProcessors, MAX_RES_REL_THR + 1) - 1;
+	if (thrNum > (DWORD)actWork.jobNum)
+		thrNum= actWork.jobNum;
+
+	for (i= 0; i < thrNum; i++)
+	{
+		thrHdl[i]= (HANDLE)_beginthreadex(NULL, 0, ResRelWorker, &actWork, 0, NULL);
+		if (!thrHdl[i])
+		{
+			thrNum= i;
+			break;
+		}
+	}
+
+	ResRelWorker(&actWork);
+
+	if (thrNum)
+	{
+		WaitForMultipleObjects(thrNum, thrHdl, TRUE, INFINITE);
+		for (i= 0; i < thrNum; i++)
+			CloseHandle(thrHdl[i]);
+	}
+
+	// Zusammenfgen in der Reihenfolge: .TEXT, Forwarder Chain, .RDATA, .DATA
+	for (i= 0; i < (DWORD)actWork.jobNum; i++)
+	{
+		actJob= actWork.jobArr[i];
+
+		if (i == (DWORD)txtJobNum && textSec)
+			if (!textSec-> IncDllForChainRel(idataSec-> dllImpLstLst, relocSec-> relLst, includeDebugInfo))
+				lnkOK= FALSE;
+
+		relocSec-> relLst-> Append(*actJob-> relLst);
+		if (!actJob-> lnkOK)
+			lnkOK= FALSE;
+
+		FreeCDWordArray(actJob-> relLst);
+		delete actJob-> relLst;
+		free(actJob);
+	}
+
+	if (txtJobNum == actWork.jobNum && textSec)
+		if (!textSec-> IncDllForChainRel(idataSec-> dllImpLstLst, relocSec-> relLst, includeDebugInfo))
+			lnkOK= FALSE;
+
+	free(actWork.jobArr);
+	FreeCMyPtrList(jobLst);
+	delete jobLst;
+
+	if (lnkOK)
+		relocSec-> BuildRelSec((WORD )exeOptHdrNtSpcFds.secAln, (WORD )exeOptHdrNtSpcFds.filAln);
+	
+	return lnkOK;
+}
+
 /**************************************************************************************************/
 /*** Aufruf der Methoden zum Erzeugen der Debuginformationen																																				***/
 /**************************************************************************************************/
@@ -641,7 +862,7 @@ BOOL CExeFile::BuildExeFileHeaders()
 	//if (debugSec) exeFilRawDat-> Write(debugSec-> actSecTab, SEC_HDR_SIZ);
 
 
-	exeFilRawDat-> Write(chrBuf00, exeOptHdrNtSpcFds.filAln - (exeFilRawDat-> GetPosition() - 
+	exeFilRawDat-> WriteZero(exeOptHdrNtSpcFds.filAln - (exeFilRawDat-> GetPosition() - 
 			exeOptHdrNtSpcFds.filAln * (exeFilRawDat-> GetPosition() / exeOptHdrNtSpcFds.filAln)));	
 
 	return TRUE;
@@ -654,6 +875,43 @@ BOOL CExeFile::BuildExeFileHeaders()
 
 BOOL CExeFile::BuildExeFileRawData()
 {
+	CStreamFile *strmFil;
+
+	WORD  filAln= (WORD )exeOptHdrNtSpcFds.filAln;
+	DWORD rawDatSiz;
+
+	if (strmExe)
+	{
+		// Die Sektionen werden direkt in die PE-Datei geschrieben, die Header zum Schlu an den
+		// Dateianfang.
+
+		FreeCMyMemFile(exeFilRawDat);
+		delete exeFilRawDat;
+		strmFil= new CStreamFile();
+		exeFilRawDat= strmFil;
+		if (!strmFil-> Open(exeFilNam))
+		{
+		 WriteMessageToPow(ERR_MSGB_OPN_EXE, exeFilNam, NULL);
+			return FALSE;
+		}
+	}
+	else
+	{
+		// Die Gren der Sektionen sind bekannt, Speicher fr die PE-Datei im voraus reservieren
+		// (die Debuginformation ist nicht enthalten).
+
+		rawDatSiz= 0x400 + textSec-> GiveSecRawDataSize(filAln) + dataSec-> GiveSecRawDataSize(filAln);
+	 if (rdataSec-> actSecTab-> virSiz)
+	  rawDatSiz+= rdataSec-> GiveSecRawDataSize(filAln);
+		rawDatSiz+= idataSec-> actSecTab-> virSiz + idataSec-> BytesTillAlignEnd(idataSec-> actSecTab-> virSiz, filAln);
+	 if (edataSec)
+	  rawDatSiz+= edataSec-> actSecTab-> virSiz + edataSec-> BytesTillAlignEnd(edataSec-> actSecTab-> virSiz, filAln);
+		if (rsrcSec)
+			rawDatSiz+= rsrcSec-> actSecTab-> virSiz + rsrcSec-> BytesTillAlignEnd(rsrcSec-> actSecTab-> virSiz, filAln);
+		rawDatSiz+= relocSec-> secRawDatSiz;
+		exeFilRawDat-> Reserve(rawDatSiz);
+	}
+
 	exeFilRawDat-> Seek(0x400, CFile::begin);
 	textSec-> GiveSecRawDataBlock(exeFilRawDat, idataSec-> dllImpLstLst, (WORD )exeOptHdrNtSpcFds.filAln);
  if (rdataSec-> actSecTab-> virSiz)
@@ -681,9 +939,23 @@ BOOL CExeFile::WriteExeFileRawDataToFile()
 {
 	CFile										actExeFil;
 	CFileException *pErr= NULL;
+	CStreamFile				*strmFil;
 
 	BYTE *filDatBuf;
 	
+	// Im Streamingmodus steht die PE-Datei schon auf der Festplatte
+	if (exeFilRawDat-> IsKindOf(RUNTIME_CLASS(CStreamFile)))
+	{
+		strmFil= (CStreamFile *)exeFilRawDat;
+		strmFil-> Close();
+		if (strmFil-> wrtErr)
+		{
+		 WriteMessageToPow(ERR_MSGB_OPN_EXE, exeFilNam, NULL);
+			return FALSE;
+		}
+		return TRUE;
+	}
+
 	exeFilRawDat-> SeekToBegin();
 	filDatBuf= (BYTE *) exeFilRawDat-> ReadWithoutMemcpy(exeFilRawDat-> GetLength());
 	if (!actExeFil.Open(exeFilNam, CFile::modeCreate | CFile::modeWrite | CFile::typeBinary, pErr))
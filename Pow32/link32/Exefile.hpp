@@ -29,9 +29,10 @@ class CExeFile : public CObject
  friend class CExeFileDebugSection;
 	friend class CObj2Exe;
 	friend class CSymbolEntry;
+	friend class CLinkState;
 
  public:
-  CMyMapStringToPtr		*pubSymLst;
+  CMySymbolTable		*pubSymLst;
 		
 		LPSTR *objFilNam;
   LPSTR *libFilNam;
@@ -63,7 +64,7 @@ class CExeFile : public CObject
 		CExeFileRsrcSection		 *rsrcSec;
 		CExeFileDebugSection	 *debugSec;
 
-		CMyMapStringToPtr *pubSymLstForDll;
+		CMySymbolTable *pubSymLstForDll;
 		CMyMemFile						 	*exeFilRawDat;
 		CMyObList  					 	*objFilLst;
   CMyObList         *srcObjFilLst;
@@ -77,9 +78,12 @@ public:
 
 	BOOL FreeUsedMemory();
 
-	BOOL InitExeFileSec(CMyObList *obFilLst, CMyObList *srObjFilLst, CMyMapStringToPtr *pSymLst);
+	BOOL InitExeFileSec(CMyObList *obFilLst, CMyObList *srObjFilLst, CMySymbolTable *pSymLst);
+	BOOL MarkReferencedSections();
+	BOOL FoldIdenticalSections();
 	BOOL BuildExeFileRawDataSections();
 	BOOL ResolveRelocations();
+	BOOL ResolveRelocationsParallel();
 	BOOL InitExeFileHeaders();
 	BOOL BuildDebugInformation();
 	BOOL BuildExeFileHeaders();
@@ -1,6 +1,7 @@
 /**************************************************************************************************/
 /*** Die Datei LibFile.cpp beinhaltet die Implementierung folgender Klassen:																			 ***/
 /***			CLibFile	      																																																																										***/
+/***			CLibFileCache																																																																										***/
 /**************************************************************************************************/
 
 #include <StdLib.h>
@@ -21,18 +22,27 @@
 
 DWORD GivNum(BYTE *strNum, WORD start, WORD endSgn);
 char *GivFilNam(BYTE *buf);
+DWORD GiveLibSymHash(const char *symNam);
+int CompareLibIndexEntry(const void *ent1, const void *ent2);
 
 extern void WriteMessageToPow(WORD msgNr, char *str1, char *str2);
 
 extern void FreeCMemFile(CMemFile *aCMemFile);
 extern void FreeCMyMemFile(CMyMemFile *aCMyMemFile);
+extern void FreeCLibFile(CLibFile *aCLibFile);
+extern void FreeCMySymbolTable(CMySymbolTable *aCMySymbolTable);
+extern void FreeCMyObList(CMyObList *aCMyObList);
+extern void FreeCMapFile(CMapFile *aCMapFile);
 
 extern	FILE		*logFil;
 extern	char		*logFilNam;     
-extern BOOL libFilInMem;
 
 
 IMPLEMENT_DYNAMIC(CLibFile, CObject)
+IMPLEMENT_DYNAMIC(CLibFileCache, CObject)
+
+#define LIB_IDX_SGN  "POWLIX01"           // Kennung und Version der Indexdatei einer Bibliothek
+#define LIB_IDX_SGN_LEN  8
 
 /**************************************************************************************************/
 /**************************************************************************************************/
@@ -46,11 +56,21 @@ CLibFile::CLibFile()
 {
 	actLibFil= NULL;
 	filNam= NULL;
-	pubLibSymLst= NULL;
-	pubLibEntBuf= NULL;
 	lstAccObjFil= NULL;		
  strDirBuf= NULL;
+ libIdxEntLst= NULL;
+ libIdxStrTab= NULL;
+ libIdxFil= NULL;
+ pubLibEntLst= NULL;
+ pubLibEntNum= 0;
+ libPthNam= NULL;
  libFilInd= 0;
+	memNum= 0;
+ symNum= 0;
+	lngNamTabOff= 0;
+ libFilSiz= 0;
+ lstUseNum= 0;
+ staLib= TRUE;
 }
 
 /**************************************************************************************************/
@@ -78,28 +98,34 @@ void CLibFile::FreeUsedMemory()
 		free(filNam); 
 		filNam= NULL;
  }
-	if (actLibFil)
-	{
-		actLibFil-> ~CBuffFile();	
-		delete actLibFil;
-		actLibFil= NULL;
-	}
-	if (pubLibSymLst) 
-	{		
-		pubLibSymLst-> ~CMyMapStringToPtr();       
-		delete pubLibSymLst;
-		pubLibSymLst= NULL;
-	}
+ if (libPthNam)
+ {
+  free(libPthNam);
+  libPthNam= NULL;
+ }
+	actLibFil= NULL;
 	if (strDirBuf)
  {
   free(strDirBuf);
   strDirBuf= NULL;
  }
- if (pubLibEntBuf)
- {
-  free(pubLibEntBuf);
-  pubLibEntBuf= NULL;
- }
+	if (libIdxFil)
+	{
+		// Eintrge und Stringtabelle liegen in der Ansicht der Indexdatei
+		FreeCMapFile(libIdxFil);
+		delete libIdxFil;
+		libIdxFil= NULL;
+	}
+	else if (libIdxEntLst)
+		free(libIdxEntLst);
+	libIdxEntLst= NULL;
+	libIdxStrTab= NULL;
+	if (pubLibEntLst)
+	{
+		free(pubLibEntLst);
+		pubLibEntLst= NULL;
+	}
+	pubLibEntNum= 0;
 	memNum= 0;
  symNum= 0;
 	lngNamTabOff= 0;
@@ -107,35 +133,16 @@ void CLibFile::FreeUsedMemory()
 }
 
 /**************************************************************************************************/
-/*** Anlegen der Listen und Aufruf der Methode zum Laden des Bibliothekverzeichnisses, wenn					***/
-/*** Bibliothek ihr eigenes Verzeichnis besitzt.																																																***/
-/**************************************************************************************************/
-
-BOOL CLibFile::LoadLibFileFromDiscOwnPubList(const char *pszFilNam)
-{
-	pubLibSymLst= new CMyMapStringToPtr();
-	pubLibSymLst-> InitHashTable(100, TRUE);
-	return LoadLibFileFromDisc(pszFilNam, pubLibSymLst);
-}
-
-/**************************************************************************************************/
-/*** Aufruf der Methode zum Laden des Bibliothekverzeichnisses bei nur einem Verzeichnis fr    ***/
-/*** alle vorhandenen Bibliotheken.																																																													***/
-/**************************************************************************************************/
-
-BOOL CLibFile::LoadLibFileFromDiscComPubList(const char *pszFilNam, CMyMapStringToPtr *&pLibSymLst)
-{
-	return LoadLibFileFromDisc(pszFilNam, pLibSymLst);
-}
-
-/**************************************************************************************************/
-/*** ffnen und Laden der Datei einer Bibliothek und Verarbeiten des Bibliothekverzeichnisses			***/
+/*** ffnen der Datei einer Bibliothek und Laden des Bibliothekverzeichnisses. Ist die          ***/
+/*** Indexdatei der Bibliothek aktuell, wird sie nur eingeblendet. Sonst wird das Verzeichnis   ***/
+/*** aus dem zweiten Linkermember gelesen, nach Hashwerten sortiert und als Indexdatei          ***/
+/*** gespeichert.                                                                               ***/
 /**************************************************************************************************/
 
-BOOL CLibFile::LoadLibFileFromDisc(const char *pszFilNam, CMyMapStringToPtr *&pubLibSymLst)
+BOOL CLibFile::LoadLibFileFromDisc(const char *pszFilNam)
 {
 	CFileException		 *pErr= NULL;
-	myPublicLibEntry	*nxtPubLibEnt;
+	myLibIndexEntry		*nxtIdxEnt;
 	
 	myLibFileHeader		lngNamHdr;
 
@@ -144,39 +151,39 @@ BOOL CLibFile::LoadLibFileFromDisc(const char *pszFilNam, CMyMapStringToPtr *&pu
 	DWORD	lngNamOff;
 	DWORD	secLnkMemStart;
 	DWORD strDirSiz;
-	DWORD libFilSiz;
 	WORD		*symIndLst;
 	WORD		posCor;
 	WORD		i;
 	char  *strDirBufInd;
 
-	CBuffFile *libFil;
-	BYTE  *libFilBuf;
+	CMapFile *libFil;
 	
  filNam= GiveLibNameUp(pszFilNam);
-	libFil= new CBuffFile();
+ libPthNam= (char *) malloc(strlen(pszFilNam) + 1);
+ strcpy(libPthNam, pszFilNam);
+	libFil= new CMapFile();
+
+	// Die Bibliothek wird eingeblendet, Verzeichnis und Objektmodule werden direkt aus der
+	// Ansicht gelesen.
 
-	if (!libFil-> Open(pszFilNam, CFile::modeRead | CFile::shareExclusive | CFile::typeBinary, pErr))
+	if (!libFil-> Open(pszFilNam))
 	{
 		WriteMessageToPow(ERR_MSGI_OPN_LIB, (char *)pszFilNam, NULL);
-		((CBuffFile *)libFil)-> ~CBuffFile();       
+		libFil-> ~CMapFile();       
 		delete libFil;
 		return FALSE;
 	}
 	else
 		WriteMessageToPow(INF_MSG_FIL_OPE_SUC, (char *)pszFilNam, NULL);
+
+	// Gre und Zeitstempel zum Wiedererkennen von nderungen (Indexdatei, Bibliothekscache)
+	if (!libFil-> GiveFileInfo(libFilSiz, libFilTim))
+		libFilSiz= 0xFFFFFFFF;
 																																																																		
-	if (libFilInMem)
-	{
-		libFilSiz= libFil-> GetLength();
-		libFilBuf= (BYTE *) malloc(libFilSiz + 1);
-		libFil-> ReadHuge(libFilBuf, libFilSiz);
-		((CMyMemFile *)libFil)-> SetBufferDirect(libFilBuf, libFilSiz);
-		((CBuffFile *)libFil)-> ~CBuffFile();       
-		delete libFil;
-	}
-	else
-		actLibFil= libFil;
+	actLibFil= libFil;
+
+	if (LoadLibIndex())
+		return TRUE;
 
 	actLibFil-> SeekToBegin();
 	actLibFil-> Read(libFilSig, 8);
@@ -227,37 +234,39 @@ BOOL CLibFile::LoadLibFileFromDisc(const char *pszFilNam, CMyMapStringToPtr *&pu
 	strDirBuf= (BYTE *) malloc(strDirSiz + 4);
  actLibFil-> Read(strDirBuf, strDirSiz);
 
- pubLibEntBuf= (BYTE *) malloc (sizeof(myPublicLibEntry) * strDirSiz);
- nxtPubLibEnt= (myPublicLibEntry *) pubLibEntBuf;
+ libIdxEntLst= (myLibIndexEntry *) malloc(symNum * sizeof(myLibIndexEntry) + 1);
+ libIdxStrTab= (char *)strDirBuf;
+ nxtIdxEnt= libIdxEntLst;
 
 	strDirBufInd= (char *)strDirBuf;
 
  for(i= 0; i < symNum; i++)
 	{
-  nxtPubLibEnt-> achMemSym= strDirBufInd;
-  nxtPubLibEnt-> achMemOff= symOffLst[symIndLst[i] - 1];
-  nxtPubLibEnt-> myLibFil= this;
-		pubLibSymLst-> SetAt(strDirBufInd, nxtPubLibEnt);
-  nxtPubLibEnt++;
+  nxtIdxEnt-> hshVal= GiveLibSymHash(strDirBufInd);
+  nxtIdxEnt-> symNamOff= strDirBufInd - libIdxStrTab;
+  nxtIdxEnt-> achMemOff= symOffLst[symIndLst[i] - 1];
+  nxtIdxEnt++;
+
+		// Ist es eine statische oder eine Importlibrary
+		// Annahme: NULL_IMPORT_DESCRIPTOR sollte vorkommen, dann 
+		// handelt es sich um eine Importlibrary, sonst um eine statische.
+
+		if (staLib && strDirBufInd[0] == 'N' && !strcmp(strDirBufInd, "NULL_IMPORT_DESCRIPTOR"))
+			staLib= FALSE;
 
 		while(*strDirBufInd++ != '\0');
 	}			
 
- // Ist es eine statische oder eine Importlibrary
- // Annahme: NULL_IMPORT_DESCRIPTOR sollte vorkommen, dann 
- // handelt es sich um eine Importlibrary, sonst um eine statische.
- 
- if (pubLibSymLst-> Lookup("NULL_IMPORT_DESCRIPTOR", (void *&)nxtPubLibEnt))
-  if (nxtPubLibEnt-> myLibFil == this)
-   staLib= FALSE;
-
-	/* strDirBuf darf hier nicht gelscht werden, da CMyMapStringToOb den Speicherbereich */
- /* direkt fr die HashStrings bentzt, freigeben erst nachdem alle Symbole aufgelst  */
- /* wurden.                                                                            */    
+	/* strDirBuf darf hier nicht gelscht werden, da libIdxEntLst den Speicherbereich      */
+ /* direkt als Stringtabelle bentzt.                                                  */    
 	  
 	free(symIndLst);
 	free(symOffLst);
 
+	// Die Namen liegen in der Reihenfolge des Archivs in strDirBuf, symNamOff als zweiter
+	// Schlssel erhlt diese Reihenfolge bei gleichem Hashwert.
+	qsort(libIdxEntLst, symNum, sizeof(myLibIndexEntry), CompareLibIndexEntry);
+
 	lngNamOff= GivNum(secLnkMemHdr.siz, 0, 0x20) + secLnkMemStart + 1;
 	actLibFil-> Seek(lngNamOff, CFile::begin);
 	actLibFil-> Read(&secLnkMemNam, 16);
@@ -275,6 +284,208 @@ BOOL CLibFile::LoadLibFileFromDisc(const char *pszFilNam, CMyMapStringToPtr *&pu
 	actLibFil-> Read(&lngNamHdr, 44);
 	lngNamTabOff= actLibFil-> GetPosition();
 
+	SaveLibIndex(strDirSiz);
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Eintragen des Bibliothekverzeichnisses in das gemeinsame Verzeichnis aller Bibliotheken.   ***/
+/*** Ein echter Eintrag hat immer Vorrang vor einem Alias, ansonsten gilt der erste Eintrag in  ***/
+/*** der Reihenfolge der Bibliotheken. Die Eintrge werden beim ersten Aufruf aus dem Index     ***/
+/*** gebildet, jedes Symbol '_name' erhlt direkt dahinter einen Aliaseintrag fr 'name'.       ***/
+/*** Gleichnamige Symbole liegen im Index in der Reihenfolge des Archivs, innerhalb einer       ***/
+/*** Bibliothek gilt daher wie bisher der erste Eintrag im Archiv.                              ***/
+/**************************************************************************************************/
+
+void CLibFile::AddToComPubList(CMySymbolTable *pubLibSymLst)
+{
+	myPublicLibEntry *pubLibEnt;
+	myLibIndexEntry  *idxEnt;
+	DWORD            i;
+
+	if (!pubLibEntLst)
+	{
+		pubLibEntLst= (myPublicLibEntry *) malloc(2 * symNum * sizeof(myPublicLibEntry) + 1);
+		pubLibEnt= pubLibEntLst;
+		idxEnt= libIdxEntLst;
+
+		for(i= 0; i < symNum; i++, idxEnt++)
+		{
+			pubLibEnt-> achMemSym= libIdxStrTab + idxEnt-> symNamOff;
+			pubLibEnt-> achMemOff= idxEnt-> achMemOff;
+			pubLibEnt-> myLibFil= this;
+			pubLibEnt-> aliEnt= FALSE;
+			pubLibEnt++;
+
+			if (pubLibEnt[-1].achMemSym[0] == '_' && pubLibEnt[-1].achMemSym[1] != '\0')
+			{
+				*pubLibEnt= *(pubLibEnt - 1);
+				pubLibEnt-> aliEnt= TRUE;
+				pubLibEnt++;
+			}
+		}
+		pubLibEntNum= pubLibEnt - pubLibEntLst;
+	}
+
+	// Platz fr alle Symbole der Bibliothek und ihre Aliasnamen im voraus reservieren
+	pubLibSymLst-> InitHashTable(pubLibSymLst-> GetCount() + pubLibEntNum, TRUE);
+
+	pubLibEnt= pubLibEntLst;
+
+	for(i= 0; i < pubLibEntNum; i++, pubLibEnt++)
+	{
+		if (pubLibEnt-> aliEnt)
+		{
+			void *&aliSymEnt= (*pubLibSymLst)[pubLibEnt-> achMemSym + 1];
+			if (!aliSymEnt)
+				aliSymEnt= pubLibEnt;
+		}
+		else
+		{
+			void *&symEnt= (*pubLibSymLst)[pubLibEnt-> achMemSym];
+			if (!symEnt || ((myPublicLibEntry *)symEnt)-> aliEnt)
+				symEnt= pubLibEnt;
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*** Einblenden der Indexdatei. Sie wird nur verwendet, wenn Gre und Zeitstempel der          ***/
+/*** Bibliothek mit den beim Erstellen gespeicherten Werten bereinstimmen.                     ***/
+/**************************************************************************************************/
+
+BOOL CLibFile::LoadLibIndex()
+{
+	myLibIndexHeader *idxHdr;
+	CMapFile         *idxFil;
+	char             *idxFilNam;
+	DWORD            idxFilSiz;
+
+	if (libFilSiz == 0xFFFFFFFF)
+		return FALSE;
+
+	idxFilNam= GiveLibIndexName();
+	idxFil= new CMapFile();
+
+	if (!idxFil-> Open(idxFilNam))
+	{
+		free(idxFilNam);
+		FreeCMapFile(idxFil);
+		delete idxFil;
+		return FALSE;
+	}
+	free(idxFilNam);
+
+	idxFilSiz= idxFil-> GetLength();
+	idxHdr= (myLibIndexHeader *) idxFil-> GetBufferStart();
+
+	if (idxFilSiz < sizeof(myLibIndexHeader) || memcmp(idxHdr-> sig, LIB_IDX_SGN, LIB_IDX_SGN_LEN) ||
+	    idxHdr-> libFilSiz != libFilSiz || CompareFileTime(&idxHdr-> libFilTim, &libFilTim) ||
+	    idxFilSiz != sizeof(myLibIndexHeader) + idxHdr-> symNum * sizeof(myLibIndexEntry) + idxHdr-> strTabSiz)
+	{
+		FreeCMapFile(idxFil);
+		delete idxFil;
+		return FALSE;
+	}
+
+	symNum= idxHdr-> symNum;
+	lngNamTabOff= idxHdr-> lngNamTabOff;
+	staLib= idxHdr-> staLib;
+	libIdxEntLst= (myLibIndexEntry *) (idxHdr + 1);
+	libIdxStrTab= (char *) (libIdxEntLst + symNum);
+	libIdxFil= idxFil;
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Schreiben der Indexdatei. Schlgt das fehl, z.B. in einem schreibgeschtzten Verzeichnis,  ***/
+/*** wird das Verzeichnis beim nchsten Mal wieder aus der Bibliothek gelesen.                  ***/
+/**************************************************************************************************/
+
+BOOL CLibFile::SaveLibIndex(DWORD strTabSiz)
+{
+	myLibIndexHeader idxHdr;
+	HANDLE           idxFil;
+	char             *idxFilNam;
+	DWORD            wrtNum;
+	BOOL             wrtOK;
+
+	if (libFilSiz == 0xFFFFFFFF)
+		return FALSE;
+
+	memcpy(idxHdr.sig, LIB_IDX_SGN, LIB_IDX_SGN_LEN);
+	idxHdr.libFilSiz= libFilSiz;
+	idxHdr.libFilTim= libFilTim;
+	idxHdr.symNum= symNum;
+	idxHdr.strTabSiz= strTabSiz;
+	idxHdr.lngNamTabOff= lngNamTabOff;
+	idxHdr.staLib= staLib;
+
+	idxFilNam= GiveLibIndexName();
+	idxFil= CreateFile(idxFilNam, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (idxFil == INVALID_HANDLE_VALUE)
+	{
+		free(idxFilNam);
+		return FALSE;
+	}
+
+	wrtOK= WriteFile(idxFil, &idxHdr, sizeof(myLibIndexHeader), &wrtNum, NULL) &&
+	       WriteFile(idxFil, libIdxEntLst, symNum * sizeof(myLibIndexEntry), &wrtNum, NULL) &&
+	       WriteFile(idxFil, libIdxStrTab, strTabSiz, &wrtNum, NULL);
+	CloseHandle(idxFil);
+
+	// Eine unvollstndige Indexdatei darf nicht liegen bleiben
+	if (!wrtOK)
+		DeleteFile(idxFilNam);
+
+	free(idxFilNam);
+	return wrtOK;
+}
+
+/**************************************************************************************************/
+/*** Name der Indexdatei: Name der Bibliothek mit der Erweiterung .LIX                          ***/
+/**************************************************************************************************/
+
+char *CLibFile::GiveLibIndexName()
+{
+	char *idxFilNam;
+	char *extPtr;
+
+	idxFilNam= (char *) malloc(strlen(libPthNam) + 5);
+	strcpy(idxFilNam, libPthNam);
+	extPtr= strrchr(idxFilNam, '.');
+	if (extPtr && !strchr(extPtr, '\\'))
+		*extPtr= '\0';
+	strcat(idxFilNam, ".lix");
+
+	return idxFilNam;
+}
+
+/**************************************************************************************************/
+/*** Erneutes Einblenden einer Bibliothek, deren Verzeichnis bereits gelesen wurde. Schlgt     ***/
+/*** fehl, wenn die Datei nicht geffnet werden kann oder sich seitdem gendert hat.            ***/
+/**************************************************************************************************/
+
+BOOL CLibFile::OpenLibFile()
+{
+	CMapFile *libFil;
+	FILETIME filTim;
+	DWORD    filSiz;
+
+	libFil= new CMapFile();
+
+	if (!libFil-> Open(libPthNam) || !libFil-> GiveFileInfo(filSiz, filTim) ||
+	    filSiz != libFilSiz || CompareFileTime(&filTim, &libFilTim))
+	{
+		libFil-> ~CMapFile();       
+		delete libFil;
+		return FALSE;
+	}
+
+	WriteMessageToPow(INF_MSG_FIL_OPE_SUC, libPthNam, NULL);
+	actLibFil= libFil;
 	return TRUE;
 }
 
@@ -333,9 +544,8 @@ CMyMemFile	*CLibFile::ReadLibObjFile(DWORD achMemOff)
  
 	objFilSiz= GivNum(objFilHdr.siz, 0, 0x20);
 	objFil= new CMyMemFile();
-	objFilBuf= (BYTE *) malloc(objFilSiz);
-	actLibFil-> Read(objFilBuf, objFilSiz);
- ((CMyMemFile *)objFil)-> SetBufferDirect(objFilBuf, objFilSiz);
+	objFilBuf= (BYTE *)actLibFil-> ReadWithoutMemcpy(objFilSiz);
+ objFil-> SetBufferDirect(objFilBuf, objFilSiz);
 	
 	return objFil;  
 }
@@ -369,19 +579,15 @@ char *CLibFile::GiveLibNameUp(const char *pszFilNam)
 
 void CLibFile::WritePubLibEntToFile()
 {							
-	myPublicLibEntry *actEnt;
-	LPCTSTR									actSym;
-	POSITION 							mapPos;	
+	myLibIndexEntry *actEnt;
+	DWORD           i;
 	
  logFil = fopen(logFilNam,"a");
 	
-	mapPos= pubLibSymLst-> GetStartPosition();
+	actEnt= libIdxEntLst;
 
-	while(mapPos)
-	{
-		pubLibSymLst-> GetNextAssoc(mapPos, actSym, (void *&)actEnt);
-		fprintf(logFil, "\n%08x     %50s", actEnt-> achMemOff, actSym);
-	}																																
+	for(i= 0; i < symNum; i++, actEnt++)
+		fprintf(logFil, "\n%08x     %50s", actEnt-> achMemOff, libIdxStrTab + actEnt-> symNamOff);
 			
 	fclose(logFil);
 }
@@ -395,6 +601,215 @@ void CLibFile::Close()
 	actLibFil-> Close();
 }
 
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+/*-------------------*/
+/*-- Konstruktoren --*/
+/*-------------------*/
+
+CLibFileCache::CLibFileCache()
+{
+	libFilTab= new CMySymbolTable();
+	libFilTab-> InitHashTable(64, TRUE);
+	cacLibFilLst= new CMyObList();
+	comPubLibSymLst= NULL;
+	comLibFilLst= NULL;
+	comLibFilNum= 0;
+	lnkNum= 0;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+/*------------------*/
+/*-- Destruktoren --*/
+/*------------------*/
+
+CLibFileCache::~CLibFileCache()
+{
+	FreeUsedMemory();
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CLibFileCache::FreeUsedMemory()
+{
+	CLibFile *delLibFil;
+
+	// Die Verzeichnisse zuerst, ihre Schlssel zeigen in den Speicher der Bibliotheken
+	FreeComPubList();
+	if (libFilTab)
+	{
+		FreeCMySymbolTable(libFilTab);
+		delete libFilTab;
+		libFilTab= NULL;
+	}
+	if (cacLibFilLst)
+	{
+		while(!cacLibFilLst-> IsEmpty())
+		{
+			delLibFil= (CLibFile *)cacLibFilLst-> RemoveHead();
+			FreeCLibFile(delLibFil);
+			delete delLibFil;
+		}
+		FreeCMyObList(cacLibFilLst);
+		delete cacLibFilLst;
+		cacLibFilLst= NULL;
+	}
+}
+
+/**************************************************************************************************/
+/*** Rckgabe einer eingeblendeten Bibliothek. Ist ihr Verzeichnis im Cache und die Datei       ***/
+/*** unverndert, entfllt das Lesen des Verzeichnisses, sonst wird es neu gelesen. Eine im     ***/
+/*** selben Linkaufruf schon eingeblendete Bibliothek wird unverndert zurckgegeben.           ***/
+/**************************************************************************************************/
+
+CLibFile *CLibFileCache::GiveLibFile(const char *pszFilNam)
+{
+	CLibFile *libFil;
+
+	if (libFilTab-> Lookup(pszFilNam, (void *&)libFil))
+	{
+		if (libFil-> actLibFil || libFil-> OpenLibFile())
+		{
+			libFil-> lstUseNum= lnkNum;
+			return libFil;
+		}
+		RemoveLibFile(libFil);
+	}
+
+	libFil= new CLibFile();
+	if (!libFil-> LoadLibFileFromDisc(pszFilNam))
+	{
+		FreeCLibFile(libFil);
+		delete libFil;
+		return NULL;
+	}
+
+	libFil-> lstUseNum= lnkNum;
+	(*libFilTab)[libFil-> libPthNam]= libFil;
+	cacLibFilLst-> AddTail(libFil);
+	return libFil;
+}
+
+/**************************************************************************************************/
+/*** Rckgabe des Gesamtverzeichnisses fr die Bibliotheken in libLst. Es wird nur neu gebildet,***/
+/*** wenn sich die Bibliotheken oder ihre Reihenfolge seit dem letzten Linkaufruf gendert haben.***/
+/*** Das Verzeichnis gehrt dem Cache und darf vom Aufrufer nicht verndert werden.             ***/
+/**************************************************************************************************/
+
+CMySymbolTable *CLibFileCache::GiveComPubList(CMyObList *libLst)
+{
+	CLibFile *curLibFil;
+	POSITION libPos;
+	DWORD    i;
+	BOOL     samLib;
+
+	samLib= comPubLibSymLst && comLibFilNum == (DWORD)libLst-> GetCount();
+	libPos= libLst-> GetHeadPosition();
+	for(i= 0; samLib && libPos; i++)
+		samLib= comLibFilLst[i] == (CLibFile *)libLst-> GetNext(libPos);
+
+	if (samLib)
+		return comPubLibSymLst;
+
+	FreeComPubList();
+	comPubLibSymLst= new CMySymbolTable();
+	comPubLibSymLst-> InitHashTable(10000, TRUE);
+	comLibFilLst= (CLibFile **) malloc((libLst-> GetCount() + 1) * sizeof(CLibFile *));
+
+	libPos= libLst-> GetHeadPosition();
+	while(libPos)
+	{
+		curLibFil= (CLibFile *)libLst-> GetNext(libPos);
+		curLibFil-> AddToComPubList(comPubLibSymLst);
+		comLibFilLst[comLibFilNum++]= curLibFil;
+	}
+
+	return comPubLibSymLst;
+}
+
+/**************************************************************************************************/
+/*** Ende eines Linkaufrufs: Die Ansichten der Bibliotheken gehren CObj2Exe::libMapFilLst und  ***/
+/*** werden dort freigegeben. Bibliotheken, die in den letzten LIB_CAC_MAX_UNU_LNK Linkaufrufen ***/
+/*** nicht bentzt wurden, verlassen den Cache.                                                 ***/
+/**************************************************************************************************/
+
+void CLibFileCache::ReleaseLibFiles(CMyObList *libLst)
+{
+	CLibFile *curLibFil;
+	POSITION libPos;
+
+	libPos= libLst-> GetHeadPosition();
+	while(libPos)
+	{
+		curLibFil= (CLibFile *)libLst-> GetNext(libPos);
+		curLibFil-> actLibFil= NULL;
+	}
+
+	libPos= cacLibFilLst-> GetHeadPosition();
+	while(libPos)
+	{
+		curLibFil= (CLibFile *)cacLibFilLst-> GetNext(libPos);
+		if (lnkNum - curLibFil-> lstUseNum >= LIB_CAC_MAX_UNU_LNK)
+			RemoveLibFile(curLibFil);
+	}
+
+	lnkNum++;
+}
+
+/**************************************************************************************************/
+/*** Entfernen einer Bibliothek aus dem Cache. Ist sie Teil des Gesamtverzeichnisses, wird      ***/
+/*** dieses verworfen.                                                                          ***/
+/**************************************************************************************************/
+
+void CLibFileCache::RemoveLibFile(CLibFile *libFil)
+{
+	POSITION libPos;
+	DWORD    i;
+
+	for(i= 0; i < comLibFilNum; i++)
+	{
+		if (comLibFilLst[i] == libFil)
+		{
+			FreeComPubList();
+			break;
+		}
+	}
+
+	libFilTab-> RemoveKey(libFil-> libPthNam);
+	libPos= cacLibFilLst-> Find(libFil);
+	if (libPos)
+		cacLibFilLst-> RemoveAt(libPos);
+	FreeCLibFile(libFil);
+	delete libFil;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CLibFileCache::FreeComPubList()
+{
+	if (comPubLibSymLst)
+	{
+		FreeCMySymbolTable(comPubLibSymLst);
+		delete comPubLibSymLst;
+		comPubLibSymLst= NULL;
+	}
+	if (comLibFilLst)
+	{
+		free(comLibFilLst);
+		comLibFilLst= NULL;
+	}
+	comLibFilNum= 0;
+}
+
 /**************************************************************************************************/
 /*** Umwandeln einer Zahl, die als ASCII-Zeichenkette vorliegt, in ein DWORD		0x49 0x50 => 12			***/
 /**************************************************************************************************/
@@ -410,6 +825,39 @@ DWORD GivNum(BYTE *strNum, WORD start, WORD endSgn)
 	return num;
 }
 
+/**************************************************************************************************/
+/*** Hashwert eines Symbolnamens fr das Bibliotheksverzeichnis (FNV-1a). Er wird in der Index- ***/
+/*** datei gespeichert und darf sich daher nicht ndern, ohne LIB_IDX_SGN anzupassen.           ***/
+/**************************************************************************************************/
+
+DWORD GiveLibSymHash(const char *symNam)
+{
+	DWORD hshVal= 2166136261;
+
+	while(*symNam)
+	{
+		hshVal^= (BYTE)*symNam++;
+		hshVal*= 16777619;
+	}
+	return hshVal;
+}
+
+/**************************************************************************************************/
+/*** Vergleichsfunktion fr qsort: Hashwert, bei gleichem Hashwert die Position im Archiv       ***/
+/**************************************************************************************************/
+
+int CompareLibIndexEntry(const void *ent1, const void *ent2)
+{
+	const myLibIndexEntry *idxEnt1= (const myLibIndexEntry *)ent1;
+	const myLibIndexEntry *idxEnt2= (const myLibIndexEntry *)ent2;
+
+	if (idxEnt1-> hshVal != idxEnt2-> hshVal)
+		return idxEnt1-> hshVal < idxEnt2-> hshVal ? -1 : 1;
+	if (idxEnt1-> symNamOff != idxEnt2-> symNamOff)
+		return idxEnt1-> symNamOff < idxEnt2-> symNamOff ? -1 : 1;
+	return 0;
+}
+
 /**************************************************************************************************/
 /*** Ermitteln und Rckgabe des Dateinamens, wie er im Libraryheader gespeichert ist.											***/
 /**************************************************************************************************/
@@ -32,6 +32,7 @@ class CLibFile : public CObject
 	DECLARE_DYNAMIC(CLibFile)
 	
 	friend class CObj2Exe;
+	friend class CLibFileCache;
 
 	public:
 		char	*filNam;
@@ -40,16 +41,21 @@ class CLibFile : public CObject
 		myLibFileHeader 	actLibFilHdr; 
 		myLibFileHeader		secLnkMemHdr;
 	
-		CMyMapStringToPtr	*pubLibSymLst;
 		//CMapPtrToWord		   *givObjFilLst;
-		CBuffFile							  *actLibFil;
+		CMapFile							   *actLibFil;   // Gehrt CObj2Exe::libMapFilLst
 
 		char	*lstAccObjFil;
 		char	achMemNam[16];
 		char	secLnkMemNam[16];
 		
-  BYTE  *pubLibEntBuf; 
-  BYTE  *strDirBuf; // Speicher fr die Stringtabelle der Library; Wird auch von pubLibSymLst verwendet  
+  BYTE  *strDirBuf; // Speicher fr die Stringtabelle der Library; Wird auch vom Bibliotheksverzeichnis verwendet  
+
+  myLibIndexEntry *libIdxEntLst;  // Bibliotheksverzeichnis, nach Hashwerten sortiert
+  char            *libIdxStrTab;  // Zeigt auf strDirBuf oder in die Ansicht der Indexdatei
+  CMapFile        *libIdxFil;     // Eingeblendete Indexdatei, NULL wenn das Verzeichnis aus der
+                                  // Bibliothek gelesen wurde
+  myPublicLibEntry *pubLibEntLst; // Eintrge fr das gemeinsame Verzeichnis, Aliasnamen eingeschlossen
+  DWORD            pubLibEntNum;
 
 		BYTE		libFilSig[8];
 		DWORD	memNum;
@@ -58,6 +64,11 @@ class CLibFile : public CObject
   WORD  libFilInd;         // Wird von CV-Debuginformation fr sstModules und sstLibraries bentigt
 
   BOOL  staLib;
+
+  char     *libPthNam;     // Vollstndiger Pfad, Schlssel im Bibliothekscache
+  DWORD    libFilSiz;      // Gre und Zeitstempel beim Lesen des Verzeichnisses
+  FILETIME libFilTim;
+  DWORD    lstUseNum;      // Nummer des letzten Linkaufrufs, der die Bibliothek bentzt hat
 											  
  public:
 		CLibFile();
@@ -65,11 +76,14 @@ class CLibFile : public CObject
 
 		void FreeUsedMemory();
 		
-		BOOL LoadLibFileFromDiscOwnPubList(const char *pszFilNam);
-		BOOL LoadLibFileFromDiscComPubList(const char *pszFilNam, CMyMapStringToPtr *&pLibSymLst);
+		BOOL LoadLibFileFromDisc(const char *pszFilNam);
+		void AddToComPubList(CMySymbolTable *pubLibSymLst);
 		
 	private:
-		BOOL LoadLibFileFromDisc(const char *pszFilNam, CMyMapStringToPtr *&pubLibSymLst);
+		BOOL OpenLibFile();
+		BOOL LoadLibIndex();
+		BOOL SaveLibIndex(DWORD strTabSiz);
+		char *GiveLibIndexName();
 		char *GiveLibNameUp(const char *pszFilNam);
 
 	public:
@@ -80,4 +94,38 @@ class CLibFile : public CObject
 		
 };
 
+/**************************************************************************************************/
+/*** Der Bibliothekscache hlt die gelesenen Bibliotheksverzeichnisse und das daraus gebildete  ***/
+/*** Gesamtverzeichnis zwischen zwei Linkaufrufen im Speicher, solange die DLL geladen ist.     ***/
+/*** Die Dateien selbst werden bei jedem Linken neu eingeblendet und dabei auf nderungen       ***/
+/*** (Gre, Zeitstempel) geprft. Genderte Bibliotheken werden neu gelesen.                   ***/
+/**************************************************************************************************/
+
+class CLibFileCache : public CObject
+{
+	DECLARE_DYNAMIC(CLibFileCache)
+
+	private:
+		CMySymbolTable *libFilTab;        // Pfad -> CLibFile
+		CMyObList      *cacLibFilLst;     // Alle Bibliotheken im Cache
+		CMySymbolTable *comPubLibSymLst;  // Gesamtverzeichnis des letzten Linkaufrufs
+		CLibFile       **comLibFilLst;    // Bibliotheken, aus denen comPubLibSymLst gebildet wurde
+		DWORD          comLibFilNum;
+		DWORD          lnkNum;            // Zhler der Linkaufrufe
+
+	public:
+		CLibFileCache();
+		~CLibFileCache();
+
+		void FreeUsedMemory();
+
+		CLibFile *GiveLibFile(const char *pszFilNam);
+		CMySymbolTable *GiveComPubList(CMyObList *libLst);
+		void ReleaseLibFiles(CMyObList *libLst);
+
+	private:
+		void RemoveLibFile(CLibFile *libFil);
+		void FreeComPubList();
+};
+
 #endif	
@@ -33,8 +33,14 @@
 #include "Debug.hpp"
 #endif
 
+#ifndef __LNKSTATE_HPP__
+#include "LnkState.hpp"
+#endif
+
 // Prototypen der klassenunabhngigen Funktionen
 void FreeCObj2Exe(CObj2Exe *aCObj2Exe);
+void FreeCLinkState(CLinkState *aCLinkState);
+void FreeCLibFileCache(CLibFileCache *aCLibFileCache);
 
 
 void MessageOut (FARPROC,char*);
@@ -56,11 +62,27 @@ int		logOn;
 
 BOOL incDebInf;
 BOOL isExeFil;
-BOOL	oneLibLst;
-BOOL	libFilInMem;
 BOOL	heapMsg;
 BOOL	shwDRCMsg;
 
+char *symLogFilNam= "C:\\LINKSYM.LOG";
+FILE *symLogFil;
+BOOL	symLogOn;
+
+BOOL	parRel;                      // Relokationen parallel auflsen
+BOOL	strmExe;                     // PE-Datei direkt auf die Festplatte schreiben
+BOOL	chkUpToDat;                  // Linken entfllt, wenn die PE-Datei laut Linkzustandsdatei aktuell ist
+BOOL	libCacOn;                    // Bibliotheksverzeichnisse zwischen den Linkaufrufen behalten
+BOOL	parLod;                      // Objektdateien parallel laden und zerlegen
+BOOL	lnkAreOn;                    // Kurzlebige Objekte eines Linkvorgangs aus dem Linkspeicher
+BOOL	optRef;                      // Nicht referenzierte Sektionen entfernen (wie /OPT:REF)
+BOOL	optIcf;                      // Identische Sektionen zusammenfassen (wie /OPT:ICF)
+BOOL	incLnk;                      // Genderte Objektdateien inkrementell in die bestehende PE-Datei einsetzen
+BOOL	parDbg;                      // CV Module der Objektdateien parallel vorbereiten
+CLibFileCache *libFilCac= NULL;    // Lebt, solange die DLL geladen ist
+CMyArena *lnkAre= NULL;            // Linkspeicher, nur whrend eines Linkvorgangs angelegt
+CRITICAL_SECTION msgCrtSec;        // Serialisiert die Meldungsausgabe der Threads
+
 
 /**************************************************************************************************/
 /*** Schnittstelle zu POW! (Implementierung des konkreten Vorgehensmodells fr den Linkablauf.  ***/
@@ -71,18 +93,91 @@ int LinkProgram(LPSTR oFilLst[], LPSTR lFilLst[], LPSTR rFil, LPSTR eFil, LPSTR
 																DWORD basAdr, DWORD stackSize)
 {																	
 	CObj2Exe	*newExe;
+	CLinkState *lnkSta= NULL;
 	UINT					startTime, endTime, firstTime;
+	WORD					i;
 	BOOL					lnkOK= TRUE;
 	
 	memset(chrBufCC, 0xCC, 0x200);
 	memset(chrBuf00, 0x00, 0x200);
+	CMyMemFile::alcNum= 0;
+	CMyMemFile::cpyBytNum= 0;
 
 	logOn= FALSE;
-	oneLibLst= TRUE;
-	libFilInMem= FALSE;
 	heapMsg= FALSE;
 	shwDRCMsg= FALSE;
+	symLogOn= FALSE;
+	parRel= TRUE;
+	strmExe= TRUE;
+	chkUpToDat= TRUE;
+	libCacOn= TRUE;
+	parLod= TRUE;
+	lnkAreOn= TRUE;
+	optRef= TRUE;
+	optIcf= TRUE;
+	incLnk= TRUE;
+	parDbg= TRUE;
 	ErrMsgPrc= msg;
+	InitializeCriticalSection(&msgCrtSec);
+
+	// Inkrementelles Linken braucht die Linkzustandsdatei und vertrgt weder Debuginformation
+	// noch entfernte oder zusammengefate Fragmente, deren Pltze spter fehlen wrden
+	if (!chkUpToDat || iDbgInf)
+		incLnk= FALSE;
+	if (incLnk)
+	{
+		optRef= FALSE;
+		optIcf= FALSE;
+	}
+
+	// Alle Eingaben in die Linkzustandsdatei aufnehmen, ist sie aktuell, entfllt das Linken
+	if (chkUpToDat)
+	{
+		lnkSta= new CLinkState(eFil);
+		for (i= 0; oFilLst[i]; i++)
+			lnkSta-> AddInputObject(oFilLst[i]);
+		for (i= 0; lFilLst[i]; i++)
+			lnkSta-> AddInputFile(lFilLst[i]);
+		if (rFil)
+			lnkSta-> AddInputFile(rFil);
+		else
+			lnkSta-> AddInputString(NULL);
+		lnkSta-> AddInputString(stUpSym);
+		for (i= 0; eFncLst && eFncLst[i]; i++)
+			lnkSta-> AddInputString(eFncLst[i]);
+		lnkSta-> AddInputValue(sSys);
+		lnkSta-> AddInputValue(bExeFil);
+		lnkSta-> AddInputValue(bWinNtFil);
+		lnkSta-> AddInputValue(iDbgInf);
+		lnkSta-> AddInputValue(basAdr);
+		lnkSta-> AddInputValue(stackSize);
+
+		if (lnkSta-> IsUpToDate())
+		{
+			WriteMessageToPow(INF_MSG_EXE_UP_TO_DAT, eFil, NULL);
+			FreeCLinkState(lnkSta);
+			delete lnkSta;
+			DeleteCriticalSection(&msgCrtSec);
+			return TRUE;
+		}
+
+		// Haben sich nur Objektdateien gendert, werden ihre Fragmente in die PE-Datei eingesetzt
+		if (incLnk)
+		{
+			startTime= GetTickCount();
+			if (lnkSta-> RelinkChangedObjects())
+			{
+				endTime= GetTickCount();
+				printf("\nInkrementell linken: % 7.3f\n", (endTime - startTime) * 0.001);
+				WriteMessageToPow(INF_MSG_EXE_INC_LNK, eFil, NULL);
+				lnkSta-> Save();
+				FreeCLinkState(lnkSta);
+				delete lnkSta;
+				DeleteCriticalSection(&msgCrtSec);
+				return TRUE;
+			}
+		}
+	}
 
 	if (logOn)
 	{
@@ -105,6 +200,24 @@ int LinkProgram(LPSTR oFilLst[], LPSTR lFilLst[], LPSTR rFil, LPSTR eFil, LPSTR
 	newExe-> basAdr= basAdr;
  newExe-> stackSize= stackSize;
 
+	if (libCacOn)
+	{
+		if (!libFilCac)
+			libFilCac= new CLibFileCache();
+		newExe-> libFilCac= libFilCac;
+	}
+	else if (libFilCac)
+	{
+		FreeCLibFileCache(libFilCac);
+		delete libFilCac;
+		libFilCac= NULL;
+	}
+
+	// Alles, was ab hier angelegt wird, lebt nur bis zum Ende des Linkvorgangs. Der Biblio-
+	// thekscache ist bereits angelegt und nimmt daher keinen Speicher aus lnkAre.
+	if (lnkAreOn)
+		lnkAre= new CMyArena();
+
 	WriteMessageToPow(INF_MSG_INI, NULL, NULL);
 	startTime= GetTickCount();
 	lnkOK= newExe-> InitLinker();
@@ -177,15 +290,38 @@ int LinkProgram(LPSTR oFilLst[], LPSTR lFilLst[], LPSTR rFil, LPSTR eFil, LPSTR
 		TestHeap();
 	}
 
+	if (lnkSta)
+	{
+		if (lnkOK)
+		{
+			if (incLnk)
+				newExe-> RecordLinkLayout(lnkSta);
+			lnkSta-> Save();
+		}
+		else
+			lnkSta-> Remove();
+		FreeCLinkState(lnkSta);
+		delete lnkSta;
+	}
+
 	WriteMessageToPow(INF_MSG_FRE_MEM, NULL, NULL); 
 	startTime= endTime;
 	FreeCObj2Exe(newExe);
 	delete newExe;
+	if (lnkAre)
+	{
+		printf("\nLinkspeicher: %lu Bytes\n", lnkAre-> GetAllocatedBytes());
+		lnkAre-> FreeUsedMemory();
+		delete lnkAre;
+		lnkAre= NULL;
+	}
 	endTime= GetTickCount();
 	printf("\nSpeicher freigeben: % 7.3f\n", (endTime - startTime) * 0.001);
 	TestHeap();
 	endTime= GetTickCount();
 	printf("\nGesamtlinkzeit: % 7.3f\n", (endTime - firstTime) * 0.001);
+	printf("\nCMyMemFile: %lu Allokationen, %lu Bytes umkopiert\n", CMyMemFile::alcNum, CMyMemFile::cpyBytNum);
+	DeleteCriticalSection(&msgCrtSec);
 
 	return lnkOK;
 }						 
@@ -324,6 +460,9 @@ void WriteMessageToPow(WORD msgNr, char *str1, char *str2)
 		case INF_MSG_BLD_DBG:					strcpy(msgBuf, "Linker Message: Build Debuginformation!"); break;
 		case INF_MSG_WRT_PE:						strcpy(msgBuf, "Linker Message: Write PE-File!"); break;
 		case INF_MSG_FRE_MEM:					strcpy(msgBuf, "Linker Message: Free Memory!"); break;
+		case INF_MSG_EXE_UP_TO_DAT:	wsprintf(msgBuf, "Linker Message: %s is up to date!", str1); break;
+		case INF_MSG_EXE_INC_LNK:			wsprintf(msgBuf, "Linker Message: %s was linked incrementally!", str1); break;
+		case INF_MSG_INC_LNK_FUL:			wsprintf(msgBuf, "Linker Message: %s can not be linked incrementally, full link!", str1); break;
 
 		/********************************************************************/
 		/*** Meldungen, die keiner bestimmten Linkphase zugeordnet werden ***/
@@ -450,10 +589,12 @@ void WriteMessageToPow(WORD msgNr, char *str1, char *str2)
 
 	if (shwMsg)
 	{
+		EnterCriticalSection(&msgCrtSec);
 		if (ErrMsgPrc)
 			MessageOut(ErrMsgPrc, msgBuf);
 		else
 			printf("\n%s", msgBuf);
+		LeaveCriticalSection(&msgCrtSec);
 	}
 }
 
@@ -539,6 +680,14 @@ void FreeCObj2Exe(CObj2Exe *aCObj2Exe)
 }
 
 /**************************************************************************************************/
+
+void FreeCLinkState(CLinkState *aCLinkState)
+{
+	aCLinkState-> ~CLinkState();
+}
+
+/**************************************************************************************************/
+
 void FreeCSection(CSection *aCSection)
 {
 	aCSection-> ~CSection();
@@ -617,6 +766,13 @@ void FreeCLibFile(CLibFile *aCLibFile)
 
 /**************************************************************************************************/
 
+void FreeCLibFileCache(CLibFileCache *aCLibFileCache)
+{
+	aCLibFileCache-> ~CLibFileCache();
+}
+
+/**************************************************************************************************/
+
 void FreeCObjFile(CObjFile *aCObjFile)
 {
 	aCObjFile-> ~CObjFile();
@@ -687,6 +843,13 @@ void FreeCMyMapStringToPtr(CMyMapStringToPtr *aCMyMapStringToPtr)
 
 /**************************************************************************************************/
 
+void FreeCMySymbolTable(CMySymbolTable *aCMySymbolTable)
+{
+	aCMySymbolTable-> ~CMySymbolTable();
+}
+
+/**************************************************************************************************/
+
 void FreeCFile(CFile *aCFile)
 {
 	aCFile-> ~CFile();
@@ -708,6 +871,13 @@ void FreeCMyMemFile(CMyMemFile *aCMyMemFile)
 
 /**************************************************************************************************/
 
+void FreeCMapFile(CMapFile *aCMapFile)
+{
+	aCMapFile-> ~CMapFile();
+}
+
+/**************************************************************************************************/
+
 void FreeCMyPtrList(CMyPtrList *aCMyPtrList)
 {
 	aCMyPtrList-> ~CMyPtrList();
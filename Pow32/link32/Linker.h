@@ -65,6 +65,7 @@ class	CExeFile;
 class CDllExportEntry;
 class CSectionFragmentEntry;
 class	CResFileEntry;
+class CResUniCodeString;
 
 class CString;
 class CMemFile;
@@ -86,9 +87,6 @@ class CMemFile;
 #define CV_SUB_SEC_DIR_ENT_SIZ 0x0C				// Gre des Eintrags des CV Subsection Tabelle
 #define SST_SEG_MAP_ENT_SIZ    0x14				// Gre des Eintrags der CV SST_SEG_MAP
 
-#define	HIGH_RES_TYP_NUM       0x20				//	Hchste Typnummer eines Ressourcetyps, die verabeitet
-																																							//	wird
-
 #define REL_ENT_SIZ      10												//	Gre eines Eintrags der Relokationen
 	
 #define	EXE_COF_HDR_SIZ            20					// Gre des COFF-Headers im EXE-File 						
@@ -100,6 +98,14 @@ class CMemFile;
 #define DBG_DIR_ENT_MAX												3						// Derzeit werden MISC, FPO und CV Debugformate unterstzt, daher
 																																										// hchsten drei Eintrge im Debugdirectory
 
+#define MAX_RES_REL_THR          7				// Hchstzahl zustzlicher Threads beim Auflsen der Relokationen
+#define MAX_LOD_OBJ_THR          7				// Hchstzahl zustzlicher Threads beim Laden der Objektdateien
+#define MAX_CV_MOD_THR           7				// Hchstzahl zustzlicher Threads beim Erstellen der CV Module
+#define RES_REL_FRG_PER_JOB     32				// Sektionsfragmente je Teilauftrag beim Auflsen der Relokationen
+#define LIB_CAC_MAX_UNU_LNK      8				// Linkaufrufe, nach denen eine unbentzte Bibliothek den Cache verlt
+#define INC_LNK_SLK_DIV          4				// Reserve hinter einem Fragment beim inkrementellen Linken: ein Viertel
+#define INC_LNK_SLK_MIN       0x40				// seiner Gre, mindestens jedoch 0x40 Bytes
+
 
 /*** Festlegung verschiedener Symboltypen ***/
 
@@ -193,13 +199,37 @@ struct mySymbolEntry
  char            *expTabSymNam;
 };
 
-/*** Bibliotheksverzeichniseintrag der Symbole in den Libraries ***/
+/*** Bibliotheksverzeichniseintrag der Symbole in den Libraries. Die Eintrge sind nach dem ***/
+/*** Hashwert und bei gleichem Hashwert nach der Reihenfolge im Archiv sortiert.             ***/
+
+struct myLibIndexEntry
+{
+ DWORD hshVal;        // FNV-1a Hashwert des Symbolnamens
+ DWORD symNamOff;     // Offset des Symbolnamens in der Stringtabelle
+ DWORD achMemOff;     // Dateioffset des Archivmembers
+};
+
+/*** Eintrag des gemeinsamen Verzeichnisses aller Bibliotheken, aus dem Index gebildet ***/
 
 struct myPublicLibEntry
 {
  char     *achMemSym;
  DWORD    achMemOff;
  CLibFile *myLibFil;
+ BOOL     aliEnt;      // Eintrag fr achMemSym ohne fhrenden '_'
+};
+
+/*** Kopf der Indexdatei (.LIX) einer Bibliothek, es folgen die Eintrge und die Stringtabelle ***/
+
+struct myLibIndexHeader
+{
+ BYTE     sig[8];
+ DWORD    libFilSiz;    // Gre und Zeitstempel der Bibliothek beim Erstellen des Index
+ FILETIME libFilTim;
+ DWORD    symNum;
+ DWORD    strTabSiz;
+ DWORD    lngNamTabOff;
+ DWORD    staLib;
 };
 
 /*** COFF Relokationseintrag ***/
@@ -770,7 +800,7 @@ struct mySstGloTypInfRec
 	DWORD	typRefNmb;
 	BYTE		*typRawDat;
 	DWORD	sstGloTypInd;
-	WORD		pad;
+	WORD		typMapSta;	// Zustand beim Zuordnen des globalen Typindexes, siehe MapTypeRecord
 };
 
 #endif  // __LINKER_H__
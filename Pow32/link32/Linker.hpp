@@ -32,6 +32,9 @@
 #define INF_MSG_BLD_DBG								0x0006
 #define INF_MSG_WRT_PE									0x0007
 #define INF_MSG_FRE_MEM								0x0008
+#define INF_MSG_EXE_UP_TO_DAT		0x0009
+#define INF_MSG_EXE_INC_LNK			0x000A
+#define INF_MSG_INC_LNK_FUL			0x000B
 
 
 // Erfolgreiches ffnen einer Datei
@@ -0,0 +1,1458 @@
+/**************************************************************************************************/
+/*** Die Datei LnkState.cpp beinhaltet die Implementierung folgender Klassen:                   ***/
+/***			CLinkState                                                                           ***/
+/**************************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+#ifndef __LNKSTATE_HPP__
+#include "LnkState.hpp"
+#endif
+
+#ifndef __LINKER_HPP__
+#include "Linker.hpp"
+#endif
+
+#ifndef __EXEFILE_HPP__
+#include "ExeFile.hpp"
+#endif
+
+#ifndef __OBJFILE_HPP__
+#include "ObjFile.hpp"
+#endif
+
+#ifndef __SECTION_HPP__
+#include "Section.hpp"
+#endif
+
+#ifndef __PUBLIBEN_HPP__
+#include "PubLibEn.hpp"
+#endif
+
+extern void WriteMessageToPow(WORD msgNr, char *str1, char *str2);
+
+extern DWORD	CalcTimeDateStamp();    // In Linker.cpp definiert
+
+extern void FreeCMyMemFile(CMyMemFile *aCMyMemFile);
+extern void FreeCObjFile(CObjFile *aCObjFile);
+extern void FreeCExeFileRelocSection(CExeFileRelocSection *aCExeFileRelocSection);
+extern void FreeCMyMapStringToPtr(CMyMapStringToPtr *aCMyMapStringToPtr);
+
+IMPLEMENT_DYNAMIC(CLinkState, CObject)
+
+#define LNK_STA_SGN  "POWLKS02"           // Kennung und Version der Linkzustandsdatei
+#define LNK_STA_SGN_LEN  8
+
+#define LNK_STA_TYP_FIL  0x01             // Eingabedatei: Name, Gre, Zeitstempel
+#define LNK_STA_TYP_STR  0x02             // Zeichenkette einer Linkoption
+#define LNK_STA_TYP_VAL  0x03             // Zahlenwert einer Linkoption
+#define LNK_STA_TYP_EXE  0x04             // Erzeugte PE-Datei: Gre, Zeitstempel
+#define LNK_STA_TYP_OBJ  0x05             // Objektdatei des Linkaufrufs: Name, Gre, Zeitstempel
+#define LNK_STA_TYP_LAY  0x06             // Anordnung der PE-Datei, siehe myLnkStaLayout
+
+#define LNK_STA_EXE_REC_LEN  (sizeof(BYTE) + sizeof(DWORD) + sizeof(FILETIME))
+
+#define LNK_STA_PE_HDR_OFF  0x80          // PE-Signatur hinter dem DOS-Stub, siehe CExeFile::BuildExeFileHeaders
+#define LNK_STA_NO_IND      0xFFFFFFFF
+
+/**************************************************************************************************/
+/*** Lnge eines Eintrags im Block der Eingaben, 0 wenn er unvollstndig ist                    ***/
+/**************************************************************************************************/
+
+static DWORD GiveRecordLength(BYTE *recBuf, DWORD bufLen)
+{
+	BYTE  *strEnd;
+	DWORD recLen;
+
+	if (!bufLen)
+		return 0;
+
+	switch(recBuf[0])
+	{
+		case LNK_STA_TYP_FIL:
+		case LNK_STA_TYP_OBJ:
+		case LNK_STA_TYP_STR:
+			strEnd= (BYTE *) memchr(recBuf + sizeof(BYTE), '\0', bufLen - sizeof(BYTE));
+			if (!strEnd)
+				return 0;
+			recLen= strEnd - recBuf + 1;
+			if (recBuf[0] != LNK_STA_TYP_STR)
+				recLen+= sizeof(DWORD) + sizeof(FILETIME);
+			break;
+		case LNK_STA_TYP_VAL:
+			recLen= sizeof(BYTE) + sizeof(DWORD);
+			break;
+		default:
+			return 0;
+	}
+
+	return recLen <= bufLen ? recLen : 0;
+}
+
+/**************************************************************************************************/
+/*** Vergleich zweier .RELOC Adressen fr qsort                                                 ***/
+/**************************************************************************************************/
+
+static int __cdecl CompareRelAdr(const void *relAdr1, const void *relAdr2)
+{
+	if (*(DWORD *)relAdr1 < *(DWORD *)relAdr2)
+		return -1;
+	return *(DWORD *)relAdr1 > *(DWORD *)relAdr2 ? 1 : 0;
+}
+
+/**************************************************************************************************/
+/*** Anhngen des Inhalts von srcDat an dstDat                                                  ***/
+/**************************************************************************************************/
+
+static void AppendMemFile(CMyMemFile *dstDat, CMyMemFile *srcDat)
+{
+	DWORD srcLen;
+
+	srcLen= srcDat-> GetLength();
+	if (!srcLen)
+		return;
+	srcDat-> SeekToBegin();
+	dstDat-> Write(srcDat-> ReadWithoutMemcpy(srcLen), srcLen);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+/*-------------------*/
+/*-- Konstruktoren --*/
+/*-------------------*/
+
+CLinkState::CLinkState(char *eFilNam)
+{
+	char *extPtr;
+
+	exeFilNam= (char *) malloc(strlen(eFilNam) + 1);
+	strcpy(exeFilNam, eFilNam);
+
+	// Zustandsdatei: Name der PE-Datei mit der Erweiterung .LKS
+	staFilNam= (char *) malloc(strlen(eFilNam) + 5);
+	strcpy(staFilNam, eFilNam);
+	extPtr= strrchr(staFilNam, '.');
+	if (extPtr && !strchr(extPtr, '\\'))
+		*extPtr= '\0';
+	strcat(staFilNam, ".lks");
+
+	lnkStaDat= new CMyMemFile();
+	lnkStaDat-> Write(LNK_STA_SGN, LNK_STA_SGN_LEN);
+	lnkLayDat= NULL;
+
+	oldStaBuf= NULL;
+	oldStaLen= 0;
+	oldInpLen= 0;
+	lnkLay= NULL;
+	frgTab= NULL;
+	symTab= NULL;
+	impTab= NULL;
+	sitTab= NULL;
+	relTab= NULL;
+	strTab= NULL;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+/*------------------*/
+/*-- Destruktoren --*/
+/*------------------*/
+
+CLinkState::~CLinkState()
+{
+	FreeUsedMemory();
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CLinkState::FreeUsedMemory()
+{
+	if (lnkStaDat)
+	{
+		FreeCMyMemFile(lnkStaDat);
+		delete lnkStaDat;
+		lnkStaDat= NULL;
+	}
+	if (lnkLayDat)
+	{
+		FreeCMyMemFile(lnkLayDat);
+		delete lnkLayDat;
+		lnkLayDat= NULL;
+	}
+	if (exeFilNam)
+	{
+		free(exeFilNam);
+		exeFilNam= NULL;
+	}
+	if (staFilNam)
+	{
+		free(staFilNam);
+		staFilNam= NULL;
+	}
+	if (oldStaBuf)
+	{
+		free(oldStaBuf);
+		oldStaBuf= NULL;
+	}
+	lnkLay= NULL;
+	frgTab= NULL;
+	symTab= NULL;
+	impTab= NULL;
+	sitTab= NULL;
+	relTab= NULL;
+	strTab= NULL;
+}
+
+/**************************************************************************************************/
+/*** Ermitteln von Gre und Zeitstempel der letzten nderung einer Datei.                      ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::GiveFileInfo(char *filNam, DWORD &filSiz, FILETIME &filTim)
+{
+	WIN32_FIND_DATA filDat;
+	HANDLE										fndHdl;
+
+	fndHdl= FindFirstFile(filNam, &filDat);
+	if (fndHdl == INVALID_HANDLE_VALUE)
+		return FALSE;
+	FindClose(fndHdl);
+
+	filSiz= filDat.nFileSizeLow;
+	filTim= filDat.ftLastWriteTime;
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Aufnehmen einer Eingabedatei. Ist sie nicht vorhanden, werden Gre und Zeitstempel Null   ***/
+/*** gespeichert, das Linken findet dann auf jeden Fall statt und meldet den Fehler.            ***/
+/**************************************************************************************************/
+
+void CLinkState::AddInputRecord(BYTE typ, char *filNam)
+{
+	FILETIME filTim;
+	DWORD				filSiz;
+
+	if (!GiveFileInfo(filNam, filSiz, filTim))
+	{
+		filSiz= 0;
+		memset(&filTim, 0x00, sizeof(FILETIME));
+	}
+
+	lnkStaDat-> Write(&typ, sizeof(BYTE));
+	lnkStaDat-> Write(filNam, strlen(filNam) + 1);
+	lnkStaDat-> Write(&filSiz, sizeof(DWORD));
+	lnkStaDat-> Write(&filTim, sizeof(FILETIME));
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CLinkState::AddInputFile(char *filNam)
+{
+	AddInputRecord(LNK_STA_TYP_FIL, filNam);
+}
+
+/**************************************************************************************************/
+/*** Objektdateien des Linkaufrufs werden eigens gekennzeichnet, nur sie drfen sich fr das    ***/
+/*** inkrementelle Linken gendert haben.                                                       ***/
+/**************************************************************************************************/
+
+void CLinkState::AddInputObject(char *filNam)
+{
+	AddInputRecord(LNK_STA_TYP_OBJ, filNam);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CLinkState::AddInputString(char *str)
+{
+	BYTE typ= LNK_STA_TYP_STR;
+
+	lnkStaDat-> Write(&typ, sizeof(BYTE));
+	if (str)
+		lnkStaDat-> Write(str, strlen(str) + 1);
+	else
+		lnkStaDat-> WriteZero(sizeof(char));
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CLinkState::AddInputValue(DWORD val)
+{
+	BYTE typ= LNK_STA_TYP_VAL;
+
+	lnkStaDat-> Write(&typ, sizeof(BYTE));
+	lnkStaDat-> Write(&val, sizeof(DWORD));
+}
+
+/**************************************************************************************************/
+/*** Vergleich der aktuellen Eingaben mit der Zustandsdatei. Die gespeicherte Datei besteht aus ***/
+/*** dem Block der Eingaben, dem Eintrag der damals erzeugten PE-Datei und gegebenenfalls deren ***/
+/*** Anordnung fr das inkrementelle Linken.                                                    ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::IsUpToDate()
+{
+	CFile										staFil;
+	CFileException filErr;
+	FILETIME							exeFilTim;
+	FILETIME							oldExeFilTim;
+
+	BYTE  *inpBuf;
+	BYTE  *oldBuf;
+	DWORD inpLen;
+	DWORD oldLen;
+	DWORD exeFilSiz;
+	DWORD oldExeFilSiz;
+	BOOL  upToDat= FALSE;
+
+	if (!GiveFileInfo(exeFilNam, exeFilSiz, exeFilTim))
+		return FALSE;
+
+	if (!staFil.Open(staFilNam, CFile::modeRead | CFile::typeBinary, &filErr))
+		return FALSE;
+
+	inpLen= lnkStaDat-> GetLength();
+	oldLen= staFil.GetLength();
+
+	if (oldLen >= inpLen + LNK_STA_EXE_REC_LEN)
+	{
+		oldBuf= (BYTE *) malloc(oldLen);
+		if (staFil.Read(oldBuf, oldLen) == oldLen)
+		{
+			lnkStaDat-> SeekToBegin();
+			inpBuf= (BYTE *) lnkStaDat-> ReadWithoutMemcpy(inpLen);
+			memcpy(&oldExeFilSiz, oldBuf + inpLen + sizeof(BYTE), sizeof(DWORD));
+			memcpy(&oldExeFilTim, oldBuf + inpLen + sizeof(BYTE) + sizeof(DWORD), sizeof(FILETIME));
+
+			upToDat= !memcmp(inpBuf, oldBuf, inpLen) && oldBuf[inpLen] == LNK_STA_TYP_EXE &&
+			         oldExeFilSiz == exeFilSiz && !CompareFileTime(&oldExeFilTim, &exeFilTim);
+		}
+		free(oldBuf);
+	}
+
+	staFil.Close();
+	return upToDat;
+}
+
+/**************************************************************************************************/
+/*** Festhalten der Anordnung der PE-Datei nach einem vollstndigen Linklauf: Fragmente der     ***/
+/*** Objektdateien des Linkaufrufs samt Reserve, ihre externen Symbole, die Auflsung ihrer     ***/
+/*** undefinierten Symbole, alle Stellen der PE-Datei, die auf diese Symbole verweisen, sowie   ***/
+/*** die .RELOC Adressliste. Mu vor dem Freigeben der Objektdateien aufgerufen werden.         ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::RecordLayout(CExeFile *exeFil)
+{
+	CExeFileDataSection   *frgSecLst[4];
+	CExeFileDataSection   *exeSec;
+	CSectionFragmentEntry *aFrgEnt;
+	CObjFileSection       *aSec;
+	CObjFile              *aObjFil;
+	CMapPtrToPtr          *objIndLst;
+	CMapPtrToPtr          *symIndLst;
+	CMyMemFile            *frgDat;
+	CMyMemFile            *symDat;
+	CMyMemFile            *impDat;
+	CMyMemFile            *sitDat;
+	CMyMemFile            *strDat;
+	myRelocationEntry     *relEnt;
+	mySymbolEntry         *aSym;
+	mySymbolEntry         *resSym;
+	myLnkStaLayout        newLay;
+	myLnkStaFragment      newFrg;
+	myLnkStaSymbol        newSym;
+	myLnkStaImport        newImp;
+	myLnkStaSite          newSit;
+	POSITION              objPos;
+	POSITION              frgPos;
+
+	DWORD objInd;
+	DWORD symInd;
+	DWORD relInd;
+	DWORD datDirOff;
+	DWORD i, l;
+	WORD  secInd;
+
+	memset(&newLay, 0, sizeof(myLnkStaLayout));
+
+	// Objektdateien des Linkaufrufs, der Index ist um eins erhht, damit er nie NULL ist
+	objIndLst= new CMapPtrToPtr();
+	objPos= exeFil-> srcObjFilLst-> GetHeadPosition();
+	while(objPos)
+		objIndLst-> SetAt(exeFil-> srcObjFilLst-> GetNext(objPos), (void *)++newLay.objNum);
+
+	if (newLay.objNum >= LNK_STA_NO_OBJ)
+	{
+		objIndLst-> RemoveAll();
+		delete objIndLst;
+		return FALSE;
+	}
+
+	symIndLst= new CMapPtrToPtr();
+	frgDat= new CMyMemFile();
+	symDat= new CMyMemFile();
+	impDat= new CMyMemFile();
+	sitDat= new CMyMemFile();
+	strDat= new CMyMemFile();
+
+	/*** Fragmente der Objektdateien des Linkaufrufs, in der Reihenfolge ihrer Adressen ***/
+
+	frgSecLst[0]= exeFil-> textSec;
+	frgSecLst[1]= exeFil-> bssSec;
+	frgSecLst[2]= exeFil-> rdataSec;
+	frgSecLst[3]= exeFil-> dataSec;
+
+	for(i= 0; i < 4; i++)
+	{
+		exeSec= frgSecLst[i];
+		frgPos= exeSec-> secFrgLst-> GetHeadPosition();
+		while(frgPos)
+		{
+			aFrgEnt= (CSectionFragmentEntry *)exeSec-> secFrgLst-> GetNext(frgPos);
+			if (!objIndLst-> Lookup(aFrgEnt-> secFrgObjFil, (void *&)objInd))
+				continue;
+
+			aSec= aFrgEnt-> myHomSec;
+			aObjFil= aFrgEnt-> secFrgObjFil;
+			for(secInd= 0; secInd < aObjFil-> objCofHdr.secNum; secInd++)
+				if (aObjFil-> secLst-> GetAt(secInd) == aSec)
+					break;
+
+			newFrg.secNamOff= AddString(strDat, aSec-> secNam);
+			newFrg.secChr= aSec-> actSecTab-> chr;
+			newFrg.objInd= (WORD)(objInd - 1);
+			newFrg.secInd= secInd + 1;
+			newFrg.frgAdr= exeSec-> virSecAdr + aFrgEnt-> secFrgOff;
+			newFrg.filOff= exeSec == exeFil-> bssSec ? 0 : exeSec-> actSecTab-> rawDatPtr + aFrgEnt-> secFrgOff;
+			newFrg.frgSiz= aFrgEnt-> rawDatSiz;
+			newFrg.frgCap= aFrgEnt-> frgCap;
+			frgDat-> Write(&newFrg, sizeof(myLnkStaFragment));
+			newLay.frgNum++;
+		}
+	}
+
+	/*** Externe Symbole, die in einem Fragment einer Objektdatei des Linkaufrufs liegen ***/
+
+	objInd= 0;
+	objPos= exeFil-> srcObjFilLst-> GetHeadPosition();
+	while(objPos)
+	{
+		aObjFil= (CObjFile *)exeFil-> srcObjFilLst-> GetNext(objPos);
+		for(l= 0; l < aObjFil-> objCofHdr.symNum; l++)
+		{
+			aSym= aObjFil-> newSymLst[l];
+			if (!aSym || aSym-> actSymTab-> storClass != IMAGE_SYM_CLASS_EXTERNAL || (short) aSym-> actSymTab-> secNum <= 0)
+				continue;
+			aSec= (CObjFileSection *)aObjFil-> secLst-> GetAt(aSym-> actSymTab-> secNum - 1);
+			if (!aSec-> actFrgEnt)
+				continue;
+
+			newSym.symNamOff= AddString(strDat, aSym-> symNam);
+			newSym.symAdr= aSec-> actFrgEnt-> actExeSec-> virSecAdr + aSec-> actFrgEnt-> secFrgOff + aSym-> val;
+			newSym.objInd= (WORD) objInd;
+			newSym.secInd= aSym-> actSymTab-> secNum;
+			symDat-> Write(&newSym, sizeof(myLnkStaSymbol));
+			symIndLst-> SetAt(aSym, (void *)++newLay.symNum);
+		}
+		objInd++;
+	}
+
+	/*** Auflsung der undefinierten Symbole und .BSS Variablen, wie in CObjFile::AddSymEnt ***/
+
+	objInd= 0;
+	objPos= exeFil-> srcObjFilLst-> GetHeadPosition();
+	while(objPos)
+	{
+		aObjFil= (CObjFile *)exeFil-> srcObjFilLst-> GetNext(objPos);
+		for(l= 0; l < aObjFil-> objCofHdr.symNum; l++)
+		{
+			aSym= aObjFil-> newSymLst[l];
+			if (!aSym || aSym-> actSymTab-> secNum || aSym-> symNam[0] == '.' ||
+			    aSym-> actSymTab-> storClass == IMAGE_SYM_CLASS_WEAK_EXTERNAL)
+				continue;
+
+			resSym= aSym-> resSym;
+			newImp.impSiz= 0;
+			if (aSym-> dllExpEnt)
+			{
+				newImp.impTyp= LNK_STA_IMP_DLL;
+				newImp.impVal= aSym-> dllExpEnt-> textSegOff;
+				newImp.impSiz= aSym-> dllExpEnt-> idataLookupTabOff;
+			}
+			else if (!resSym)
+				continue;
+			else if (resSym-> bssOff)
+			{
+				newImp.impTyp= LNK_STA_IMP_BSS;
+				newImp.impVal= resSym-> bssOff;
+				newImp.impSiz= aSym-> val;
+			}
+			else if ((short) resSym-> actSymTab-> secNum > 0)
+			{
+				if (symIndLst-> Lookup(resSym, (void *&)symInd))
+				{
+					newImp.impTyp= LNK_STA_IMP_SYM;
+					newImp.impVal= symInd - 1;
+				}
+				else
+				{
+					aSec= (CObjFileSection *)resSym-> symObjFil-> secLst-> GetAt(resSym-> actSymTab-> secNum - 1);
+					if (!aSec-> actFrgEnt)
+						continue;
+					newImp.impTyp= LNK_STA_IMP_ADR;
+					newImp.impVal= aSec-> actFrgEnt-> actExeSec-> virSecAdr + aSec-> actFrgEnt-> secFrgOff + resSym-> val;
+				}
+			}
+			else if ((short) resSym-> actSymTab-> secNum < 0)
+			{
+				newImp.impTyp= LNK_STA_IMP_ABS;
+				newImp.impVal= resSym-> val;
+			}
+			else
+				continue;
+
+			newImp.symNamOff= AddString(strDat, aSym-> symNam);
+			newImp.objInd= (WORD) objInd;
+			impDat-> Write(&newImp, sizeof(myLnkStaImport));
+			newLay.impNum++;
+		}
+		objInd++;
+	}
+
+	/*** Stellen in den Fragmenten aller Objektdateien, die auf ein Symbol einer anderen ***/
+	/*** Objektdatei des Linkaufrufs verweisen                                           ***/
+
+	objPos= exeFil-> objFilLst-> GetHeadPosition();
+	while(objPos)
+	{
+		aObjFil= (CObjFile *)exeFil-> objFilLst-> GetNext(objPos);
+		if (!objIndLst-> Lookup(aObjFil, (void *&)objInd))
+			objInd= 0;
+
+		for(l= 0; l < aObjFil-> objCofHdr.secNum; l++)
+		{
+			aSec= (CObjFileSection *)aObjFil-> secLst-> GetAt(l);
+			aFrgEnt= aSec-> actFrgEnt;
+			if (!aSec-> secRelBuf || !aFrgEnt || aFrgEnt-> myHomSec != aSec || !aFrgEnt-> frgRef)
+				continue;
+			exeSec= aFrgEnt-> actExeSec;
+			if (exeSec != exeFil-> textSec && exeSec != exeFil-> rdataSec && exeSec != exeFil-> dataSec)
+				continue;
+
+			for(relInd= 0; relInd < aSec-> actSecTab-> relNum; relInd++)
+			{
+				relEnt= (myRelocationEntry *)(aSec-> secRelBuf + 10 * relInd);
+				aSym= aObjFil-> newSymLst[relEnt-> symTabInd];
+				if (!aSym || aSym-> dllExpEnt || !aSym-> resSym || aSym-> resSym-> symObjFil == aObjFil)
+					continue;
+				if (!symIndLst-> Lookup(aSym-> resSym, (void *&)symInd))
+					continue;
+
+				// relEnt-> off ist nach CSectionFragmentEntry::ResRel bereits die RVA der Stelle
+				newSit.symInd= symInd - 1;
+				newSit.filOff= exeSec-> actSecTab-> rawDatPtr + relEnt-> off - exeSec-> virSecAdr;
+				newSit.objInd= objInd ? (WORD)(objInd - 1) : LNK_STA_NO_OBJ;
+				if (relEnt-> off + sizeof(DWORD) > exeSec-> virSecAdr + aFrgEnt-> secFrgOff + aFrgEnt-> rawDatSiz)
+					newSit.relTyp= 0;
+				else
+					newSit.relTyp= relEnt-> typ;
+				sitDat-> Write(&newSit, sizeof(myLnkStaSite));
+				newLay.sitNum++;
+			}
+		}
+	}
+
+	// Exportadretabelle und Startadresse im Dateikopf
+	if (exeFil-> edataSec)
+	{
+		i= 0;
+		frgPos= exeFil-> edataSec-> expFncLst-> GetHeadPosition();
+		while(frgPos)
+		{
+			aSym= (mySymbolEntry *)exeFil-> edataSec-> expFncLst-> GetNext(frgPos);
+			if (symIndLst-> Lookup(aSym, (void *&)symInd))
+			{
+				newSit.symInd= symInd - 1;
+				newSit.filOff= exeFil-> edataSec-> actSecTab-> rawDatPtr + EXP_DIR_TAB_SIZ + i * sizeof(DWORD);
+				newSit.objInd= LNK_STA_NO_OBJ;
+				newSit.relTyp= IMAGE_REL_I386_DIR32NB;
+				sitDat-> Write(&newSit, sizeof(myLnkStaSite));
+				newLay.sitNum++;
+			}
+			i++;
+		}
+	}
+
+	if (exeFil-> textSec-> startUpSym && symIndLst-> Lookup(exeFil-> textSec-> startUpSym, (void *&)symInd))
+	{
+		newSit.symInd= symInd - 1;
+		newSit.filOff= LNK_STA_PE_HDR_OFF + sizeof(DWORD) + EXE_COF_HDR_SIZ + offsetof(myOptionalHeaderStandardFields, entPntAdr);
+		newSit.objInd= LNK_STA_NO_OBJ;
+		newSit.relTyp= IMAGE_REL_I386_DIR32NB;
+		sitDat-> Write(&newSit, sizeof(myLnkStaSite));
+		newLay.sitNum++;
+	}
+
+	/*** Kopf der Anordnung ***/
+
+	datDirOff= LNK_STA_PE_HDR_OFF + sizeof(DWORD) + EXE_COF_HDR_SIZ + EXE_OPT_HDR_STD_FDS_SIZ + EXE_OPT_HDR_NT_SPC_FDS_SIZ;
+
+	newLay.imgBas= exeFil-> exeOptHdrNtSpcFds.imgBas;
+	newLay.secAln= exeFil-> exeOptHdrNtSpcFds.secAln;
+	newLay.filAln= exeFil-> exeOptHdrNtSpcFds.filAln;
+	newLay.timDatStpOff= LNK_STA_PE_HDR_OFF + sizeof(DWORD) + offsetof(myCoffHeader, timDatStp);
+	newLay.relSizOff= datDirOff + offsetof(myOptionalHeaderDataDirectory, relSiz);
+	newLay.relSecTabOff= datDirOff + EXE_OPT_HDR_DATA_DIR_SIZ + (exeFil-> relocSec-> secNum - 1) * SEC_HDR_SIZ;
+	newLay.relRawDatPtr= exeFil-> relocSec-> actSecTab-> rawDatPtr;
+	newLay.relRawDatSiz= exeFil-> relocSec-> actSecTab-> rawDatSiz;
+	newLay.relNum= exeFil-> relocSec-> relLst-> GetSize();
+	newLay.strTabSiz= strDat-> GetLength();
+
+	if (lnkLayDat)
+	{
+		FreeCMyMemFile(lnkLayDat);
+		delete lnkLayDat;
+	}
+	lnkLayDat= new CMyMemFile();
+	lnkLayDat-> Write(&newLay, sizeof(myLnkStaLayout));
+	AppendMemFile(lnkLayDat, frgDat);
+	AppendMemFile(lnkLayDat, symDat);
+	AppendMemFile(lnkLayDat, impDat);
+	AppendMemFile(lnkLayDat, sitDat);
+	if (newLay.relNum)
+		lnkLayDat-> Write(exeFil-> relocSec-> relLst-> GetData(), newLay.relNum * sizeof(DWORD));
+	AppendMemFile(lnkLayDat, strDat);
+
+	objIndLst-> RemoveAll();
+	delete objIndLst;
+	symIndLst-> RemoveAll();
+	delete symIndLst;
+	FreeCMyMemFile(frgDat);
+	delete frgDat;
+	FreeCMyMemFile(symDat);
+	delete symDat;
+	FreeCMyMemFile(impDat);
+	delete impDat;
+	FreeCMyMemFile(sitDat);
+	delete sitDat;
+	FreeCMyMemFile(strDat);
+	delete strDat;
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Anhngen einer Zeichenkette an die Stringtabelle, Rckgabe ist ihr Offset                  ***/
+/**************************************************************************************************/
+
+DWORD CLinkState::AddString(CMyMemFile *strDat, char *str)
+{
+	DWORD strOff;
+
+	strOff= strDat-> GetLength();
+	strDat-> Write(str, strlen(str) + 1);
+	return strOff;
+}
+
+/**************************************************************************************************/
+/*** Einlesen der Zustandsdatei des letzten Linklaufs. oldInpLen ist die Lnge des Blocks der   ***/
+/*** Eingaben, dahinter folgt der Eintrag der PE-Datei.                                         ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::ReadOldState()
+{
+	CFile										staFil;
+	CFileException filErr;
+
+	DWORD recLen;
+
+	if (!staFil.Open(staFilNam, CFile::modeRead | CFile::typeBinary, &filErr))
+		return FALSE;
+
+	oldStaLen= staFil.GetLength();
+	oldStaBuf= (BYTE *) malloc(oldStaLen + 1);
+	if (staFil.Read(oldStaBuf, oldStaLen) != oldStaLen)
+	{
+		staFil.Close();
+		return FALSE;
+	}
+	staFil.Close();
+
+	if (oldStaLen < LNK_STA_SGN_LEN || memcmp(oldStaBuf, LNK_STA_SGN, LNK_STA_SGN_LEN))
+		return FALSE;
+
+	oldInpLen= LNK_STA_SGN_LEN;
+	while(oldInpLen < oldStaLen && oldStaBuf[oldInpLen] != LNK_STA_TYP_EXE)
+	{
+		recLen= GiveRecordLength(oldStaBuf + oldInpLen, oldStaLen - oldInpLen);
+		if (!recLen)
+			return FALSE;
+		oldInpLen+= recLen;
+	}
+
+	return oldInpLen + LNK_STA_EXE_REC_LEN <= oldStaLen;
+}
+
+/**************************************************************************************************/
+/*** Zerlegen der Anordnung hinter dem Eintrag der PE-Datei und Prfen aller Indizes            ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::ParseLayout()
+{
+	DWORD layPos;
+	DWORD layLen;
+	DWORD i;
+
+	layPos= oldInpLen + LNK_STA_EXE_REC_LEN;
+	if (layPos + sizeof(BYTE) + sizeof(myLnkStaLayout) > oldStaLen || oldStaBuf[layPos] != LNK_STA_TYP_LAY)
+		return FALSE;
+
+	lnkLay= (myLnkStaLayout *)(oldStaBuf + layPos + sizeof(BYTE));
+	layLen= sizeof(myLnkStaLayout) + lnkLay-> frgNum * sizeof(myLnkStaFragment) + lnkLay-> symNum * sizeof(myLnkStaSymbol) +
+	        lnkLay-> impNum * sizeof(myLnkStaImport) + lnkLay-> sitNum * sizeof(myLnkStaSite) +
+	        lnkLay-> relNum * sizeof(DWORD) + lnkLay-> strTabSiz;
+	if (layPos + sizeof(BYTE) + layLen != oldStaLen || !lnkLay-> strTabSiz)
+		return FALSE;
+
+	frgTab= (myLnkStaFragment *)(lnkLay + 1);
+	symTab= (myLnkStaSymbol *)(frgTab + lnkLay-> frgNum);
+	impTab= (myLnkStaImport *)(symTab + lnkLay-> symNum);
+	sitTab= (myLnkStaSite *)(impTab + lnkLay-> impNum);
+	relTab= (DWORD *)(sitTab + lnkLay-> sitNum);
+	strTab= (char *)(relTab + lnkLay-> relNum);
+
+	if (strTab[lnkLay-> strTabSiz - 1])
+		return FALSE;
+
+	for(i= 0; i < lnkLay-> frgNum; i++)
+		if (frgTab[i].secNamOff >= lnkLay-> strTabSiz || frgTab[i].objInd >= lnkLay-> objNum || !frgTab[i].secInd)
+			return FALSE;
+	for(i= 0; i < lnkLay-> symNum; i++)
+		if (symTab[i].symNamOff >= lnkLay-> strTabSiz || symTab[i].objInd >= lnkLay-> objNum)
+			return FALSE;
+	for(i= 0; i < lnkLay-> impNum; i++)
+		if (impTab[i].symNamOff >= lnkLay-> strTabSiz || impTab[i].objInd >= lnkLay-> objNum ||
+		    (impTab[i].impTyp == LNK_STA_IMP_SYM && impTab[i].impVal >= lnkLay-> symNum))
+			return FALSE;
+	for(i= 0; i < lnkLay-> sitNum; i++)
+		if (sitTab[i].symInd >= lnkLay-> symNum || (sitTab[i].objInd != LNK_STA_NO_OBJ && sitTab[i].objInd >= lnkLay-> objNum))
+			return FALSE;
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Vergleich der Eingaben mit denen des letzten Linklaufs. Nur Gre und Zeitstempel von      ***/
+/*** Objektdateien des Linkaufrufs drfen sich unterscheiden, diese werden in chgObjLst         ***/
+/*** markiert. objNamLst zeigt auf die Namen der Objektdateien.                                 ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::GiveChangedObjects(char **objNamLst, BOOL *chgObjLst, DWORD &chgObjNum)
+{
+	BYTE  *inpBuf;
+
+	DWORD inpLen;
+	DWORD inpPos;
+	DWORD oldPos;
+	DWORD recLen;
+	DWORD namLen;
+	DWORD objInd= 0;
+
+	inpLen= lnkStaDat-> GetLength();
+	lnkStaDat-> SeekToBegin();
+	inpBuf= (BYTE *) lnkStaDat-> ReadWithoutMemcpy(inpLen);
+
+	chgObjNum= 0;
+	inpPos= oldPos= LNK_STA_SGN_LEN;
+	while(inpPos < inpLen && oldPos < oldInpLen)
+	{
+		recLen= GiveRecordLength(inpBuf + inpPos, inpLen - inpPos);
+		if (!recLen || recLen != GiveRecordLength(oldStaBuf + oldPos, oldInpLen - oldPos) ||
+		    inpBuf[inpPos] != oldStaBuf[oldPos])
+			return FALSE;
+
+		if (inpBuf[inpPos] == LNK_STA_TYP_OBJ)
+		{
+			namLen= recLen - sizeof(DWORD) - sizeof(FILETIME);
+			if (objInd >= lnkLay-> objNum || memcmp(inpBuf + inpPos, oldStaBuf + oldPos, namLen))
+				return FALSE;
+			objNamLst[objInd]= (char *)inpBuf + inpPos + sizeof(BYTE);
+			chgObjLst[objInd]= memcmp(inpBuf + inpPos + namLen, oldStaBuf + oldPos + namLen, recLen - namLen) != 0;
+			if (chgObjLst[objInd])
+				chgObjNum++;
+			objInd++;
+		}
+		else if (memcmp(inpBuf + inpPos, oldStaBuf + oldPos, recLen))
+			return FALSE;
+
+		inpPos+= recLen;
+		oldPos+= recLen;
+	}
+
+	return inpPos == inpLen && oldPos == oldInpLen && objInd == lnkLay-> objNum;
+}
+
+/**************************************************************************************************/
+/*** Auflsen eines Symbols einer genderten Objektdatei. Symbole der Objektdatei selbst liegen ***/
+/*** in ihren alten Fragmenten, undefinierte Symbole werden wie im letzten Linklauf aufgelst.  ***/
+/*** Neue Verweise sind nur auf Symbole mglich, die schon damals in der PE-Datei lagen.        ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::ResolveSymbol(CObjFile *objFil, WORD objInd, mySymbolEntry *aSym, CMyMapStringToPtr *objImpLst,
+                               CMyMapStringToPtr *symNamLst, CMyMapStringToPtr *impNamLst, DWORD *frgIndLst,
+                               DWORD *newSymAdr, myLnkStaResolve &symRes)
+{
+	myLnkStaImport *aImp;
+
+	DWORD impInd;
+	DWORD symInd;
+	short secNum;
+	BOOL  comVar;
+
+	symRes.symImp= NULL;
+	symRes.symInd= LNK_STA_NO_IND;
+	symRes.symAdr= 0;
+	symRes.symVal= 0;
+	symRes.absSym= FALSE;
+
+	if (aSym-> actSymTab-> storClass == IMAGE_SYM_CLASS_WEAK_EXTERNAL)
+		return FALSE;
+
+	secNum= (short) aSym-> actSymTab-> secNum;
+	if (secNum > 0)
+	{
+		if ((WORD) secNum > objFil-> objCofHdr.secNum || !frgIndLst[secNum - 1])
+			return FALSE;
+		symRes.symAdr= frgTab[frgIndLst[secNum - 1] - 1].frgAdr;
+		symRes.symVal= aSym-> val;
+		return TRUE;
+	}
+
+	if (secNum == IMAGE_SYM_ABSOLUTE)
+	{
+		symRes.absSym= TRUE;
+		symRes.symVal= aSym-> val;
+		return TRUE;
+	}
+
+	if (secNum < 0 || aSym-> symNam[0] == '.')
+		return FALSE;
+
+	comVar= aSym-> val && strncmp(aSym-> symNam, "__F", strlen("__F"));
+
+	if (objImpLst-> Lookup(aSym-> symNam, (void *&)impInd))
+		aImp= impTab + impInd - 1;
+	else if (comVar)
+		return FALSE;
+	else if (symNamLst-> Lookup(aSym-> symNam, (void *&)symInd))
+	{
+		if (symTab[symInd - 1].objInd == objInd)
+			return FALSE;
+		symRes.symInd= symInd - 1;
+		symRes.symAdr= newSymAdr[symInd - 1];
+		return TRUE;
+	}
+	else if (impNamLst-> Lookup(aSym-> symNam, (void *&)impInd))
+		aImp= impTab + impInd - 1;
+	else
+		return FALSE;
+
+	// .BSS Variablen mssen gleich gro bleiben, siehe CExeFileBssSection::SetBssVarOff
+	if (aImp-> impTyp == LNK_STA_IMP_BSS)
+	{
+		if (aImp-> impSiz != aSym-> val)
+			return FALSE;
+	}
+	else if (comVar)
+		return FALSE;
+
+	switch(aImp-> impTyp)
+	{
+		case LNK_STA_IMP_SYM:	symRes.symInd= aImp-> impVal;
+																								symRes.symAdr= newSymAdr[aImp-> impVal];
+																								break;
+		case LNK_STA_IMP_ADR:	symRes.symAdr= aImp-> impVal;
+																								break;
+		case LNK_STA_IMP_ABS:	symRes.absSym= TRUE;
+																								symRes.symVal= aImp-> impVal;
+																								break;
+		case LNK_STA_IMP_BSS:
+		case LNK_STA_IMP_DLL:	symRes.symImp= aImp;
+																								break;
+		default:											return FALSE;
+	}
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Prfen einer genderten Objektdatei: Ihre Sektionen mssen die alten Fragmente mit hch-   ***/
+/*** stens deren Platz sein, die externen Symbole dieselben wie im letzten Linklauf und alle     ***/
+/*** undefinierten Symbole auflsbar. frgIndLst ordnet jeder Sektion ihr altes Fragment zu,     ***/
+/*** newSymAdr erhlt die neuen Adressen der externen Symbole.                                  ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::CheckChangedObject(CObjFile *objFil, WORD objInd, DWORD *frgIndLst, CMyMapStringToPtr *objImpLst,
+                                    CMyMapStringToPtr *symNamLst, CMyMapStringToPtr *impNamLst, DWORD *newSymAdr)
+{
+	CObjFileSection  *aSec;
+	myLnkStaFragment *aFrg;
+	mySymbolEntry    *aSym;
+	myLnkStaResolve  symRes;
+
+	DWORD frgInd;
+	DWORD symInd;
+	DWORD extNum= 0;
+	DWORD oldExtNum= 0;
+	DWORD i;
+	char  *secNam;
+
+	if (objFil-> incDllFun)
+		return FALSE;
+
+	for(frgInd= 0; frgInd < lnkLay-> frgNum; frgInd++)
+	{
+		aFrg= frgTab + frgInd;
+		if (aFrg-> objInd != objInd)
+			continue;
+		if (aFrg-> secInd > objFil-> objCofHdr.secNum)
+			return FALSE;
+
+		aSec= (CObjFileSection *)objFil-> secLst-> GetAt(aFrg-> secInd - 1);
+		secNam= strTab + aFrg-> secNamOff;
+		if (strcmp(aSec-> secNam, secNam) || aSec-> actSecTab-> chr != aFrg-> secChr ||
+		    aSec-> actSecTab-> rawDatSiz > aFrg-> frgCap)
+			return FALSE;
+		// Gruppierte Fragmente (.CRT$XCU, ...) haben keine Reserve und bilden lckenlose Tabellen
+		if (strchr(secNam, '$') && aSec-> actSecTab-> rawDatSiz != aFrg-> frgSiz)
+			return FALSE;
+		frgIndLst[aFrg-> secInd - 1]= frgInd + 1;
+	}
+
+	// Jede weitere Sektion ergbe ein neues Fragment, siehe CObjFileSection::WrapFromObj2Exe
+	for(i= 0; i < objFil-> objCofHdr.secNum; i++)
+	{
+		if (frgIndLst[i])
+			continue;
+		aSec= (CObjFileSection *)objFil-> secLst-> GetAt(i);
+		switch(aSec-> actSecTab-> chr & 0xFF)
+		{
+			case 0x40:
+			case 0x48:	if (strncmp(aSec-> secNam, ".debug$", strlen(".debug$")))
+													return FALSE;
+												break;
+			case 0x20:
+			case 0x80:	return FALSE;
+			default:			if (strcmp(aSec-> secNam, ".drectve"))
+													return FALSE;
+		}
+	}
+
+	for(i= 0; i < objFil-> objCofHdr.symNum; i++)
+	{
+		aSym= objFil-> newSymLst[i];
+		if (!aSym)
+			continue;
+
+		if (aSym-> actSymTab-> storClass == IMAGE_SYM_CLASS_EXTERNAL && (short) aSym-> actSymTab-> secNum)
+		{
+			// Absolute externe Symbole haben andere Objektdateien als Wert bernommen
+			if ((short) aSym-> actSymTab-> secNum < 0)
+				return FALSE;
+			if (!symNamLst-> Lookup(aSym-> symNam, (void *&)symInd) || symTab[symInd - 1].objInd != objInd)
+				return FALSE;
+			if (!ResolveSymbol(objFil, objInd, aSym, objImpLst, symNamLst, impNamLst, frgIndLst, newSymAdr, symRes))
+				return FALSE;
+			newSymAdr[symInd - 1]= symRes.symAdr + symRes.symVal;
+			extNum++;
+		}
+		else if (aSym-> actSymTab-> storClass == IMAGE_SYM_CLASS_WEAK_EXTERNAL)
+			return FALSE;
+		else if (!aSym-> actSymTab-> secNum && aSym-> symNam[0] != '.')
+		{
+			if (!ResolveSymbol(objFil, objInd, aSym, objImpLst, symNamLst, impNamLst, frgIndLst, newSymAdr, symRes))
+				return FALSE;
+		}
+	}
+
+	for(symInd= 0; symInd < lnkLay-> symNum; symInd++)
+		if (symTab[symInd].objInd == objInd)
+			oldExtNum++;
+
+	return extNum == oldExtNum;
+}
+
+/**************************************************************************************************/
+/*** Aufbauen eines genderten Fragments an seinem alten Platz: Rohdaten samt Reserve in frgBuf,***/
+/*** Auflsen der Relokationen mit den Behandlungsroutinen von CSectionFragmentEntry, neue      ***/
+/*** .RELOC Adressen in relLst und neue Stellen, die auf andere Objektdateien verweisen, in     ***/
+/*** sitDat.                                                                                    ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::RelocateFragment(CObjFile *objFil, WORD objInd, myLnkStaFragment *aFrg, DWORD *frgIndLst,
+                                  CMyMapStringToPtr *objImpLst, CMyMapStringToPtr *symNamLst, CMyMapStringToPtr *impNamLst,
+                                  DWORD *newSymAdr, BYTE *frgBuf, CDWordArray *relLst, CMyMemFile *sitDat)
+{
+	CObjFileSection   *aSec;
+	myRelocationEntry *relEnt;
+	mySymbolEntry     *actSym;
+	mySymbolEntry     resSym;
+	myLnkStaResolve   symRes;
+	myRelFixup        relFix;
+	myLnkStaSite      newSit;
+
+	DWORD rawDatSiz;
+	DWORD relInd;
+
+	aSec= (CObjFileSection *)objFil-> secLst-> GetAt(aFrg-> secInd - 1);
+	rawDatSiz= aSec-> actSecTab-> rawDatSiz;
+
+	// Lcken im Code werden wie beim vollstndigen Linken mit INT 3 gefllt
+	memset(frgBuf, (aFrg-> secChr & 0xFF) == 0x20 ? 0xCC : 0x00, aFrg-> frgCap);
+	if (rawDatSiz)
+	{
+		aSec-> secRawDat-> SeekToBegin();
+		memcpy(frgBuf, aSec-> secRawDat-> ReadWithoutMemcpy(rawDatSiz), rawDatSiz);
+	}
+
+	memset(&resSym, 0, sizeof(mySymbolEntry));
+
+	for(relInd= 0; relInd < aSec-> actSecTab-> relNum; relInd++)
+	{
+		relEnt= (myRelocationEntry *)(aSec-> secRelBuf + 10 * relInd);
+
+		// Stellen am Ende eines zu kurzen Fragments werden nur beim vollstndigen Linken behandelt
+		if (relEnt-> off + sizeof(DWORD) > rawDatSiz || relEnt-> symTabInd >= objFil-> objCofHdr.symNum)
+			return FALSE;
+		actSym= objFil-> newSymLst[relEnt-> symTabInd];
+		if (!actSym || !ResolveSymbol(objFil, objInd, actSym, objImpLst, symNamLst, impNamLst, frgIndLst, newSymAdr, symRes))
+			return FALSE;
+
+		relFix.actSym= actSym;
+		relFix.resSym= &resSym;
+		relFix.dllSym= FALSE;
+		relFix.relNed= FALSE;
+		relFix.resSymSecFrgOff= symRes.symAdr;
+		relFix.imBase= symRes.absSym ? 0 : lnkLay-> imgBas;
+		resSym.val= symRes.symVal;
+		resSym.bssOff= 0;
+
+		if (symRes.symImp)
+		{
+			if (symRes.symImp-> impTyp == LNK_STA_IMP_DLL)
+			{
+				relFix.dllSym= TRUE;
+				relFix.dllTxtSegOff= symRes.symImp-> impVal;
+				relFix.dllLokUpTabOff= symRes.symImp-> impSiz;
+			}
+			else
+			{
+				// .BSS Variablen lst CSectionFragmentEntry::ResRel nur fr DIR32 und DIR32NB auf
+				if (relEnt-> typ != IMAGE_REL_I386_DIR32 && relEnt-> typ != IMAGE_REL_I386_DIR32NB)
+					return FALSE;
+				resSym.bssOff= symRes.symImp-> impVal;
+			}
+		}
+
+		relFix.adrBuf= *(DWORD UNALIGNED *)(frgBuf + relEnt-> off);
+		relFix.nxtInsAdr= aFrg-> frgAdr + relEnt-> off + sizeof(DWORD);
+
+		if (!CSectionFragmentEntry::FixupRelocation(relEnt-> typ, &relFix))
+			return FALSE;
+
+		*(DWORD UNALIGNED *)(frgBuf + relEnt-> off)= relFix.adrBuf;
+		if (relFix.relNed)
+			relLst-> Add(aFrg-> frgAdr + relEnt-> off);
+
+		if (symRes.symInd != LNK_STA_NO_IND)
+		{
+			newSit.symInd= symRes.symInd;
+			newSit.filOff= aFrg-> filOff + relEnt-> off;
+			newSit.objInd= objInd;
+			newSit.relTyp= relEnt-> typ;
+			sitDat-> Write(&newSit, sizeof(myLnkStaSite));
+		}
+	}
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Inkrementelles Linken: Haben sich seit dem letzten Linklauf nur Objektdateien des Link-    ***/
+/*** aufrufs gendert, werden ihre Fragmente neu aufgebaut und an ihren alten Platz in die PE-  ***/
+/*** Datei geschrieben. Verweise anderer Objektdateien auf verschobene Symbole, die .RELOC      ***/
+/*** Sektion und der Zeitstempel werden korrigiert. Rckgabe FALSE, wenn vollstndig gelinkt    ***/
+/*** werden mu: ein Fragment wchst ber seine Reserve, Sektionen oder externe Symbole einer    ***/
+/*** Objektdatei kommen hinzu oder fallen weg, oder ein neuer Verweis ist nicht auflsbar.      ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::RelinkChangedObjects()
+{
+	CFile																exeFil;
+	CFileException							filErr;
+	CExeFile												*dumExeFil;
+	CExeFileRelocSection *relSec= NULL;
+	CObjFile												**objFilLst;
+	CMyMapStringToPtr				**objImpLstLst;
+	CMyMapStringToPtr				*symNamLst;
+	CMyMapStringToPtr				*impNamLst;
+	CMyMemFile										*sitDat;
+	CDWordArray									*relLst;
+	myLnkStaFragment					*aFrg;
+	myLnkStaSite								*aSit;
+	FILETIME												exeFilTim;
+	FILETIME												oldExeFilTim;
+
+	BYTE  **frgBufLst;
+	BYTE  *relBuf;
+	char  **objNamLst;
+	BOOL  *chgObjLst;
+	DWORD **frgIndLstLst;
+	DWORD *newSymAdr;
+	DWORD exeFilSiz;
+	DWORD oldExeFilSiz;
+	DWORD chgObjNum;
+	DWORD objInd;
+	DWORD frgInd;
+	DWORD symInd;
+	DWORD impInd;
+	DWORD relInd;
+	DWORD relAdr;
+	DWORD patVal;
+	DWORD timDatStp;
+	DWORD relDatSiz;
+	char  secNamBuf[9];
+	BOOL  lnkOK;
+
+	if (!ReadOldState() || !ParseLayout())
+		return FALSE;
+
+	// Die PE-Datei mu noch die des letzten Linklaufs sein
+	if (!GiveFileInfo(exeFilNam, exeFilSiz, exeFilTim))
+		return FALSE;
+	memcpy(&oldExeFilSiz, oldStaBuf + oldInpLen + sizeof(BYTE), sizeof(DWORD));
+	memcpy(&oldExeFilTim, oldStaBuf + oldInpLen + sizeof(BYTE) + sizeof(DWORD), sizeof(FILETIME));
+	if (oldExeFilSiz != exeFilSiz || CompareFileTime(&oldExeFilTim, &exeFilTim))
+		return FALSE;
+
+	objNamLst= (char **) malloc((lnkLay-> objNum + 1) * sizeof(char *));
+	chgObjLst= (BOOL *) malloc((lnkLay-> objNum + 1) * sizeof(BOOL));
+	if (!GiveChangedObjects(objNamLst, chgObjLst, chgObjNum) || !chgObjNum)
+	{
+		free(objNamLst);
+		free(chgObjLst);
+		return FALSE;
+	}
+
+	objFilLst= (CObjFile **) calloc(lnkLay-> objNum, sizeof(CObjFile *));
+	objImpLstLst= (CMyMapStringToPtr **) calloc(lnkLay-> objNum, sizeof(CMyMapStringToPtr *));
+	frgIndLstLst= (DWORD **) calloc(lnkLay-> objNum, sizeof(DWORD *));
+	frgBufLst= (BYTE **) calloc(lnkLay-> frgNum + 1, sizeof(BYTE *));
+	newSymAdr= (DWORD *) malloc((lnkLay-> symNum + 1) * sizeof(DWORD));
+	for(symInd= 0; symInd < lnkLay-> symNum; symInd++)
+		newSymAdr[symInd]= symTab[symInd].symAdr;
+
+	// Die Objektdateien werden nur zerlegt, nicht in eine PE-Datei eingetragen
+	dumExeFil= new CExeFile();
+	dumExeFil-> includeDebugInfo= 0;
+
+	symNamLst= new CMyMapStringToPtr(lnkLay-> symNum + 1);
+	for(symInd= 0; symInd < lnkLay-> symNum; symInd++)
+		symNamLst-> SetAt(strTab + symTab[symInd].symNamOff, (void *)(symInd + 1));
+
+	impNamLst= new CMyMapStringToPtr();
+	for(impInd= 0; impInd < lnkLay-> impNum; impInd++)
+		if (impTab[impInd].impTyp != LNK_STA_IMP_SYM && impTab[impInd].impTyp != LNK_STA_IMP_BSS &&
+		    !impNamLst-> Lookup(strTab + impTab[impInd].symNamOff, (void *&)relAdr))
+			impNamLst-> SetAt(strTab + impTab[impInd].symNamOff, (void *)(impInd + 1));
+
+	relLst= new CDWordArray();
+	sitDat= new CMyMemFile();
+	lnkOK= TRUE;
+
+	/*** Laden und Prfen der genderten Objektdateien ***/
+
+	for(objInd= 0; objInd < lnkLay-> objNum && lnkOK; objInd++)
+	{
+		if (!chgObjLst[objInd])
+			continue;
+
+		objFilLst[objInd]= new CObjFile();
+		objFilLst[objInd]-> SetExeFile(dumExeFil);
+		objFilLst[objInd]-> libObjFil= FALSE;
+		if (!objFilLst[objInd]-> ReadObjFileFromDisc(objNamLst[objInd]))
+		{
+			lnkOK= FALSE;
+			break;
+		}
+
+		objImpLstLst[objInd]= new CMyMapStringToPtr();
+		for(impInd= 0; impInd < lnkLay-> impNum; impInd++)
+			if (impTab[impInd].objInd == objInd)
+				objImpLstLst[objInd]-> SetAt(strTab + impTab[impInd].symNamOff, (void *)(impInd + 1));
+
+		frgIndLstLst[objInd]= (DWORD *) calloc(objFilLst[objInd]-> objCofHdr.secNum + 1, sizeof(DWORD));
+		lnkOK= CheckChangedObject(objFilLst[objInd], (WORD) objInd, frgIndLstLst[objInd], objImpLstLst[objInd],
+		                          symNamLst, impNamLst, newSymAdr);
+	}
+
+	/*** Verschobene Symbole: Stellen in unvernderten Objektdateien mssen korrigierbar sein ***/
+
+	for(relInd= 0; relInd < lnkLay-> sitNum && lnkOK; relInd++)
+	{
+		aSit= sitTab + relInd;
+		if (aSit-> objInd != LNK_STA_NO_OBJ && chgObjLst[aSit-> objInd])
+			continue;
+
+		sitDat-> Write(aSit, sizeof(myLnkStaSite));
+		if (newSymAdr[aSit-> symInd] == symTab[aSit-> symInd].symAdr)
+			continue;
+		if (aSit-> relTyp != IMAGE_REL_I386_DIR32 && aSit-> relTyp != IMAGE_REL_I386_DIR32NB &&
+		    aSit-> relTyp != IMAGE_REL_I386_SECREL && aSit-> relTyp != IMAGE_REL_I386_REL32)
+			lnkOK= FALSE;
+	}
+
+	/*** Aufbauen der genderten Fragmente, .BSS Fragmente haben keine Rohdaten ***/
+
+	for(frgInd= 0; frgInd < lnkLay-> frgNum && lnkOK; frgInd++)
+	{
+		aFrg= frgTab + frgInd;
+		if (!chgObjLst[aFrg-> objInd] || !aFrg-> filOff)
+			continue;
+
+		frgBufLst[frgInd]= (BYTE *) malloc(aFrg-> frgCap + 1);
+		lnkOK= RelocateFragment(objFilLst[aFrg-> objInd], aFrg-> objInd, aFrg, frgIndLstLst[aFrg-> objInd],
+		                        objImpLstLst[aFrg-> objInd], symNamLst, impNamLst, newSymAdr, frgBufLst[frgInd],
+		                        relLst, sitDat);
+	}
+
+	/*** .RELOC Sektion: alte Adressen auerhalb der genderten Fragmente und die neuen ***/
+
+	if (lnkOK)
+	{
+		frgInd= 0;
+		for(relInd= 0; relInd < lnkLay-> relNum; relInd++)
+		{
+			relAdr= relTab[relInd];
+			while(frgInd < lnkLay-> frgNum && (!chgObjLst[frgTab[frgInd].objInd] || !frgTab[frgInd].filOff ||
+			      relAdr >= frgTab[frgInd].frgAdr + frgTab[frgInd].frgCap))
+				frgInd++;
+			if (frgInd < lnkLay-> frgNum && relAdr >= frgTab[frgInd].frgAdr)
+				continue;
+			relLst-> Add(relAdr);
+		}
+
+		if (relLst-> GetSize())
+		{
+			qsort(relLst-> GetData(), relLst-> GetSize(), sizeof(DWORD), CompareRelAdr);
+			relSec= new CExeFileRelocSection(strcpy(secNamBuf, ".reloc"), 0);
+			for(relInd= 0; relInd < (DWORD) relLst-> GetSize(); relInd++)
+				relSec-> relLst-> Add(relLst-> GetAt(relInd));
+			relSec-> BuildRelSec((WORD) lnkLay-> secAln, (WORD) lnkLay-> filAln);
+			lnkOK= relSec-> actSecTab-> virSiz <= lnkLay-> relRawDatSiz;
+		}
+		else
+			lnkOK= FALSE;
+	}
+
+	if (lnkOK)
+		lnkOK= exeFil.Open(exeFilNam, CFile::modeReadWrite | CFile::typeBinary, &filErr);
+
+	/*** Schreiben in die PE-Datei ***/
+
+	if (lnkOK)
+	{
+		for(frgInd= 0; frgInd < lnkLay-> frgNum; frgInd++)
+		{
+			if (!frgBufLst[frgInd])
+				continue;
+			exeFil.Seek(frgTab[frgInd].filOff, CFile::begin);
+			exeFil.Write(frgBufLst[frgInd], frgTab[frgInd].frgCap);
+		}
+
+		for(relInd= 0; relInd < lnkLay-> sitNum; relInd++)
+		{
+			aSit= sitTab + relInd;
+			if ((aSit-> objInd != LNK_STA_NO_OBJ && chgObjLst[aSit-> objInd]) ||
+			    newSymAdr[aSit-> symInd] == symTab[aSit-> symInd].symAdr)
+				continue;
+			exeFil.Seek(aSit-> filOff, CFile::begin);
+			exeFil.Read(&patVal, sizeof(DWORD));
+			patVal+= newSymAdr[aSit-> symInd] - symTab[aSit-> symInd].symAdr;
+			exeFil.Seek(aSit-> filOff, CFile::begin);
+			exeFil.Write(&patVal, sizeof(DWORD));
+		}
+
+		relDatSiz= min(relSec-> secRawDatSiz, lnkLay-> relRawDatSiz);
+		relBuf= (BYTE *) calloc(lnkLay-> relRawDatSiz + 1, sizeof(BYTE));
+		relSec-> secRawDat-> SeekToBegin();
+		memcpy(relBuf, relSec-> secRawDat-> ReadWithoutMemcpy(relDatSiz), relDatSiz);
+		exeFil.Seek(lnkLay-> relRawDatPtr, CFile::begin);
+		exeFil.Write(relBuf, lnkLay-> relRawDatSiz);
+		free(relBuf);
+
+		exeFil.Seek(lnkLay-> relSecTabOff + offsetof(mySectionTable, virSiz), CFile::begin);
+		exeFil.Write(&relSec-> actSecTab-> virSiz, sizeof(DWORD));
+		exeFil.Seek(lnkLay-> relSizOff, CFile::begin);
+		exeFil.Write(&relSec-> actSecTab-> virSiz, sizeof(DWORD));
+
+		timDatStp= CalcTimeDateStamp();
+		exeFil.Seek(lnkLay-> timDatStpOff, CFile::begin);
+		exeFil.Write(&timDatStp, sizeof(DWORD));
+		exeFil.Close();
+
+		// Neue Anordnung: Gren der genderten Fragmente, Adressen der Symbole, Stellen und .RELOC
+		for(frgInd= 0; frgInd < lnkLay-> frgNum; frgInd++)
+		{
+			aFrg= frgTab + frgInd;
+			if (chgObjLst[aFrg-> objInd])
+				aFrg-> frgSiz= ((CObjFileSection *)objFilLst[aFrg-> objInd]-> secLst-> GetAt(aFrg-> secInd - 1))-> actSecTab-> rawDatSiz;
+		}
+		for(symInd= 0; symInd < lnkLay-> symNum; symInd++)
+			symTab[symInd].symAdr= newSymAdr[symInd];
+
+		lnkLayDat= new CMyMemFile();
+		lnkLay-> sitNum= sitDat-> GetLength() / sizeof(myLnkStaSite);
+		lnkLay-> relNum= relSec-> relLst-> GetSize();
+		lnkLayDat-> Write(lnkLay, sizeof(myLnkStaLayout));
+		lnkLayDat-> Write(frgTab, lnkLay-> frgNum * sizeof(myLnkStaFragment));
+		lnkLayDat-> Write(symTab, lnkLay-> symNum * sizeof(myLnkStaSymbol));
+		lnkLayDat-> Write(impTab, lnkLay-> impNum * sizeof(myLnkStaImport));
+		AppendMemFile(lnkLayDat, sitDat);
+		lnkLayDat-> Write(relSec-> relLst-> GetData(), lnkLay-> relNum * sizeof(DWORD));
+		lnkLayDat-> Write(strTab, lnkLay-> strTabSiz);
+	}
+	else
+		WriteMessageToPow(INF_MSG_INC_LNK_FUL, exeFilNam, NULL);
+
+	/*** Freigeben ***/
+
+	for(objInd= 0; objInd < lnkLay-> objNum; objInd++)
+	{
+		if (objFilLst[objInd])
+		{
+			FreeCObjFile(objFilLst[objInd]);
+			delete objFilLst[objInd];
+		}
+		if (objImpLstLst[objInd])
+		{
+			FreeCMyMapStringToPtr(objImpLstLst[objInd]);
+			delete objImpLstLst[objInd];
+		}
+		if (frgIndLstLst[objInd])
+			free(frgIndLstLst[objInd]);
+	}
+	for(frgInd= 0; frgInd < lnkLay-> frgNum; frgInd++)
+		if (frgBufLst[frgInd])
+			free(frgBufLst[frgInd]);
+
+	if (relSec)
+	{
+		FreeCExeFileRelocSection(relSec);
+		delete relSec;
+	}
+	dumExeFil-> ~CExeFile();
+	delete dumExeFil;
+	FreeCMyMapStringToPtr(symNamLst);
+	delete symNamLst;
+	FreeCMyMapStringToPtr(impNamLst);
+	delete impNamLst;
+	relLst-> RemoveAll();
+	delete relLst;
+	FreeCMyMemFile(sitDat);
+	delete sitDat;
+	free(objFilLst);
+	free(objImpLstLst);
+	free(frgIndLstLst);
+	free(frgBufLst);
+	free(newSymAdr);
+	free(objNamLst);
+	free(chgObjLst);
+
+	// Die alte Zustandsdatei wird nicht mehr gebraucht, lnkLay zeigt noch hinein
+	if (!lnkOK)
+	{
+		free(oldStaBuf);
+		oldStaBuf= NULL;
+		lnkLay= NULL;
+		frgTab= NULL;
+		symTab= NULL;
+		impTab= NULL;
+		sitTab= NULL;
+		relTab= NULL;
+		strTab= NULL;
+	}
+
+	return lnkOK;
+}
+
+/**************************************************************************************************/
+/*** Schreiben der Zustandsdatei nach einem erfolgreichen Linklauf.                             ***/
+/**************************************************************************************************/
+
+BOOL CLinkState::Save()
+{
+	CFile										staFil;
+	CFileException filErr;
+	FILETIME							exeFilTim;
+
+	BYTE  *inpBuf;
+	BYTE  typ= LNK_STA_TYP_EXE;
+	DWORD inpLen;
+	DWORD layLen;
+	DWORD exeFilSiz;
+
+	if (!GiveFileInfo(exeFilNam, exeFilSiz, exeFilTim))
+	{
+		Remove();
+		return FALSE;
+	}
+
+	if (!staFil.Open(staFilNam, CFile::modeCreate | CFile::modeWrite | CFile::typeBinary, &filErr))
+		return FALSE;
+
+	inpLen= lnkStaDat-> GetLength();
+	lnkStaDat-> SeekToBegin();
+	inpBuf= (BYTE *) lnkStaDat-> ReadWithoutMemcpy(inpLen);
+
+	staFil.Write(inpBuf, inpLen);
+	staFil.Write(&typ, sizeof(BYTE));
+	staFil.Write(&exeFilSiz, sizeof(DWORD));
+	staFil.Write(&exeFilTim, sizeof(FILETIME));
+
+	// Anordnung der PE-Datei fr das nchste inkrementelle Linken
+	if (lnkLayDat)
+	{
+		typ= LNK_STA_TYP_LAY;
+		layLen= lnkLayDat-> GetLength();
+		lnkLayDat-> SeekToBegin();
+		staFil.Write(&typ, sizeof(BYTE));
+		staFil.Write(lnkLayDat-> ReadWithoutMemcpy(layLen), layLen);
+	}
+	staFil.Close();
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Lschen der Zustandsdatei, z.B. wenn das Linken fehlgeschlagen ist.                        ***/
+/**************************************************************************************************/
+
+void CLinkState::Remove()
+{
+	DeleteFile(staFilNam);
+}
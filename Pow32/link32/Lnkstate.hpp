@@ -0,0 +1,181 @@
+/**************************************************************************************************/
+/*** Die Datei LnkState.hpp beinhaltet die Definition der Klasse CLinkState. Sie verwaltet die  ***/
+/*** Linkzustandsdatei (.LKS), die neben der PE-Datei abgelegt wird und die Eingaben sowie die  ***/
+/*** Anordnung der Fragmente des letzten erfolgreichen Linklaufs festhlt.                      ***/
+/**************************************************************************************************/
+
+// 32-Bit Linker 
+
+#ifndef __LNKSTATE_HPP__
+#define __LNKSTATE_HPP__
+
+#ifndef __LINKER_H__
+#include "Linker.h"
+#endif
+
+#ifndef __MYFILE_HPP__
+#include "MyCFile.hpp"
+#endif
+
+#ifndef __MYCOLL_H__
+#include "MyColl.hpp"
+#endif
+
+class CExeFile;
+class CObjFile;
+
+/**************************************************************************************************/
+/*** Anordnung der PE-Datei in der Linkzustandsdatei. Auf den Kopf folgen die Tabellen der      ***/
+/*** Fragmente, Symbole, Importe und Patchstellen, die .RELOC Adressliste und die Stringtabelle ***/
+/*** mit den Namen. objInd ist der Index der Objektdatei im Linkaufruf, Adressen sind RVAs.     ***/
+/**************************************************************************************************/
+
+struct myLnkStaLayout
+{
+ DWORD objNum;             // Anzahl der Objektdateien des Linkaufrufs
+ DWORD imgBas;
+ DWORD secAln;
+ DWORD filAln;
+ DWORD timDatStpOff;       // Dateioffsets der beim inkrementellen Linken genderten Headerfelder
+ DWORD relSizOff;
+ DWORD relSecTabOff;
+ DWORD relRawDatPtr;       // Platz der .RELOC Sektion in der PE-Datei
+ DWORD relRawDatSiz;
+ DWORD frgNum;
+ DWORD symNum;
+ DWORD impNum;
+ DWORD sitNum;
+ DWORD relNum;
+ DWORD strTabSiz;
+};
+
+/*** Fragment einer Objektdatei des Linkaufrufs ***/
+
+struct myLnkStaFragment
+{
+ DWORD secNamOff;          // Name der Objektdateisektion in der Stringtabelle
+ DWORD secChr;
+ WORD  objInd;
+ WORD  secInd;             // Sektionsnummer in der Objektdatei, ab 1
+ DWORD frgAdr;
+ DWORD filOff;             // Dateioffset in der PE-Datei, 0 bei .BSS Fragmenten
+ DWORD frgSiz;
+ DWORD frgCap;             // Platz samt Reserve, siehe CSectionFragmentEntry::SetFragCapacity
+};
+
+/*** Externes Symbol, das in einem Fragment einer Objektdatei des Linkaufrufs definiert ist ***/
+
+struct myLnkStaSymbol
+{
+ DWORD symNamOff;
+ DWORD symAdr;
+ WORD  objInd;
+ WORD  secInd;
+};
+
+/*** Auflsung eines undefinierten Symbols einer Objektdatei des Linkaufrufs ***/
+
+#define LNK_STA_IMP_ADR  1      // Symbol aus einer Bibliothek, impVal ist die RVA
+#define LNK_STA_IMP_SYM  2      // Symbol einer anderen Objektdatei, impVal ist der Index in der Symboltabelle
+#define LNK_STA_IMP_BSS  3      // .BSS Variable, impVal ist die Adresse, impSiz die Gre in der Objektdatei
+#define LNK_STA_IMP_ABS  4      // Absolutes Symbol, impVal ist der Wert
+#define LNK_STA_IMP_DLL  5      // DLL Import, impVal ist textSegOff, impSiz idataLookupTabOff
+
+struct myLnkStaImport
+{
+ DWORD symNamOff;
+ DWORD impVal;
+ DWORD impSiz;
+ WORD  objInd;
+ WORD  impTyp;
+};
+
+/*** Stelle der PE-Datei, die auf ein Symbol einer Objektdatei des Linkaufrufs verweist. Sie  ***/
+/*** wird um die Verschiebung des Symbols korrigiert, wenn nur dessen Objektdatei neu ist.     ***/
+
+#define LNK_STA_NO_OBJ   0xFFFF // Stelle in einem Bibliotheksfragment, im Export- oder im Dateikopf
+
+struct myLnkStaSite
+{
+ DWORD symInd;
+ DWORD filOff;
+ WORD  objInd;
+ WORD  relTyp;             // Relokationstyp, 0 wenn die Stelle nicht korrigiert werden kann
+};
+
+/*** Aufgelste Adresse eines Symbols beim inkrementellen Linken ***/
+
+struct myLnkStaResolve
+{
+ myLnkStaImport *symImp;   // NULL bei Symbolen der Objektdatei selbst und bei LNK_STA_IMP_SYM
+ DWORD          symInd;    // Index in der Symboltabelle oder 0xFFFFFFFF
+ DWORD          symAdr;    // RVA des Fragments bzw. Wert absoluter Symbole
+ DWORD          symVal;
+ BOOL           absSym;
+};
+
+/**************************************************************************************************/
+/*** Die Eingaben des Linkers (Objektdateien, Libraries, Ressourcedatei mit Gre und Zeit-     ***/
+/*** stempel sowie alle Linkoptionen) werden in einem Speicherblock aneinandergereiht. Stimmt   ***/
+/*** er mit dem gespeicherten Block berein und ist die PE-Datei seither unverndert, so ist    ***/
+/*** die PE-Datei aktuell und das Linken kann entfallen. Haben sich nur Objektdateien gendert, ***/
+/*** setzt RelinkChangedObjects deren Fragmente an ihren alten Platz in die PE-Datei. Wchst    ***/
+/*** ein Fragment ber seine Reserve oder ndern sich die Symbole, wird vollstndig gelinkt.    ***/
+/**************************************************************************************************/
+
+class CLinkState : public CObject
+{
+	DECLARE_DYNAMIC(CLinkState);
+
+	private:
+		CMyMemFile	*lnkStaDat;
+		CMyMemFile	*lnkLayDat;		// Anordnung der PE-Datei, siehe myLnkStaLayout
+		char							*exeFilNam;
+		char							*staFilNam;
+
+		// Gelesene Zustandsdatei des letzten Linklaufs
+		BYTE													*oldStaBuf;
+		DWORD												oldStaLen;
+		DWORD												oldInpLen;
+		myLnkStaLayout			*lnkLay;
+		myLnkStaFragment	*frgTab;
+		myLnkStaSymbol			*symTab;
+		myLnkStaImport			*impTab;
+		myLnkStaSite					*sitTab;
+		DWORD												*relTab;
+		char													*strTab;
+
+		BOOL GiveFileInfo(char *filNam, DWORD &filSiz, FILETIME &filTim);
+		void AddInputRecord(BYTE typ, char *filNam);
+		BOOL ReadOldState();
+		BOOL ParseLayout();
+		BOOL GiveChangedObjects(char **objNamLst, BOOL *chgObjLst, DWORD &chgObjNum);
+		BOOL ResolveSymbol(CObjFile *objFil, WORD objInd, mySymbolEntry *aSym, CMyMapStringToPtr *objImpLst,
+		                   CMyMapStringToPtr *symNamLst, CMyMapStringToPtr *impNamLst, DWORD *frgIndLst,
+		                   DWORD *newSymAdr, myLnkStaResolve &symRes);
+		BOOL CheckChangedObject(CObjFile *objFil, WORD objInd, DWORD *frgIndLst, CMyMapStringToPtr *objImpLst,
+		                        CMyMapStringToPtr *symNamLst, CMyMapStringToPtr *impNamLst, DWORD *newSymAdr);
+		BOOL RelocateFragment(CObjFile *objFil, WORD objInd, myLnkStaFragment *aFrg, DWORD *frgIndLst,
+		                      CMyMapStringToPtr *objImpLst, CMyMapStringToPtr *symNamLst, CMyMapStringToPtr *impNamLst,
+		                      DWORD *newSymAdr, BYTE *frgBuf, CDWordArray *relLst, CMyMemFile *sitDat);
+		static DWORD AddString(CMyMemFile *strDat, char *str);
+
+	public:
+		CLinkState(char *eFilNam);
+		~CLinkState();
+
+		void FreeUsedMemory();
+
+		void AddInputFile(char *filNam);
+		void AddInputObject(char *filNam);
+		void AddInputString(char *str);
+		void AddInputValue(DWORD val);
+
+		BOOL IsUpToDate();
+		BOOL RecordLayout(CExeFile *exeFil);
+		BOOL RelinkChangedObjects();
+		BOOL Save();
+		void Remove();
+};
+
+#endif
@@ -0,0 +1,197 @@
+#include <string.h>
+#include <malloc.h>
+
+#ifndef __MYCOLL_H__
+#include "MyColl.hpp"
+#endif
+
+#define ARE_OBJ_HDR  8                 // Kopf vor Objekten aus NewObject, erhlt die Ausrichtung
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+CMyArena::CMyArena(UINT nBlkSiz)
+{
+	m_pBlocks= NULL;
+	m_nBlkSiz= nBlkSiz;
+	m_nAlcBytes= 0;
+	InitializeCriticalSection(&m_crtSec);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+CMyArena::~CMyArena()
+{
+	FreeUsedMemory();
+	DeleteCriticalSection(&m_crtSec);
+}
+
+/**************************************************************************************************/
+/*** Rckgabe aller Blcke auf einmal. Destruktoren der Objekte im Speicher werden              ***/
+/*** nicht aufgerufen.                                                                          ***/
+/**************************************************************************************************/
+
+void CMyArena::FreeUsedMemory()
+{
+	CMyArenaBlock *pBlk;
+
+	while(m_pBlocks)
+	{
+		pBlk= m_pBlocks;
+		m_pBlocks= pBlk-> pNext;
+		VirtualFree(pBlk, 0, MEM_RELEASE);
+	}
+	m_nAlcBytes= 0;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+CMyArena::CMyArenaBlock *CMyArena::NewBlock(UINT nSize)
+{
+	CMyArenaBlock *pBlk;
+
+	pBlk= (CMyArenaBlock *)VirtualAlloc(NULL, sizeof(CMyArenaBlock) + nSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if (!pBlk)
+		return NULL;
+
+	pBlk-> nSize= nSize;
+	pBlk-> nUsed= 0;
+	m_nAlcBytes+= sizeof(CMyArenaBlock) + nSize;
+	return pBlk;
+}
+
+/**************************************************************************************************/
+/*** Vergabe von nBytes, auf 8 Byte ausgerichtet. Groe Anforderungen erhalten einen            ***/
+/*** eigenen Block, der hinter dem aktuellen eingehngt wird, damit dessen Rest weiter          ***/
+/*** genutzt werden kann.                                                                       ***/
+/**************************************************************************************************/
+
+void *CMyArena::Alloc(UINT nBytes)
+{
+	CMyArenaBlock *pBlk;
+	BYTE          *pMem= NULL;
+
+	nBytes= (nBytes + 7) & ~7;
+	if (!nBytes)
+		nBytes= 8;
+
+	EnterCriticalSection(&m_crtSec);
+
+	if (nBytes > m_nBlkSiz / 4)
+	{
+		pBlk= NewBlock(nBytes);
+		if (pBlk)
+		{
+			pBlk-> nUsed= nBytes;
+			if (m_pBlocks)
+			{
+				pBlk-> pNext= m_pBlocks-> pNext;
+				m_pBlocks-> pNext= pBlk;
+			}
+			else
+			{
+				pBlk-> pNext= NULL;
+				m_pBlocks= pBlk;
+			}
+			pMem= (BYTE *)(pBlk + 1);
+		}
+	}
+	else
+	{
+		if (!m_pBlocks || m_pBlocks-> nSize - m_pBlocks-> nUsed < nBytes)
+		{
+			pBlk= NewBlock(m_nBlkSiz);
+			if (pBlk)
+			{
+				pBlk-> pNext= m_pBlocks;
+				m_pBlocks= pBlk;
+			}
+		}
+		if (m_pBlocks && m_pBlocks-> nSize - m_pBlocks-> nUsed >= nBytes)
+		{
+			pMem= (BYTE *)(m_pBlocks + 1) + m_pBlocks-> nUsed;
+			m_pBlocks-> nUsed+= nBytes;
+		}
+	}
+
+	LeaveCriticalSection(&m_crtSec);
+
+	return pMem;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+char *CMyArena::StrDup(LPCTSTR pszStr)
+{
+	char *pszNew;
+
+	pszNew= (char *)Alloc(strlen(pszStr) + 1);
+	strcpy(pszNew, pszStr);
+	return pszNew;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+DWORD CMyArena::GetAllocatedBytes() const
+{
+	return m_nAlcBytes;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void *CMyArena::AllocFrom(CMyArena *pArena, UINT nBytes)
+{
+	if (pArena)
+		return pArena-> Alloc(nBytes);
+	return malloc(nBytes);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMyArena::FreeTo(CMyArena *pArena, void *pMem)
+{
+	if (!pArena)
+		free(pMem);
+}
+
+/**************************************************************************************************/
+/*** Vor jedem Objekt steht der Speicher, aus dem es stammt. So gibt DeleteObject auch          ***/
+/*** Objekte frei, die auerhalb eines Linkvorgangs mit malloc angelegt wurden.                 ***/
+/**************************************************************************************************/
+
+void *CMyArena::NewObject(CMyArena *pArena, UINT nBytes)
+{
+	CMyArena **pHdr;
+
+	pHdr= (CMyArena **)AllocFrom(pArena, nBytes + ARE_OBJ_HDR);
+	*pHdr= pArena;
+	return (BYTE *)pHdr + ARE_OBJ_HDR;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMyArena::DeleteObject(void *pObj)
+{
+	CMyArena **pHdr;
+
+	if (!pObj)
+		return;
+
+	pHdr= (CMyArena **)((BYTE *)pObj - ARE_OBJ_HDR);
+	FreeTo(*pHdr, pHdr);
+}
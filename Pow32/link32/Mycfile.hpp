@@ -59,6 +59,7 @@ protected:
 	virtual BYTE* Memcpy(BYTE* lpMemTarget, const BYTE* lpMemSource, UINT nBytes);
 	virtual void Free(BYTE* lpMem);
 	virtual void GrowFile(DWORD dwNewLen);
+	void SetBufferSize(DWORD dwNewBufferSize);
 
 // Implementation
 protected:
@@ -71,6 +72,12 @@ protected:
 public:
  BOOL ownAllMem;
  
+ // Zhler fr alle CMyMemFile Objekte: Anzahl der Allokationen und der dabei (hchstens)
+ // umkopierten Bytes. Werden in LinkProgram zurckgesetzt und ausgegeben. Da auch die
+ // Arbeitsthreads Dateien vergrern, werden sie nur mit Interlocked-Funktionen erhht.
+ static LONG alcNum;
+ static LONG cpyBytNum;
+
 
 public:
 	virtual ~CMyMemFile();
@@ -87,7 +94,10 @@ public:
 	virtual UINT GetBufferPtr(UINT nCommand, UINT nCount = 0,	void** ppBufStart = NULL, void** ppBufMax = NULL);
  
  /* New, Linker specific Method's */
+ void Reserve(DWORD nBytes);
+ BYTE *GetBufferStart();
  virtual void SetBufferDirect(void *lpBuf, UINT nCount);
+ virtual void WriteZero(UINT nCount);
  virtual UINT ReadWithoutMemcpy(void **lpBufStart, UINT nCount); 
  virtual void *ReadWithoutMemcpy(UINT nCount= 0); 
 
@@ -97,4 +107,69 @@ public:
 	virtual void UnlockRange(DWORD dwPos, DWORD dwCount);
 };
 
+/**************************************************************************************************/
+/*** CMapFile blendet eine Datei zum Lesen in den Adreraum ein (copy-on-write). Der Puffer von ***/
+/*** CMyMemFile zeigt direkt auf die Ansicht, Teile davon knnen ohne Kopieren weitergegeben    ***/
+/*** werden. Sie bleiben gltig, bis die Datei geschlossen wird.                                ***/
+/**************************************************************************************************/
+
+class CMapFile : public CMyMemFile
+{
+	DECLARE_DYNAMIC(CMapFile)
+
+ public:
+ 	CMapFile();
+
+  BOOL Open(LPCTSTR lpszFileName);
+  BOOL GiveFileInfo(DWORD &filSiz, FILETIME &filTim);
+ 	virtual void Abort();
+ 	virtual void Close();
+
+ public:
+ 	virtual ~CMapFile();
+
+ protected:
+  HANDLE m_hMapFil;
+  HANDLE m_hMapObj;
+  void   *m_lpView;
+};
+
+/**************************************************************************************************/
+/*** CStreamFile schreibt die PE-Datei direkt auf die Festplatte, statt sie ganz im Speicher    ***/
+/*** aufzubauen. Kleine Schreibaufrufe werden gesammelt, groe Blcke (Fragmente, CodeView)     ***/
+/*** werden ohne Umkopieren geschrieben. Mit WriteZero geschriebene Fllbytes werden nur        ***/
+/*** bersprungen, die Lcken fllt das Betriebssystem mit Nullen. Seek ist erlaubt, Lesen      ***/
+/*** nicht.                                                                                     ***/
+/**************************************************************************************************/
+
+class CStreamFile : public CMyMemFile
+{
+	DECLARE_DYNAMIC(CStreamFile)
+
+ public:
+  BOOL wrtErr;
+
+ 	CStreamFile();
+
+  BOOL Open(LPCTSTR lpszFileName);
+	 virtual UINT Read(void* lpBuf, UINT nCount);
+	 virtual void Write(const void* lpBuf, UINT nCount);
+  virtual void WriteZero(UINT nCount);
+ 	virtual void Flush();
+ 	virtual void Abort();
+ 	virtual void Close();
+
+ public:
+ 	virtual ~CStreamFile();
+
+ protected:
+  HANDLE m_hStrFil;
+  BYTE   *m_lpWrtBuf;
+  DWORD  m_nWrtBufLen;      // Anzahl der gesammelten Bytes
+  DWORD  m_nWrtBufFilPos;   // Dateiposition des ersten gesammelten Bytes
+  DWORD  m_nFilEnd;         // Ende der tatschlich geschriebenen Daten
+
+  void WriteToDisc(const void *lpBuf, DWORD nCount, DWORD nFilPos);
+};
+
 #endif
@@ -0,0 +1,122 @@
+#ifndef __MYFILE_HPP__
+#include "MyCFile.hpp"
+#endif
+
+IMPLEMENT_DYNAMIC(CMapFile, CMyMemFile)
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+CMapFile::CMapFile()
+{
+	m_hMapFil = INVALID_HANDLE_VALUE;
+	m_hMapObj = NULL;
+	m_lpView = NULL;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+CMapFile::~CMapFile()
+{
+	// Der Destruktor von CMyMemFile ruft nur CMyMemFile::Close auf
+	if (m_lpView || m_hMapFil != INVALID_HANDLE_VALUE)
+		Close();
+}
+
+/******************************************************************************************************/
+/*** Einblenden der ganzen Datei. Die Ansicht ist copy-on-write, nderungen im Puffer werden        ***/
+/*** nicht in die Datei zurckgeschrieben. Eine leere Datei ergibt einen leeren Puffer.             ***/
+/******************************************************************************************************/
+
+BOOL CMapFile::Open(LPCTSTR lpszFileName)
+{
+	DWORD filSiz;
+
+	m_hMapFil = CreateFile(lpszFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+	                       FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m_hMapFil == INVALID_HANDLE_VALUE)
+		return FALSE;
+
+	filSiz = GetFileSize(m_hMapFil, NULL);
+	if (filSiz == 0xFFFFFFFF)
+	{
+		Close();
+		return FALSE;
+	}
+
+	if (filSiz)
+	{
+		m_hMapObj = CreateFileMapping(m_hMapFil, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+		if (m_hMapObj == NULL)
+		{
+			Close();
+			return FALSE;
+		}
+
+		m_lpView = MapViewOfFile(m_hMapObj, FILE_MAP_COPY, 0, 0, 0);
+		if (m_lpView == NULL)
+		{
+			Close();
+			return FALSE;
+		}
+	}
+
+	ownAllMem = FALSE;
+	SetBufferDirect(m_lpView, filSiz);
+	m_nPosition = 0;
+	return TRUE;
+}
+
+/******************************************************************************************************/
+/*** Gre und Zeitpunkt der letzten nderung der geffneten Datei                                  ***/
+/******************************************************************************************************/
+
+BOOL CMapFile::GiveFileInfo(DWORD &filSiz, FILETIME &filTim)
+{
+	if (m_hMapFil == INVALID_HANDLE_VALUE)
+		return FALSE;
+
+	filSiz = GetFileSize(m_hMapFil, NULL);
+	if (filSiz == 0xFFFFFFFF)
+		return FALSE;
+
+	return GetFileTime(m_hMapFil, NULL, NULL, &filTim);
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+void CMapFile::Close()
+{
+	CMyMemFile::Close();
+
+	if (m_lpView)
+	{
+		UnmapViewOfFile(m_lpView);
+		m_lpView = NULL;
+	}
+	if (m_hMapObj)
+	{
+		CloseHandle(m_hMapObj);
+		m_hMapObj = NULL;
+	}
+	if (m_hMapFil != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(m_hMapFil);
+		m_hMapFil = INVALID_HANDLE_VALUE;
+	}
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+void CMapFile::Abort()
+{
+	Close();
+}
+
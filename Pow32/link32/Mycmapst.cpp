@@ -2,13 +2,15 @@
 #include "MyColl.hpp"
 #endif
 
+extern CMyArena *lnkAre;  // In Linker.cpp definiert
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
 
-CMyPlex* PASCAL CMyPlex::Create(CMyPlex*& pHead, UINT nMax, UINT cbElement)
+CMyPlex* PASCAL CMyPlex::Create(CMyPlex*& pHead, UINT nMax, UINT cbElement, CMyArena *pArena)
 {
- CMyPlex* p = (CMyPlex *) malloc(sizeof(CMyPlex) + nMax * cbElement);
+ CMyPlex* p = (CMyPlex *) CMyArena::AllocFrom(pArena, sizeof(CMyPlex) + nMax * cbElement);
 			// may throw exception
 	p->nMax = nMax;
 	p->nCur = 0;
@@ -51,6 +53,7 @@ CMyMapStringToOb::CMyMapStringToOb(int nBlockSize)
 	m_pFreeList = NULL;
 	m_pBlocks = NULL;
 	m_nBlockSize = nBlockSize;
+	m_pArena = lnkAre;
 }
 
 /**************************************************************************************************/
@@ -77,13 +80,13 @@ void CMyMapStringToOb::InitHashTable(UINT nHashSize, BOOL bAllocNow)
 	if (m_pHashTable)
 	{
 		// free hash table
-		free(m_pHashTable);
+		CMyArena::FreeTo(m_pArena, m_pHashTable);
 		m_pHashTable = NULL;
 	}
 
 	if (bAllocNow)
 	{
-  m_pHashTable= (CMyAssoc **) malloc(sizeof(CMyAssoc*) * nHashSize);
+  m_pHashTable= (CMyAssoc **) CMyArena::AllocFrom(m_pArena, sizeof(CMyAssoc*) * nHashSize);
   //m_pHashTable= new CMyAssoc *[nHashSize];
 		memset(m_pHashTable, 0, sizeof(CMyAssoc*) * nHashSize);
 	}
@@ -98,13 +101,14 @@ void CMyMapStringToOb::RemoveAll()
 {
 	if (m_pHashTable)
 	{
-  free(m_pHashTable);
+  CMyArena::FreeTo(m_pArena, m_pHashTable);
 		m_pHashTable = NULL;
 	}
 
 	m_nCount = 0;
 	m_pFreeList = NULL;
-	m_pBlocks-> FreeDataChain();
+	if (!m_pArena)
+		m_pBlocks-> FreeDataChain();
 	m_pBlocks = NULL;
 }
 
@@ -131,7 +135,7 @@ CMyMapStringToOb::CMyAssoc *CMyMapStringToOb::NewAssoc()
 	if (!m_pFreeList)
 	{
 		// add another block
-		CMyPlex* newBlock= CMyPlex::Create(m_pBlocks, m_nBlockSize,	sizeof(CMyMapStringToOb::CMyAssoc));
+		CMyPlex* newBlock= CMyPlex::Create(m_pBlocks, m_nBlockSize,	sizeof(CMyMapStringToOb::CMyAssoc), m_pArena);
 		// chain them into free list
 		CMyMapStringToOb::CMyAssoc* pAssoc= (CMyMapStringToOb::CMyAssoc*) newBlock->data();
 		// free in reverse order to make it easier to debug
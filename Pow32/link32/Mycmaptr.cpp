@@ -2,6 +2,8 @@
 #include "MyColl.hpp"
 #endif
 
+extern CMyArena *lnkAre;  // In Linker.cpp definiert
+
 IMPLEMENT_DYNAMIC(CMyMapStringToPtr, CMapStringToPtr)
 
 /**************************************************************************************************/
@@ -16,6 +18,7 @@ CMyMapStringToPtr::CMyMapStringToPtr(int nBlockSize)
 	m_pFreeList = NULL;
 	m_pBlocks = NULL;
 	m_nBlockSize = nBlockSize;
+	m_pArena = lnkAre;
 }
 
 /**************************************************************************************************/
@@ -42,13 +45,13 @@ void CMyMapStringToPtr::InitHashTable(UINT nHashSize, BOOL bAllocNow)
 	if (m_pHashTable != NULL)
 	{
 		// free hash table
-		free(m_pHashTable);
+		CMyArena::FreeTo(m_pArena, m_pHashTable);
   m_pHashTable = NULL;
 	}
 
 	if (bAllocNow)
 	{
-		m_pHashTable= (CMyAssoc **) malloc(sizeof(CMyAssoc*) * nHashSize);
+		m_pHashTable= (CMyAssoc **) CMyArena::AllocFrom(m_pArena, sizeof(CMyAssoc*) * nHashSize);
   memset(m_pHashTable, 0, sizeof(CMyAssoc*) * nHashSize);
 	}
 	m_nHashTableSize = nHashSize;
@@ -63,13 +66,14 @@ void CMyMapStringToPtr::RemoveAll()
 	if (m_pHashTable != NULL)
 	{
 		// free hash table
-		free(m_pHashTable);
+		CMyArena::FreeTo(m_pArena, m_pHashTable);
   m_pHashTable = NULL;
 	}
 
 	m_nCount = 0;
 	m_pFreeList = NULL;
-	m_pBlocks->FreeDataChain();
+	if (!m_pArena)
+		m_pBlocks->FreeDataChain();
 	m_pBlocks = NULL;
 }
 
@@ -100,7 +104,7 @@ CMyMapStringToPtr::CMyAssoc *CMyMapStringToPtr::NewAssoc()
 	if (m_pFreeList == NULL)
 	{
 		// add another block
-		CMyPlex* newBlock = CMyPlex::Create(m_pBlocks, m_nBlockSize,	sizeof(CMyMapStringToPtr::CMyAssoc));
+		CMyPlex* newBlock = CMyPlex::Create(m_pBlocks, m_nBlockSize,	sizeof(CMyMapStringToPtr::CMyAssoc), m_pArena);
 		// chain them into free list
 		CMyMapStringToPtr::CMyAssoc* pAssoc=	(CMyMapStringToPtr::CMyAssoc*) newBlock->data();
 		// free in reverse order to make it easier to debug
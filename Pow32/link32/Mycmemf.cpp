@@ -4,6 +4,9 @@
 
 IMPLEMENT_DYNAMIC(CMyMemFile, CFile)
 
+LONG CMyMemFile::alcNum= 0;
+LONG CMyMemFile::cpyBytNum= 0;
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -94,22 +97,54 @@ void CMyMemFile::GrowFile(DWORD dwNewLen)
 {
 	if (dwNewLen > m_nBufferSize)
 	{
-		// grow the buffer
-		DWORD dwNewBufferSize = (DWORD)m_nBufferSize;
+		// grow the buffer, die Gre wird mindestens verdoppelt, damit fortlaufendes Schreiben
+		// nur logarithmisch viele Umkopieraktionen verursacht.
+		DWORD dwNewBufferSize = (DWORD)m_nBufferSize * 2;
+
+		if (dwNewBufferSize < m_nGrowBytes)
+			dwNewBufferSize = m_nGrowBytes;
+		if (dwNewBufferSize < dwNewLen)
+			dwNewBufferSize = dwNewLen;
 
-		while (dwNewBufferSize < dwNewLen)
-			dwNewBufferSize += m_nGrowBytes;
+		SetBufferSize(dwNewBufferSize);
+	}
+}
 
-		BYTE* lpNew;
-		if (m_lpBuffer == NULL)
-			lpNew = Alloc(dwNewBufferSize);
-		else
-			lpNew = Realloc(m_lpBuffer, dwNewBufferSize);
+/******************************************************************************************************/
+/*** Reservieren von Speicher fr nBytes, wenn die endgltige Gre im voraus bekannt ist.           ***/
+/******************************************************************************************************/
 
-		m_lpBuffer = lpNew;
-		m_nBufferSize = dwNewBufferSize;
-  ownAllMem= TRUE; // Memory wurde selbst allokiert, mu selbst wieder freigegeben werden
+void CMyMemFile::Reserve(DWORD nBytes)
+{
+	if (nBytes > m_nBufferSize)
+		SetBufferSize(nBytes);
+}
+
+/******************************************************************************************************/
+/*** Ein mit SetBufferDirect bergebener fremder Puffer wird nicht vergrert, sondern kopiert.      ***/
+/******************************************************************************************************/
+
+void CMyMemFile::SetBufferSize(DWORD dwNewBufferSize)
+{
+	BYTE* lpNew;
+
+	if (m_lpBuffer == NULL)
+		lpNew = Alloc(dwNewBufferSize);
+	else if (!ownAllMem)
+	{
+		lpNew = Alloc(dwNewBufferSize);
+		Memcpy(lpNew, m_lpBuffer, m_nFileSize);
 	}
+	else
+		lpNew = Realloc(m_lpBuffer, dwNewBufferSize);
+
+	InterlockedIncrement(&alcNum);
+	if (m_lpBuffer)
+		InterlockedExchangeAdd(&cpyBytNum, (LONG)m_nFileSize);
+
+	m_lpBuffer = lpNew;
+	m_nBufferSize = dwNewBufferSize;
+ ownAllMem= TRUE; // Memory wurde selbst allokiert, mu selbst wieder freigegeben werden
 }
 
 /******************************************************************************************************/
@@ -171,6 +206,26 @@ void CMyMemFile::Write(const void* lpBuf, UINT nCount)
 		m_nFileSize = m_nPosition;
 }
 
+/******************************************************************************************************/
+/*** Schreiben von nCount Fllbytes 0x00 ab der aktuellen Position.                                 ***/
+/******************************************************************************************************/
+
+void CMyMemFile::WriteZero(UINT nCount)
+{
+	if (nCount == 0)
+		return;
+
+	if (m_nPosition + nCount > m_nBufferSize)
+		GrowFile(m_nPosition + nCount);
+
+	memset((BYTE*)m_lpBuffer + m_nPosition, 0x00, nCount);
+
+	m_nPosition += nCount;
+
+	if (m_nPosition > m_nFileSize)
+		m_nFileSize = m_nPosition;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
@@ -181,6 +236,16 @@ void CMyMemFile::SetBufferDirect(void *lpBuf, UINT nCount)
  m_nFileSize= m_nBufferSize= nCount; 
 }
 
+/******************************************************************************************************/
+/*** Direkter Zugriff auf den Puffer, z.B. zum Patchen der Relokationen ohne Seek, Read und Write.  ***/
+/*** Der Zeiger ist nur bis zum nchsten Vergrern der Datei gltig.                               ***/
+/******************************************************************************************************/
+
+BYTE *CMyMemFile::GetBufferStart()
+{
+	return m_lpBuffer;
+}
+
 /******************************************************************************************************/
 /******************************************************************************************************/
 /******************************************************************************************************/
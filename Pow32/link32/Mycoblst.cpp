@@ -2,6 +2,8 @@
 #include "MyColl.hpp"
 #endif
 
+extern CMyArena *lnkAre;  // In Linker.cpp definiert
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
@@ -14,6 +16,7 @@ CMyObList::CMyObList(int nBlockSize)
 	m_pNodeHead= m_pNodeTail = m_pNodeFree = NULL;
 	m_pBlocks= NULL;
 	m_nBlockSize= nBlockSize;
+	m_pArena= lnkAre;
 }
 
 /**************************************************************************************************/
@@ -24,7 +27,8 @@ void CMyObList::RemoveAll()
 {
 	m_nCount= 0;
 	m_pNodeHead= m_pNodeTail = m_pNodeFree = NULL;
-	m_pBlocks-> FreeDataChain();
+	if (!m_pArena)
+		m_pBlocks-> FreeDataChain();
 	m_pBlocks= NULL;
 }
 
@@ -65,7 +69,7 @@ CMyObList::CMyNode *CMyObList::NewNode(CMyObList::CMyNode* pPrev, CMyObList::CMy
 	if (m_pNodeFree == NULL)
 	{
 		// add another block
-		CMyPlex* pNewBlock= CMyPlex::Create(m_pBlocks, m_nBlockSize,	sizeof(CMyNode));
+		CMyPlex* pNewBlock= CMyPlex::Create(m_pBlocks, m_nBlockSize,	sizeof(CMyNode), m_pArena);
 
 		// chain them into free list
 		CMyNode* pNode = (CMyNode*) pNewBlock->data();
@@ -9,6 +9,53 @@
 #include "Linker.h"
 #endif
 
+/**************************************************************************************************/
+/*** CMyArena vergibt Speicher fortlaufend aus groen Blcken. Einzelne Anforderungen werden    ***/
+/*** nicht freigegeben, FreeUsedMemory gibt alle Blcke auf einmal zurck. Der Linker legt fr  ***/
+/*** jeden Linkvorgang einen solchen Speicher an (lnkAre), aus dem die Listen, Symboleintrge,  ***/
+/*** Sektionen und Sektionsfragmente stammen. Alloc ist threadsicher.                           ***/
+/**************************************************************************************************/
+
+#define ARE_BLK_SIZ  0x100000          // Blockgre des Linkspeichers (1 MB)
+
+class CMyArena
+{
+ public:
+  CMyArena(UINT nBlkSiz = ARE_BLK_SIZ);
+  ~CMyArena();
+
+  void FreeUsedMemory();
+  void *Alloc(UINT nBytes);
+  char *StrDup(LPCTSTR pszStr);
+  DWORD GetAllocatedBytes() const;
+
+  // Ohne Speicher (pArena == NULL) wird auf malloc und free zurckgegriffen
+
+  static void *AllocFrom(CMyArena *pArena, UINT nBytes);
+  static void FreeTo(CMyArena *pArena, void *pMem);
+
+  // Fr operator new und delete von Klassen, deren Objekte im Speicher liegen knnen
+
+  static void *NewObject(CMyArena *pArena, UINT nBytes);
+  static void DeleteObject(void *pObj);
+
+ protected:
+  struct CMyArenaBlock
+  {
+   CMyArenaBlock *pNext;
+   UINT nSize;     // Nutzbare Bytes hinter dem Blockkopf
+   UINT nUsed;
+   UINT nPad;      // Daten beginnen auf einer 16 Byte Grenze
+  };
+
+  CMyArenaBlock *m_pBlocks;   // Der erste Block ist der, aus dem gerade vergeben wird
+  UINT m_nBlkSiz;
+  DWORD m_nAlcBytes;
+  CRITICAL_SECTION m_crtSec;
+
+  CMyArenaBlock *NewBlock(UINT nSize);
+};
+
 struct CMyPlex    // warning variable length structure
 {
 	CMyPlex* pNext;
@@ -18,9 +65,10 @@ struct CMyPlex    // warning variable length structure
 
 	void* data() { return this+1; }
 
-	static CMyPlex* PASCAL Create(CMyPlex*& head, UINT nMax, UINT cbElement);
+	static CMyPlex* PASCAL Create(CMyPlex*& head, UINT nMax, UINT cbElement, CMyArena *pArena = NULL);
 			// like 'calloc' but no zero fill
 			// may throw memory exceptions
+			// blocks taken from pArena are not freed by FreeDataChain
 
 	void FreeDataChain();       // free this one and links
 };
@@ -122,6 +170,7 @@ class CMyPtrList : public CPtrList
 	 CMyNode* m_pNodeFree;
 	 struct CMyPlex* m_pBlocks;
 	 int m_nBlockSize;
+	 CMyArena *m_pArena;  // Linkspeicher beim Anlegen, NULL --> malloc
  	CMyNode* NewNode(CMyNode*, CMyNode*);
 	 void FreeNode(CMyNode*);
 
@@ -188,6 +237,7 @@ class CMyObList : public CObList
 	 CMyNode* m_pNodeFree;
 	 struct CMyPlex* m_pBlocks;
 	 int m_nBlockSize;
+	 CMyArena *m_pArena;  // Linkspeicher beim Anlegen, NULL --> malloc
 
 	 CMyNode* NewNode(CMyNode*, CMyNode*);
 	 void FreeNode(CMyNode*);
@@ -254,6 +304,7 @@ class CMyStringList : public CStringList
 	 CMyNode *m_pNodeFree;
 	 struct CMyPlex* m_pBlocks;
 	 int m_nBlockSize;
+	 CMyArena *m_pArena;  // Linkspeicher beim Anlegen, NULL --> malloc
 
 	CMyNode* NewNode(CMyNode*, CMyNode*);
 	void FreeNode(CMyNode*);
@@ -309,6 +360,7 @@ class CMyMapStringToPtr : public CMapStringToPtr
 	 CMyAssoc* m_pFreeList;
 	 struct CMyPlex* m_pBlocks;
 	 int m_nBlockSize;
+	 CMyArena *m_pArena;  // Linkspeicher beim Anlegen, NULL --> malloc
 
 	 CMyAssoc* NewAssoc();
 	 void FreeAssoc(CMyAssoc*);
@@ -329,6 +381,76 @@ class CMyMapStringToPtr : public CMapStringToPtr
 	 typedef void* BASE_ARG_VALUE;
 };
 
+/**************************************************************************************************/
+/*** CMySymbolTable ersetzt CMyMapStringToPtr fr die Symbolverzeichnisse des Linkers. Offene   ***/
+/*** Adressierung mit linearem Sondieren, die Tabellengre ist immer eine Zweierpotenz und     ***/
+/*** wird verdoppelt, sobald der Fllgrad 3/4 berschreitet. Hashwert und Lnge des Schlssels  ***/
+/*** werden im Eintrag gespeichert, strcmp wird nur bei gleichem Hash und gleicher Lnge aufge- ***/
+/*** rufen. Die Schlssel werden wie bei CMyMapStringToPtr nicht kopiert.                       ***/
+/*** Auf Wunsch wird beim Einfgen ein zweiter Index ber die undekorierten Namen (ohne '_' am  ***/
+/*** Anfang und ohne @nn am Ende) aufgebaut, ber den StringIsKeyPart direkt sucht.             ***/
+/**************************************************************************************************/
+
+class CMySymbolTable : public CObject
+{
+ DECLARE_DYNAMIC(CMySymbolTable)
+
+ protected:
+
+	 struct CMySymSlot
+	 {
+	 	UINT     nHashValue;
+	 	UINT     nKeyLen;
+	 	LPCTSTR  key;       // NULL --> Eintrag ist frei
+		 void     *value;
+	 };
+
+ public:
+  CMySymbolTable(UINT nInitSize = 64, BOOL bUndIdx = FALSE);
+
+ 	int GetCount() const;
+ 	BOOL IsEmpty() const;
+  BOOL Lookup(LPCTSTR key, void*& rValue) const;
+  BOOL LookupIncludeString(LPCTSTR key, void*& rValue) const;
+ 	void*& operator[](LPCTSTR key);
+  void SetAt(LPCTSTR key, void* newValue);
+  BOOL RemoveKey(LPCTSTR key);
+	 void RemoveAll();
+  POSITION GetStartPosition() const;
+ 	void GetNextAssoc(POSITION& rNextPosition, LPCTSTR& rKey, void*& rValue) const;
+  UINT GetHashTableSize() const;
+	 void InitHashTable(UINT nEntNum, BOOL bAllocNow = TRUE);
+  UINT HashKey(LPCTSTR key, UINT& nKeyLen) const;
+
+		// Suchen von Exportsymbolen ohne Parameteranzahl (@..)
+
+		BOOL StringIsKeyPart(LPCTSTR key, void*& rValue);
+
+		// Mitschreiben aller Zugriffe fr den Symboltabellen-Benchmark (Symtest.cpp)
+
+		void RecordTo(FILE *recFil, char tabId);
+
+ // Implementation
+ protected:
+	 CMySymSlot *m_pSlots;
+	 CMySymSlot *m_pUndSlots;  // Index der undekorierten Namen, gleiche Gre wie m_pSlots
+	 BOOL m_bUndIdx;
+	 UINT m_nTableSize;   // Zweierpotenz
+	 UINT m_nGrowAt;      // Anzahl der Eintrge, ab der die Tabelle verdoppelt wird
+	 int  m_nCount;
+	 FILE *m_pRecFil;
+	 char m_cRecTabId;
+
+	 CMySymSlot* GetSlotAt(LPCTSTR key, UINT nHash, UINT nKeyLen) const;
+	 void Rehash(UINT nNewSize);
+	 BOOL GetUndecoratedName(LPCTSTR key, LPCTSTR& rUndNam, UINT& rUndLen) const;
+	 static void InsertSlot(CMySymSlot *pSlots, UINT nMask, CMySymSlot *pNewSlot);
+	 static void DeleteSlot(CMySymSlot *pSlots, UINT nMask, UINT nSlotInd);
+
+ public:
+	 ~CMySymbolTable();
+};
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
@@ -371,6 +493,7 @@ class CMyMapStringToOb : public CMapStringToOb
 	 CMyAssoc* m_pFreeList;
 	 struct CMyPlex* m_pBlocks;
 	 int m_nBlockSize;
+	 CMyArena *m_pArena;  // Linkspeicher beim Anlegen, NULL --> malloc
 
 	 CMyAssoc* NewAssoc();
 	 void FreeAssoc(CMyAssoc*);
@@ -2,6 +2,8 @@
 #include "MyColl.hpp"
 #endif
 
+extern CMyArena *lnkAre;  // In Linker.cpp definiert
+
 IMPLEMENT_DYNAMIC(CMyStringList, CStringList)
 
 /////////////////////////////////////////////////////////////////////////////
@@ -32,6 +34,7 @@ CMyStringList::CMyStringList(int nBlockSize)
 	m_pNodeHead= m_pNodeTail= m_pNodeFree= NULL;
 	m_pBlocks= NULL;
 	m_nBlockSize= nBlockSize;
+	m_pArena= lnkAre;
 }
 
 /******************************************************************************************************/
@@ -42,7 +45,8 @@ void CMyStringList::RemoveAll()
 {
 	m_nCount= 0;
 	m_pNodeHead= m_pNodeTail = m_pNodeFree = NULL;
-	m_pBlocks-> FreeDataChain();
+	if (!m_pArena)
+		m_pBlocks-> FreeDataChain();
 	m_pBlocks= NULL;
 }
 
@@ -83,7 +87,7 @@ CMyStringList::CMyNode* CMyStringList::NewNode(CMyStringList::CMyNode* pPrev, CM
 	if (m_pNodeFree == NULL)
 	{
 		// add another block
-		CMyPlex *pNewBlock = CMyPlex::Create(m_pBlocks, m_nBlockSize, sizeof(CMyNode));
+		CMyPlex *pNewBlock = CMyPlex::Create(m_pBlocks, m_nBlockSize, sizeof(CMyNode), m_pArena);
   		// chain them into free list
 		CMyNode *pNode= (CMyNode *)pNewBlock-> data();
 		// free in reverse order to make it easier to debug
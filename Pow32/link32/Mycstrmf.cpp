@@ -0,0 +1,201 @@
+#ifndef __MYFILE_HPP__
+#include "MyCFile.hpp"
+#endif
+
+IMPLEMENT_DYNAMIC(CStreamFile, CMyMemFile)
+
+#define STR_FIL_BUF_SIZ 0x10000      // Gre des Puffers zum Sammeln kleiner Schreibaufrufe
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+CStreamFile::CStreamFile()
+{
+	m_hStrFil = INVALID_HANDLE_VALUE;
+	m_lpWrtBuf = NULL;
+	m_nWrtBufLen = 0;
+	m_nWrtBufFilPos = 0;
+	m_nFilEnd = 0;
+	wrtErr = FALSE;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+CStreamFile::~CStreamFile()
+{
+	if (m_hStrFil != INVALID_HANDLE_VALUE)
+		Close();
+}
+
+/******************************************************************************************************/
+/*** Anlegen der Ausgabedatei, eine vorhandene Datei wird berschrieben.                            ***/
+/******************************************************************************************************/
+
+BOOL CStreamFile::Open(LPCTSTR lpszFileName)
+{
+	m_hStrFil = CreateFile(lpszFileName, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+	                       FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (m_hStrFil == INVALID_HANDLE_VALUE)
+		return FALSE;
+
+	m_lpWrtBuf = (BYTE *) malloc(STR_FIL_BUF_SIZ);
+	m_nWrtBufLen = 0;
+	m_nFilEnd = 0;
+	m_nPosition = 0;
+	m_nFileSize = 0;
+	wrtErr = FALSE;
+	return TRUE;
+}
+
+/******************************************************************************************************/
+/*** Schreiben eines Blocks an der Dateiposition nFilPos. Fehler werden in wrtErr vermerkt und beim ***/
+/*** Schlieen der Datei ausgewertet.                                                               ***/
+/******************************************************************************************************/
+
+void CStreamFile::WriteToDisc(const void *lpBuf, DWORD nCount, DWORD nFilPos)
+{
+	DWORD nWritten;
+
+	if (wrtErr)
+		return;
+
+	if (SetFilePointer(m_hStrFil, nFilPos, NULL, FILE_BEGIN) == 0xFFFFFFFF ||
+	    !WriteFile(m_hStrFil, lpBuf, nCount, &nWritten, NULL) || nWritten != nCount)
+	{
+		wrtErr = TRUE;
+		return;
+	}
+
+	if (nFilPos + nCount > m_nFilEnd)
+		m_nFilEnd = nFilPos + nCount;
+}
+
+/******************************************************************************************************/
+/*** Kleine, fortlaufende Schreibaufrufe werden im Puffer gesammelt. Blcke ab der Puffergre      ***/
+/*** werden direkt aus dem Speicher des Aufrufers geschrieben.                                      ***/
+/******************************************************************************************************/
+
+void CStreamFile::Write(const void* lpBuf, UINT nCount)
+{
+	if (nCount == 0)
+		return;
+
+	if (m_nWrtBufLen && (m_nPosition != m_nWrtBufFilPos + m_nWrtBufLen ||
+	                     m_nWrtBufLen + nCount > STR_FIL_BUF_SIZ))
+		Flush();
+
+	if (nCount >= STR_FIL_BUF_SIZ)
+		WriteToDisc(lpBuf, nCount, m_nPosition);
+	else
+	{
+		if (!m_nWrtBufLen)
+			m_nWrtBufFilPos = m_nPosition;
+		memcpy(m_lpWrtBuf + m_nWrtBufLen, lpBuf, nCount);
+		m_nWrtBufLen += nCount;
+	}
+
+	m_nPosition += nCount;
+
+	if (m_nPosition > m_nFileSize)
+		m_nFileSize = m_nPosition;
+}
+
+/******************************************************************************************************/
+/*** Fllbytes hinter dem bisher geschriebenen Dateiende werden nur bersprungen. Nur wo schon      ***/
+/*** Daten stehen, werden tatschlich Nullen geschrieben.                                           ***/
+/******************************************************************************************************/
+
+void CStreamFile::WriteZero(UINT nCount)
+{
+	static BYTE zeroBuf[0x200];
+
+	DWORD datEnd;
+	UINT  zeroNum;
+
+	datEnd = m_nFilEnd;
+	if (m_nWrtBufLen && m_nWrtBufFilPos + m_nWrtBufLen > datEnd)
+		datEnd = m_nWrtBufFilPos + m_nWrtBufLen;
+
+	while (nCount && m_nPosition < datEnd)
+	{
+		zeroNum = min(nCount, sizeof(zeroBuf));
+		if (zeroNum > datEnd - m_nPosition)
+			zeroNum = datEnd - m_nPosition;
+		Write(zeroBuf, zeroNum);
+		nCount -= zeroNum;
+	}
+
+	m_nPosition += nCount;
+
+	if (m_nPosition > m_nFileSize)
+		m_nFileSize = m_nPosition;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+UINT CStreamFile::Read(void* lpBuf, UINT nCount)
+{
+	// Die Ausgabedatei wird nur geschrieben
+	lpBuf = lpBuf;
+	nCount = nCount;
+	return 0;
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+void CStreamFile::Flush()
+{
+	if (m_nWrtBufLen)
+	{
+		WriteToDisc(m_lpWrtBuf, m_nWrtBufLen, m_nWrtBufFilPos);
+		m_nWrtBufLen = 0;
+	}
+}
+
+/******************************************************************************************************/
+/*** Endet die Datei mit bersprungenen Fllbytes, wird sie auf die volle Lnge gesetzt.            ***/
+/******************************************************************************************************/
+
+void CStreamFile::Close()
+{
+	if (m_hStrFil != INVALID_HANDLE_VALUE)
+	{
+		Flush();
+
+		if (!wrtErr && m_nFileSize > m_nFilEnd)
+		{
+			if (SetFilePointer(m_hStrFil, m_nFileSize, NULL, FILE_BEGIN) == 0xFFFFFFFF ||
+			    !SetEndOfFile(m_hStrFil))
+				wrtErr = TRUE;
+		}
+
+		CloseHandle(m_hStrFil);
+		m_hStrFil = INVALID_HANDLE_VALUE;
+	}
+
+	if (m_lpWrtBuf)
+	{
+		free(m_lpWrtBuf);
+		m_lpWrtBuf = NULL;
+	}
+	m_nWrtBufLen = 0;
+
+	CMyMemFile::Close();
+}
+
+/******************************************************************************************************/
+/******************************************************************************************************/
+/******************************************************************************************************/
+
+void CStreamFile::Abort()
+{
+	Close();
+}
+
@@ -0,0 +1,476 @@
+#ifndef __MYCOLL_H__
+#include "MyColl.hpp"
+#endif
+
+IMPLEMENT_DYNAMIC(CMySymbolTable, CObject)
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+CMySymbolTable::CMySymbolTable(UINT nInitSize, BOOL bUndIdx)
+{
+	m_pSlots = NULL;
+	m_pUndSlots = NULL;
+	m_bUndIdx = bUndIdx;
+	m_nTableSize = 16;
+	while (m_nTableSize < nInitSize)
+		m_nTableSize <<= 1;
+	m_nGrowAt = m_nTableSize - (m_nTableSize >> 2);
+	m_nCount = 0;
+	m_pRecFil = NULL;
+	m_cRecTabId = ' ';
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+CMySymbolTable::~CMySymbolTable()
+{
+	RemoveAll();
+}
+
+/**************************************************************************************************/
+/*** Hashwert und Lnge des Schlssels werden in einem Durchlauf ermittelt. Die Bits werden am  ***/
+/*** Ende durchmischt, da ber die unteren Bits direkt der Tabellenplatz bestimmt wird.         ***/
+/**************************************************************************************************/
+
+static inline UINT MixSymHash(UINT nHash)
+{
+	nHash ^= nHash >> 16;
+	nHash *= 0x85EBCA6B;
+	nHash ^= nHash >> 13;
+	return nHash;
+}
+
+UINT CMySymbolTable::HashKey(LPCTSTR key, UINT& nKeyLen) const
+{
+	LPCTSTR keyStart = key;
+	UINT nHash = 2166136261;
+
+	while (*key)
+	{
+		nHash ^= (BYTE)*key++;
+		nHash *= 16777619;
+	}
+	nKeyLen = key - keyStart;
+
+	return MixSymHash(nHash);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+static UINT HashUndNam(LPCTSTR undNam, UINT undLen)
+{
+	UINT nHash = 2166136261;
+
+	while (undLen--)
+	{
+		nHash ^= (BYTE)*undNam++;
+		nHash *= 16777619;
+	}
+
+	return MixSymHash(nHash);
+}
+
+/**************************************************************************************************/
+/*** Ermitteln des undekorierten Namens: ein '_' am Anfang wird bersprungen, der Name endet    ***/
+/*** vor dem ersten folgenden '@'. FALSE, wenn der Schlssel kein '@' enthlt.                  ***/
+/**************************************************************************************************/
+
+BOOL CMySymbolTable::GetUndecoratedName(LPCTSTR key, LPCTSTR& rUndNam, UINT& rUndLen) const
+{
+	LPCTSTR atPos;
+
+	rUndNam = (*key == '_') ? key + 1 : key;
+	if (*key == '\0')
+		return FALSE;
+
+	atPos = strchr(key + 1, '@');
+	if (atPos == NULL)
+		return FALSE;
+
+	rUndLen = atPos - rUndNam;
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Reservieren der Tabelle fr nEntNum Eintrge. Bereits vorhandene Eintrge bleiben erhalten ***/
+/*** (im Gegensatz zu CMyMapStringToPtr::InitHashTable).                                        ***/
+/**************************************************************************************************/
+
+void CMySymbolTable::InitHashTable(UINT nEntNum, BOOL bAllocNow)
+{
+	UINT nNewSize = 16;
+
+	while (nNewSize - (nNewSize >> 2) <= nEntNum)
+		nNewSize <<= 1;
+
+	if (nNewSize <= m_nTableSize && (m_pSlots || !bAllocNow))
+		return;
+
+	if (m_pSlots || bAllocNow)
+		Rehash(nNewSize);
+	else
+	{
+		m_nTableSize = nNewSize;
+		m_nGrowAt = m_nTableSize - (m_nTableSize >> 2);
+	}
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMySymbolTable::Rehash(UINT nNewSize)
+{
+	CMySymSlot *oldSlots = m_pSlots;
+	CMySymSlot *oldUndSlots = m_pUndSlots;
+	UINT       oldSize = m_nTableSize;
+	UINT       nMask = nNewSize - 1;
+	UINT       i;
+
+	m_pSlots = (CMySymSlot *) malloc(sizeof(CMySymSlot) * nNewSize);
+	memset(m_pSlots, 0, sizeof(CMySymSlot) * nNewSize);
+	if (m_bUndIdx)
+	{
+		m_pUndSlots = (CMySymSlot *) malloc(sizeof(CMySymSlot) * nNewSize);
+		memset(m_pUndSlots, 0, sizeof(CMySymSlot) * nNewSize);
+	}
+	m_nTableSize = nNewSize;
+	m_nGrowAt = nNewSize - (nNewSize >> 2);
+
+	if (oldSlots == NULL)
+		return;
+
+	// Der Hashwert ist im Eintrag gespeichert, die Schlssel mssen nicht neu berechnet werden
+
+	for (i = 0; i < oldSize; i++)
+	{
+		if (oldSlots[i].key != NULL)
+			InsertSlot(m_pSlots, nMask, &oldSlots[i]);
+		if (oldUndSlots && oldUndSlots[i].key != NULL)
+			InsertSlot(m_pUndSlots, nMask, &oldUndSlots[i]);
+	}
+	free(oldSlots);
+	if (oldUndSlots)
+		free(oldUndSlots);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMySymbolTable::InsertSlot(CMySymSlot *pSlots, UINT nMask, CMySymSlot *pNewSlot)
+{
+	UINT i = pNewSlot->nHashValue & nMask;
+
+	while (pSlots[i].key != NULL)
+		i = (i + 1) & nMask;
+	pSlots[i] = *pNewSlot;
+}
+
+/**************************************************************************************************/
+/*** Entfernen eines Eintrags. Die nachfolgenden Eintrge der Sondierungskette werden nach      ***/
+/*** vorne geschoben, damit keine Lschmarken bentigt werden.                                  ***/
+/**************************************************************************************************/
+
+void CMySymbolTable::DeleteSlot(CMySymSlot *pSlots, UINT nMask, UINT nSlotInd)
+{
+	UINT i, j, k;
+
+	i = nSlotInd;
+	j = i;
+	for (;;)
+	{
+		j = (j + 1) & nMask;
+		if (pSlots[j].key == NULL)
+			break;
+		k = pSlots[j].nHashValue & nMask;
+		// Eintrag j darf nur nach i verschoben werden, wenn i zwischen k und j liegt (zyklisch)
+		if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j)))
+		{
+			pSlots[i] = pSlots[j];
+			i = j;
+		}
+	}
+	pSlots[i].key = NULL;
+	pSlots[i].value = NULL;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMySymbolTable::RemoveAll()
+{
+	if (m_pSlots != NULL)
+	{
+		free(m_pSlots);
+		m_pSlots = NULL;
+	}
+	if (m_pUndSlots != NULL)
+	{
+		free(m_pUndSlots);
+		m_pUndSlots = NULL;
+	}
+	m_nCount = 0;
+}
+
+/**************************************************************************************************/
+/*** Rckgabe des Eintrags mit dem gesuchten Schlssel oder des freien Eintrags, an dem der     ***/
+/*** Schlssel eingefgt werden wrde.                                                          ***/
+/**************************************************************************************************/
+
+CMySymbolTable::CMySymSlot *CMySymbolTable::GetSlotAt(LPCTSTR key, UINT nHash, UINT nKeyLen) const
+{
+	UINT nMask = m_nTableSize - 1;
+	UINT i = nHash & nMask;
+	CMySymSlot *pSlot;
+
+	for (;;)
+	{
+		pSlot = &m_pSlots[i];
+		if (pSlot->key == NULL)
+			return pSlot;
+		if (pSlot->nHashValue == nHash && pSlot->nKeyLen == nKeyLen && !memcmp(pSlot->key, key, nKeyLen))
+			return pSlot;
+		i = (i + 1) & nMask;
+	}
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+BOOL CMySymbolTable::Lookup(LPCTSTR key, void*& rValue) const
+{
+	UINT nKeyLen;
+	UINT nHash = HashKey(key, nKeyLen);
+
+	if (m_pRecFil)
+		fprintf(m_pRecFil, "%c L %s\n", m_cRecTabId, key);
+
+	if (m_pSlots == NULL)
+		return FALSE;
+
+	CMySymSlot *pSlot = GetSlotAt(key, nHash, nKeyLen);
+	if (pSlot->key == NULL)
+		return FALSE;  // not in map
+
+	rValue = pSlot->value;
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** CMyMapStringToPtr::LookupIncludeString durchsucht nur die Hashkette des vollstndigen      ***/
+/*** Schlssels und findet daher praktisch nur den Schlssel selbst. Das wird hier beibehalten. ***/
+/**************************************************************************************************/
+
+BOOL CMySymbolTable::LookupIncludeString(LPCTSTR key, void*& rValue) const
+{
+	return Lookup(key, rValue);
+}
+
+/**************************************************************************************************/
+/*** Sucht einen Schlssel, der mit der angegebenen Zeichenkette beginnt, gefolgt von '@'. Mit ***/
+/*** Index der undekorierten Namen gengt ein Sondieren, sonst wird sequentiell durchsucht.     ***/
+/**************************************************************************************************/
+
+BOOL CMySymbolTable::StringIsKeyPart(LPCTSTR key, void*& rValue)
+{
+	UINT nKeyLen = strlen(key);
+	UINT i;
+	LPCTSTR undNam;
+	UINT    undLen;
+	UINT    nHash;
+
+	if (m_pSlots == NULL)
+		return FALSE;
+
+	if (m_pUndSlots && nKeyLen > 0 && strchr(key + 1, '@') == NULL)
+	{
+		undNam = (*key == '_') ? key + 1 : key;
+		undLen = nKeyLen - (undNam - key);
+		nHash = HashUndNam(undNam, undLen);
+
+		for (i = nHash & (m_nTableSize - 1); m_pUndSlots[i].key != NULL; i = (i + 1) & (m_nTableSize - 1))
+		{
+			if (m_pUndSlots[i].nHashValue == nHash && m_pUndSlots[i].nKeyLen == undLen &&
+			    m_pUndSlots[i].key[nKeyLen] == '@' && !strncmp(key, m_pUndSlots[i].key, nKeyLen))
+			{
+				return Lookup(m_pUndSlots[i].key, rValue);
+			}
+		}
+		return FALSE;
+	}
+
+	for (i = 0; i < m_nTableSize; i++)
+	{
+		if (m_pSlots[i].key && m_pSlots[i].nKeyLen > nKeyLen && m_pSlots[i].key[nKeyLen] == '@' &&
+		    !strncmp(key, m_pSlots[i].key, nKeyLen))
+		{
+			rValue = m_pSlots[i].value;
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void*& CMySymbolTable::operator[](LPCTSTR key)
+{
+	UINT nKeyLen;
+	UINT nHash = HashKey(key, nKeyLen);
+	CMySymSlot *pSlot;
+	CMySymSlot undSlot;
+
+	if (m_pSlots == NULL)
+		Rehash(m_nTableSize);
+
+	pSlot = GetSlotAt(key, nHash, nKeyLen);
+	if (pSlot->key == NULL)
+	{
+		if ((UINT)m_nCount + 1 > m_nGrowAt)
+		{
+			Rehash(m_nTableSize << 1);
+			pSlot = GetSlotAt(key, nHash, nKeyLen);
+		}
+		pSlot->nHashValue = nHash;
+		pSlot->nKeyLen = nKeyLen;
+		pSlot->key = key;
+		pSlot->value = NULL;
+		m_nCount++;
+
+		// Eintrag im Index der undekorierten Namen (der Wert wird ber m_pSlots geholt)
+
+		if (m_pUndSlots && GetUndecoratedName(key, undSlot.key, undSlot.nKeyLen))
+		{
+			undSlot.nHashValue = HashUndNam(undSlot.key, undSlot.nKeyLen);
+			undSlot.key = key;
+			undSlot.value = NULL;
+			InsertSlot(m_pUndSlots, m_nTableSize - 1, &undSlot);
+		}
+	}
+	return pSlot->value;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMySymbolTable::SetAt(LPCTSTR key, void* newValue)
+{
+	if (m_pRecFil)
+		fprintf(m_pRecFil, "%c S %s\n", m_cRecTabId, key);
+
+	(*this)[key] = newValue;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+BOOL CMySymbolTable::RemoveKey(LPCTSTR key)
+{
+	UINT nKeyLen;
+	UINT nHash = HashKey(key, nKeyLen);
+	UINT nMask = m_nTableSize - 1;
+	UINT i;
+	LPCTSTR undNam;
+	UINT    undLen;
+
+	if (m_pSlots == NULL)
+		return FALSE;
+
+	CMySymSlot *pSlot = GetSlotAt(key, nHash, nKeyLen);
+	if (pSlot->key == NULL)
+		return FALSE;
+
+	if (m_pUndSlots && GetUndecoratedName(pSlot->key, undNam, undLen))
+	{
+		for (i = HashUndNam(undNam, undLen) & nMask; m_pUndSlots[i].key != NULL; i = (i + 1) & nMask)
+			if (m_pUndSlots[i].key == pSlot->key)
+			{
+				DeleteSlot(m_pUndSlots, nMask, i);
+				break;
+			}
+	}
+
+	DeleteSlot(m_pSlots, nMask, pSlot - m_pSlots);
+	m_nCount--;
+	return TRUE;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Iterating, POSITION ist der Index des nchsten Eintrags + 1
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+POSITION CMySymbolTable::GetStartPosition() const
+{
+	UINT i;
+
+	if (m_nCount == 0)
+		return NULL;
+
+	for (i = 0; m_pSlots[i].key == NULL; i++);
+	return (POSITION)(i + 1);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMySymbolTable::GetNextAssoc(POSITION& rNextPosition, LPCTSTR& rKey, void*& rValue) const
+{
+	UINT i = (UINT)rNextPosition - 1;
+
+	rKey = m_pSlots[i].key;
+	rValue = m_pSlots[i].value;
+
+	for (i++; i < m_nTableSize; i++)
+		if (m_pSlots[i].key != NULL)
+			break;
+
+	rNextPosition = (i < m_nTableSize) ? (POSITION)(i + 1) : NULL;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CMySymbolTable::RecordTo(FILE *recFil, char tabId)
+{
+	m_pRecFil = recFil;
+	m_cRecTabId = tabId;
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+int CMySymbolTable::GetCount() const
+	{ return m_nCount; }
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+BOOL CMySymbolTable::IsEmpty() const
+	{ return m_nCount == 0; }
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+UINT CMySymbolTable::GetHashTableSize() const
+	{ return m_nTableSize; }
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <malloc.h>
+#include <process.h>
 
 #ifndef __LINKER_H__
 #include "Linker.h"
@@ -27,6 +28,10 @@
 #include "Section.hpp"
 #endif
 
+#ifndef __LNKSTATE_HPP__
+#include "LnkState.hpp"
+#endif
+
 extern char *logFilNam;
 extern FILE *logFil; 
 extern int		logOn;   
@@ -36,16 +41,20 @@ extern void WriteMessageToPow(WORD msgNr, char *str1, char *str2);
 extern void FreeCLibFile(CLibFile *aCLibFile);
 extern void FreeCObjFile(CObjFile *aCObjFile);
 extern void FreeCMapStringToOb(CMapStringToOb *aCMapStringToOb);
-extern void FreeCMyMapStringToPtr(CMyMapStringToPtr *aCMyMapStringToPtr);
+extern void FreeCMySymbolTable(CMySymbolTable *aCMySymbolTable);
 extern void FreeCMyObList(CMyObList *aCMyObList);
 extern void FreeCMyPtrList(CMyPtrList *aCMyPtrList);
 extern void FreeCMemFile(CMemFile *aCMemFile);
 extern void FreeCMyMemFile(CMyMemFile *aCMyMemFile);
+extern void FreeCMapFile(CMapFile *aCMapFile);
 extern void FreeCDllExportEntry(CDllExportEntry *aCDllExportEntry);
 
 extern void TestHeap(void);
 
-extern BOOL	oneLibLst;
+extern BOOL	parLod;
+extern BOOL	symLogOn;
+extern char *symLogFilNam;
+extern FILE *symLogFil;
 
 IMPLEMENT_DYNAMIC(CObj2Exe, CObject)
 
@@ -61,10 +70,12 @@ CObj2Exe::CObj2Exe()
 {
 	newExeFil= NULL;
 	libLst= NULL;
+	libMapFilLst= NULL;
 	objFilLst= NULL;	
 	unResSymLst= NULL;
 	pubSymLst= NULL; 
 	pubLibSymLst= NULL;
+	libFilCac= NULL;
 	basAdr= 0;
 }
 
@@ -89,6 +100,7 @@ BOOL CObj2Exe::FreeUsedMemory()
 {
 	CLibFile 				*delLibFil;
 	CObjFile 				*delObjFil;
+	CMapFile 				*delLibMapFil;
 
 	if (newExeFil)
 	{
@@ -98,6 +110,12 @@ BOOL CObj2Exe::FreeUsedMemory()
 	}
 	if (libLst) 
 	{
+		// Bibliotheken aus dem Cache bleiben fr den nchsten Linkaufruf erhalten
+		if (libFilCac)
+		{
+			libFilCac-> ReleaseLibFiles(libLst);
+			libLst-> RemoveAll();
+		}
 		while(!libLst-> IsEmpty())
 		{
 			delLibFil= (CLibFile *)libLst-> RemoveHead();
@@ -120,6 +138,19 @@ BOOL CObj2Exe::FreeUsedMemory()
 		delete objLst;
 		objFilLst= NULL;
 	}
+	if (libMapFilLst)
+	{
+		// Erst nach den Objektdateien, deren Rohdaten in die Ansichten der Bibliotheken zeigen
+		while(!libMapFilLst-> IsEmpty())
+		{
+			delLibMapFil= (CMapFile *)libMapFilLst-> RemoveHead();
+			FreeCMapFile(delLibMapFil);
+			delete delLibMapFil;
+		}
+		FreeCMyObList(libMapFilLst);
+		delete libMapFilLst;
+		libMapFilLst= NULL;
+	}
  if (srcObjFilLst)
  {
   FreeCMyObList(srcObjFilLst);
@@ -132,21 +163,66 @@ BOOL CObj2Exe::FreeUsedMemory()
 		delete unResSymLst;
 		unResSymLst= NULL;
 	}
+	if (symLogOn && symLogFil)
+	{
+		fclose(symLogFil);
+		symLogFil= NULL;
+	}
 	if (pubSymLst) 
 	{
-		FreeCMyMapStringToPtr(pubSymLst);
+		FreeCMySymbolTable(pubSymLst);
 		delete pubSymLst;
 		pubSymLst= NULL;
 	}
 	if (pubLibSymLst) 
 	{
-		FreeCMyMapStringToPtr(pubLibSymLst);
-		delete pubLibSymLst;
+		// Das Gesamtverzeichnis gehrt dem Bibliothekscache
+		if (libFilCac)
+			pubLibSymLst-> RecordTo(NULL, 'L');
+		else
+		{
+			FreeCMySymbolTable(pubLibSymLst);
+			delete pubLibSymLst;
+		}
 		pubLibSymLst= NULL;
 	}
 	return TRUE;
 }
 
+/**************************************************************************************************/
+/*** Gemeinsame Daten der Threads beim parallelen Laden der Objektdateien. Jeder Thread holt    ***/
+/*** sich ber nxtJob die nchste noch nicht geladene Objektdatei aus jobArr.                   ***/
+/**************************************************************************************************/
+
+struct myLodObjJob
+{
+ CObjFile *objFil;
+ LPSTR    objFilNam;
+ BOOL     lnkOK;
+};
+
+struct myLodObjWork
+{
+ myLodObjJob *jobArr;
+ LONG        jobNum;
+ LONG        nxtJob;
+};
+
+static unsigned __stdcall LodObjWorker(void *aWork)
+{
+	myLodObjWork *actWork= (myLodObjWork *)aWork;
+	myLodObjJob  *actJob;
+	LONG         jobInd;
+
+	while((jobInd= InterlockedIncrement(&actWork-> nxtJob) - 1) < actWork-> jobNum)
+	{
+		actJob= &actWork-> jobArr[jobInd];
+		actJob-> lnkOK= actJob-> objFil-> ReadObjFileFromDisc(actJob-> objFilNam);
+	}
+
+	return 0;
+}
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /*** Initialisieren des Linkers: Anlegen und Initialisieren der bentigten Listen; Anlegen des  ***/
@@ -167,6 +243,11 @@ BOOL CObj2Exe::InitLinker()
 	CObjFile					  *aObjFil;
  CLibFile					  *aLibFil;
 
+	myLodObjWork lodWork;
+	SYSTEM_INFO  sysInf;
+	HANDLE       thrHdl[MAX_LOD_OBJ_THR];
+	DWORD        thrNum, thrInd;
+
 	WORD libFilInd, objFilInd, expFncNamInd;
 	BOOL lnkOK;
 
@@ -182,13 +263,29 @@ BOOL CObj2Exe::InitLinker()
 	/********************************************/
 
 	libLst= new CMyObList();
+	libMapFilLst= new CMyObList();
 	objLst= new CMyObList(250);                
  srcObjFilLst= new CMyObList();
 	unResSymLst= new CMyPtrList(750);
-	pubSymLst= new CMyMapStringToPtr(5000);
-	pubSymLst-> InitHashTable(500, TRUE);
-	pubLibSymLst= new CMyMapStringToPtr(10000);
-	pubLibSymLst-> InitHashTable(1000, TRUE);
+	pubSymLst= new CMySymbolTable(64, TRUE);
+	pubSymLst-> InitHashTable(5000, TRUE);
+	if (!libFilCac)
+	{
+		pubLibSymLst= new CMySymbolTable();
+		pubLibSymLst-> InitHashTable(10000, TRUE);
+	}
+
+	if (symLogOn)
+	{
+		// Aufzeichnen aller Zugriffe auf die Symbolverzeichnisse fr Symtest.cpp
+		symLogFil= fopen(symLogFilNam, "w");
+		if (symLogFil)
+		{
+			pubSymLst-> RecordTo(symLogFil, 'P');
+			if (pubLibSymLst)
+				pubLibSymLst-> RecordTo(symLogFil, 'L');
+		}
+	}
 
 	/**************************************************************/
 	/*** Anlegen und Initialisieren der zu erzeugenden PE-Datei ***/
@@ -217,20 +314,34 @@ BOOL CObj2Exe::InitLinker()
 
 	while(libFilLst[libFilInd] != NULL)
  {
-  aLibFil= new CLibFile();
-		if (oneLibLst)
+		if (libFilCac)
 		{
-			if (!aLibFil-> LoadLibFileFromDiscComPubList(libFilLst[libFilInd], pubLibSymLst))
+			// Eine mehrfach angegebene Bibliothek wird nur einmal eingetragen, sie trgt beim
+			// zweiten Mal ohnehin kein Symbol zum Gesamtverzeichnis bei.
+			aLibFil= libFilCac-> GiveLibFile(libFilLst[libFilInd]);
+			if (!aLibFil)
 				lnkOK= FALSE;
+			else if (!libLst-> Find(aLibFil))
+			{
+				libMapFilLst-> AddTail(aLibFil-> actLibFil);
+				aLibFil-> libFilInd= (WORD )(libFilInd + 1);
+				libLst-> AddTail(aLibFil);
+			}
 		}
 		else
 		{
-			if (!aLibFil-> LoadLibFileFromDiscOwnPubList(libFilLst[libFilInd]))
+	  aLibFil= new CLibFile();
+			if (!aLibFil-> LoadLibFileFromDisc(libFilLst[libFilInd]))
 				lnkOK= FALSE;
-		}
+			else
+			{
+				aLibFil-> AddToComPubList(pubLibSymLst);
+				libMapFilLst-> AddTail(aLibFil-> actLibFil);
+			}
 
-		aLibFil-> libFilInd= (WORD )(libFilInd + 1);
-		libLst-> AddTail(aLibFil);
+			aLibFil-> libFilInd= (WORD )(libFilInd + 1);
+			libLst-> AddTail(aLibFil);
+		}
 		libFilInd++;
 	}
 
@@ -240,30 +351,88 @@ BOOL CObj2Exe::InitLinker()
 		return FALSE;
 	}
 
+	// Das Gesamtverzeichnis kommt unverndert aus dem Cache, wenn dieselben Bibliotheken
+	// in derselben Reihenfolge schon beim letzten Linkaufruf verwendet wurden.
+	if (libFilCac && lnkOK)
+	{
+		pubLibSymLst= libFilCac-> GiveComPubList(libLst);
+		if (symLogOn && symLogFil)
+			pubLibSymLst-> RecordTo(symLogFil, 'L');
+	}
+
  newExeFil-> libFilNum= libFilInd;
 
 	/***********************************************/
 	/*** Laden und Analysieren der Objektdateien ***/
 	/***********************************************/
 
- objFilInd= 0;
+	// Die Objektdateien werden zuerst gleichzeitig eingelesen und zerlegt. Erst danach werden
+	// ihre Sektionen und Symbole in der Reihenfolge des Linkaufrufs eingetragen, damit das
+	// Ergebnis nicht von der Reihenfolge abhngt, in der die Threads fertig werden.
 
+ objFilInd= 0;
  while(objFilLst[objFilInd] != NULL)
+		objFilInd++;
+
+	lodWork.jobNum= objFilInd;
+	lodWork.nxtJob= 0;
+	lodWork.jobArr= (myLodObjJob *) malloc((objFilInd + 1) * sizeof(myLodObjJob));
+
+ for(objFilInd= 0; objFilInd < lodWork.jobNum; objFilInd++)
  {
 	 aObjFil= new CObjFile();
 		aObjFil-> SetExeFile(newExeFil);
 		aObjFil-> libObjFil= FALSE;
-		if (!aObjFil-> LoadObjFileFromDisc(objFilLst[objFilInd], unResSymLst, pubSymLst))
+		lodWork.jobArr[objFilInd].objFil= aObjFil;
+		lodWork.jobArr[objFilInd].objFilNam= objFilLst[objFilInd];
+		lodWork.jobArr[objFilInd].lnkOK= FALSE;
+		objLst-> AddTail(aObjFil);
+ }
+
+	// Der aufrufende Thread arbeitet selbst mit, daher ein Thread weniger als Prozessoren
+	thrNum= 0;
+	if (parLod)
+	{
+		GetSystemInfo(&sysInf);
+		if (sysInf.dwNumberOfProcessors > 1)
+			thrNum= min(sysInf.dwNumberOfProcessors, MAX_LOD_OBJ_THR + 1) - 1;
+		if (thrNum > (DWORD)lodWork.jobNum)
+			thrNum= lodWork.jobNum;
+	}
+
+	for (thrInd= 0; thrInd < thrNum; thrInd++)
+	{
+		thrHdl[thrInd]= (HANDLE)_beginthreadex(NULL, 0, LodObjWorker, &lodWork, 0, NULL);
+		if (!thrHdl[thrInd])
+		{
+			thrNum= thrInd;
+			break;
+		}
+	}
+
+	LodObjWorker(&lodWork);
+
+	if (thrNum)
+	{
+		WaitForMultipleObjects(thrNum, thrHdl, TRUE, INFINITE);
+		for (thrInd= 0; thrInd < thrNum; thrInd++)
+			CloseHandle(thrHdl[thrInd]);
+	}
+
+ for(objFilInd= 0; objFilInd < lodWork.jobNum; objFilInd++)
+ {
+		aObjFil= lodWork.jobArr[objFilInd].objFil;
+		if (!lodWork.jobArr[objFilInd].lnkOK || !aObjFil-> AddObjFileData(unResSymLst, pubSymLst))
 			lnkOK= FALSE;
 		else
 		{
 			newExeFil-> lodObjSecNum++;
 			srcObjFilLst-> AddTail(aObjFil);
 		}
-		objLst-> AddTail(aObjFil);
-		objFilInd++;
  }
 
+	free(lodWork.jobArr);
+
 	if (!lnkOK) return FALSE;
 	
 	if (!objFilInd)
@@ -280,10 +449,7 @@ BOOL CObj2Exe::InitLinker()
 
  if (!pubSymLst-> Lookup(startUpSym, (void *&)symBuf))
  {
-			if (oneLibLst)
-				startUpObjFil= FndSymInLibsOneList(startUpSym, aLibFil);
-			else
-				startUpObjFil= FndSymInLibs(startUpSym, aLibFil);
+			startUpObjFil= FndSymInLibs(startUpSym, aLibFil);
 			
 			if (startUpObjFil)
 			{
@@ -292,7 +458,7 @@ BOOL CObj2Exe::InitLinker()
 				aObjFil-> objMemFil= startUpObjFil;
 				aObjFil-> objMemFil-> SeekToBegin();
 				aObjFil-> objFilBuf= (BYTE *)aObjFil-> objMemFil-> ReadWithoutMemcpy();
-				aObjFil-> libFilNam= (char *)malloc(strlen(aLibFil-> filNam) + 1);
+				aObjFil-> libFilNam= (char *)CMyArena::AllocFrom(aObjFil-> objAre, strlen(aLibFil-> filNam) + 1);
 				strcpy(aObjFil-> libFilNam, aLibFil-> filNam);
 				aObjFil->  objFilNam= aLibFil-> lstAccObjFil;
 				aObjFil-> libFilInd= aLibFil-> libFilInd;
@@ -483,10 +649,7 @@ BOOL CObj2Exe::ResolveSymbols()
 		}
 		else		// Symbol nicht in der Liste der aufgelsten Symbole
 		{						
-			if (oneLibLst)
-				newObjFilRawDat= FndSymInLibsOneList(symNam, (CLibFile *&)curLibFil);
-			else
-				newObjFilRawDat= FndSymInLibs(symNam, (CLibFile *&)curLibFil);
+			newObjFilRawDat= FndSymInLibs(symNam, (CLibFile *&)curLibFil);
 			
 			if (newObjFilRawDat)
 			{
@@ -497,7 +660,7 @@ BOOL CObj2Exe::ResolveSymbols()
 				newObjFil-> objFilBuf= (BYTE *)newObjFil-> objMemFil-> ReadWithoutMemcpy();
     newObjFil-> objFilNam= curLibFil-> lstAccObjFil;
 
-				newObjFil-> libFilNam= (char *)malloc(strlen(curLibFil-> filNam) + 1);
+				newObjFil-> libFilNam= (char *)CMyArena::AllocFrom(newObjFil-> objAre, strlen(curLibFil-> filNam) + 1);
 				strcpy(newObjFil-> libFilNam, curLibFil-> filNam);
 
     newObjFil-> libFilInd= curLibFil-> libFilInd;
@@ -615,6 +778,16 @@ BOOL CObj2Exe::BuildExeFile()
 	else
 		return FALSE;
 }
+
+/**************************************************************************************************/
+/*** Festhalten der Anordnung der erzeugten PE-Datei in der Linkzustandsdatei fr das nchste,  ***/
+/*** inkrementelle Linken                                                                       ***/
+/**************************************************************************************************/
+
+BOOL CObj2Exe::RecordLinkLayout(CLinkState *lnkSta)
+{
+	return lnkSta-> RecordLayout(newExeFil);
+}
 	
 /**************************************************************************************************/
 /*** Hilfsmethode zum Debuggen																																																																		***/
@@ -687,103 +860,30 @@ void CObj2Exe::WriteObjSym()
 }
 				
 /**************************************************************************************************/
-/*** Suchen nach einem Symbol in den Bibliotheksverzeichnissen bei Verwendung von einem Ver-			 ***/
-/*** zeichnis pro Bibliothek. Rckgabe des Objektmoduls, in dem sich das Symbol befindet.							***/
+/*** Suche nach einem Symbol im Gesamtbibliotheksverzeichnis. Rckgabe des Objektmoduls, in dem ***/
+/*** sich das Symbol befindet.                                                                  ***/
 /**************************************************************************************************/
 
 CMyMemFile* CObj2Exe::FndSymInLibs(char *sNam, CLibFile *&curLibFil)
-{
-	myPublicLibEntry *libEnt;
-	CMyMemFile  					*objFilRawDat;
-	POSITION 			 				libPos;
-	
-	libPos= libLst-> GetHeadPosition();
-	objFilRawDat= NULL;
-			
-	while(!objFilRawDat && libPos)
-	{
-		curLibFil= (CLibFile *)libLst-> GetNext(libPos);
-		if (curLibFil-> pubLibSymLst-> Lookup(sNam, (void *&)libEnt))
-		{
-			objFilRawDat= curLibFil-> ReadLibObjFile(libEnt-> achMemOff);
-			if ((DWORD) objFilRawDat != 0xFFFFFFFF)
-				return objFilRawDat;
-			else
-				return NULL;
-		}
-	}
-
- // Symbol konnte nicht gefunden werden, mglicherweise Symbolname nicht richtig.
-	// Kommt bei Microsoft manchmal vor.	
-	// Neuer Suchversuch mit anderer Anzahl der '_' vor dem Symbolnamen.
-	
-	CString newSrhNam("_");
-
-	newSrhNam+= sNam;
-
-	libPos= libLst-> GetHeadPosition();
-		
-	while(!objFilRawDat && libPos)
-	{
-		curLibFil= (CLibFile *)libLst-> GetNext(libPos);
-		if (curLibFil-> pubLibSymLst-> Lookup(newSrhNam.GetBuffer(20), (void *&)libEnt))
-		{
-			objFilRawDat= curLibFil-> ReadLibObjFile(libEnt-> achMemOff);
-			if ((DWORD) objFilRawDat != 0xFFFFFFFF)
-			{
-				WriteMessageToPow(WRN_MSGS_NO_SYM, sNam, newSrhNam.GetBuffer(20));
-				return objFilRawDat;
-			}
-			else
-				return NULL;
-		}
-	}
-	
-	return NULL;
-}
-
-/**************************************************************************************************/
-/*** Suche nach einem Symbol im Gesamtbibliotheksverzeichnis, beim Verwenden eines Verzeichnis- ***/
-/*** ses fr alle Bibliotheken.	Rckgabe des Objektmoduls, in dem sich das Symbol befindet.					***/
-/**************************************************************************************************/
-
-CMyMemFile* CObj2Exe::FndSymInLibsOneList(char *sNam, CLibFile *&curLibFil)
 {
 	myPublicLibEntry *libEnt;
 	CMyMemFile 	 				*objFilRawDat;
 	
-	if (pubLibSymLst-> Lookup(sNam, (void *&)libEnt))
-	{
-		curLibFil= libEnt-> myLibFil;
-		objFilRawDat= libEnt-> myLibFil-> ReadLibObjFile(libEnt-> achMemOff);
-		if ((DWORD) objFilRawDat != 0xFFFFFFFF)
-			return objFilRawDat;
-		else
-			return NULL;
-	}
+	if (!pubLibSymLst-> Lookup(sNam, (void *&)libEnt))
+		return NULL;
+
+	curLibFil= libEnt-> myLibFil;
+	objFilRawDat= libEnt-> myLibFil-> ReadLibObjFile(libEnt-> achMemOff);
+	if ((DWORD) objFilRawDat == 0xFFFFFFFF)
+		return NULL;
 
-	// Symbol konnte nicht gefunden werden, mglicherweise Symbolname nicht richtig.
+	// Symbol wurde nur mit zustzlichem '_' vor dem Symbolnamen gefunden (Alias).
 	// Kommt bei Microsoft manchmal vor.	
-	// Neuer Suchversuch mit anderer Anzahl der '_' vor dem Symbolnamen.
-	
-	CString newSrhNam("_");
 
-	newSrhNam+= sNam;
+	if (libEnt-> aliEnt)
+		WriteMessageToPow(WRN_MSGS_NO_SYM, sNam, libEnt-> achMemSym);
 
-	if (pubLibSymLst-> Lookup(newSrhNam.GetBuffer(256), (void *&)libEnt))
-	{
-		curLibFil= libEnt-> myLibFil;
-		objFilRawDat= libEnt-> myLibFil-> ReadLibObjFile(libEnt-> achMemOff);
-		if ((DWORD) objFilRawDat != 0xFFFFFFFF)
-		{
-			WriteMessageToPow(WRN_MSGS_NO_SYM, sNam, newSrhNam.GetBuffer(20));
-			return objFilRawDat;
-		}
-		else
-			return NULL;
-	}
-	
-	return NULL;
+	return objFilRawDat;
 }
 
 /**************************************************************************************************/
@@ -795,6 +895,11 @@ BOOL CObj2Exe::FreeLibFiles()
  CLibFile *curLibFil;
  POSITION libPos;
  	
+	if (libFilCac)
+	{
+		libFilCac-> ReleaseLibFiles(libLst);
+		libLst-> RemoveAll();
+	}
 	libPos= libLst-> GetHeadPosition();
 	while(libPos)
 	{
@@ -26,6 +26,8 @@
 #include "MyColl.hpp"
 #endif
 
+class CLinkState;
+
 /**************************************************************************************************/
 /**************************************************************************************************/
 /**************************************************************************************************/
@@ -48,13 +50,15 @@ class CObj2Exe : public CObject
   DWORD			incDbgInf;
 		FARPROC ErrMsgFnc;
   DWORD   stackSize;
+  CLibFileCache *libFilCac;    // Bibliothekscache des Linkers, NULL ohne Cache
 
 	
 	protected:
-		CMyMapStringToPtr	*pubSymLst;
-		CMyMapStringToPtr *pubLibSymLst;
+		CMySymbolTable	*pubSymLst;
+		CMySymbolTable *pubLibSymLst;
 		CExeFile	         *newExeFil;
 		CMyObList		       *libLst;
+		CMyObList		       *libMapFilLst;   // Eingeblendete Bibliotheken, leben bis zum Ende des Linkens
 		CMyObList		       *objLst;
   CMyObList         *srcObjFilLst;
 		CMyPtrList		      *unResSymLst;		
@@ -71,6 +75,7 @@ public:
 		BOOL ResolveRelocations();
 		BOOL BuildDebugInformation();
 		BOOL BuildExeFile();	
+		BOOL RecordLinkLayout(CLinkState *lnkSta);
 		BOOL SearchForSym(char *aSym);
   BOOL FreeLibFiles();
 
@@ -85,7 +90,6 @@ private:
 		// Suche nach einem Symobl in den Bibliotheken
 
 		CMyMemFile *FndSymInLibs(char *sNam, CLibFile *&curLibFil);
-		CMyMemFile *FndSymInLibsOneList(char *sNam, CLibFile *&curLibFil);
 };
 
 #endif	
@@ -43,6 +43,8 @@ extern void FreeCMemFile(CMemFile *aCMemFile);
 extern void FreeCMyMemFile(CMyMemFile *aCMyMemFile);
 extern void FreeCMyPtrList(CMyPtrList *aCMyPtrList);
 
+extern CMyArena *lnkAre;  // In Linker.cpp definiert
+
 
 IMPLEMENT_DYNAMIC(CObjFile, CObject)
 
@@ -57,6 +59,7 @@ IMPLEMENT_DYNAMIC(CObjFile, CObject)
 CObjFile::CObjFile()
 {
 	objFilBuf= NULL;
+	objMapFil= NULL;
 	srcFilNam= NULL;
 	objFilNam= NULL;																								
 	libFilNam= NULL;
@@ -77,6 +80,7 @@ CObjFile::CObjFile()
 	sstGloTypRawDat= NULL;
  libFilInd= 0;
 	cvModInd= 0xFFFF;
+	objAre= lnkAre;
 }
 
 /******************************************************************************************************/
@@ -104,19 +108,24 @@ void CObjFile::FreeUsedMemory()
 	int		entInLst;
 	int		i;
 
-	if (objFilBuf)
+	// objFilBuf zeigt in die eingeblendete Objekt- oder Bibliotheksdatei und wird nicht
+	// freigegeben. Bibliotheken werden von CObj2Exe::libMapFilLst freigegeben.
+
+	objFilBuf= NULL;
+	if (objMapFil)
 	{
-		free(objFilBuf);
-		objFilBuf= NULL;
+		objMapFil-> ~CMapFile();
+		delete objMapFil;
+		objMapFil= NULL;
 	}
 	if (srcFilNam)
 	{
-		free(srcFilNam);
+		CMyArena::FreeTo(objAre, srcFilNam);
 		srcFilNam= NULL;
 	}
 	if (objFilNam)
 	{
-		free(objFilNam);
+		CMyArena::FreeTo(objAre, objFilNam);
 		objFilNam= NULL;
 	}
 	if (secLstLst)
@@ -143,12 +152,12 @@ void CObjFile::FreeUsedMemory()
 	}
  if (newSymLst)
  { 
-  free(newSymLst);
+  CMyArena::FreeTo(objAre, newSymLst);
   newSymLst= NULL;
  }
  if (symEntBuf)
  {
-  free(symEntBuf);
+  CMyArena::FreeTo(objAre, symEntBuf);
   symEntBuf= NULL;
  }
  if (objMemFil)
@@ -159,7 +168,7 @@ void CObjFile::FreeUsedMemory()
  }
 	if (libFilNam)
 	{
-		free(libFilNam);
+		CMyArena::FreeTo(objAre, libFilNam);
 		libFilNam= NULL;
 	}
 	if	(freSymNamLst)
@@ -181,7 +190,7 @@ void CObjFile::FreeUsedMemory()
 	}
  if (symEntBuf)
  {
-  free(symEntBuf);  
+  CMyArena::FreeTo(objAre, symEntBuf);  
   symEntBuf= NULL;
  }
 	if (sstGloTypRawDat)
@@ -198,38 +207,43 @@ void CObjFile::FreeUsedMemory()
 /*** Einlesen einer Objektdatei und Aufruf der Methode zum Analysieren derselben																				***/
 /******************************************************************************************************/
 
-BOOL CObjFile::LoadObjFileFromDisc(const char *pszFilNam, CMyPtrList *unResSymLst, CMyMapStringToPtr *pubSymLst)
+BOOL CObjFile::LoadObjFileFromDisc(const char *pszFilNam, CMyPtrList *unResSymLst, CMySymbolTable *pubSymLst)
+{
+	if (!ReadObjFileFromDisc(pszFilNam))
+		return FALSE;
+
+	return AddObjFileData(unResSymLst, pubSymLst);
+}                                                                              
+
+/******************************************************************************************************/
+/*** Einlesen und Zerlegen einer Objektdatei, ohne Daten der PE-Datei oder die gemeinsamen Symbol-  ***/
+/*** listen zu verndern. Kann daher fr mehrere Objektdateien gleichzeitig aufgerufen werden.      ***/
+/******************************************************************************************************/
+
+BOOL CObjFile::ReadObjFileFromDisc(const char *pszFilNam)
 {
-	CFileException *pErr= NULL;
-	CBuffFile 		  		objFil;
-	CMyMemFile						*objMemFil;
-		
-	DWORD	objFilSiz;
-	BOOL		lnkOK= TRUE;
 				
-	objFilNam= (char *) malloc(strlen(pszFilNam) + 1);
+	objFilNam= (char *) CMyArena::AllocFrom(objAre, strlen(pszFilNam) + 1);
 	objFilNam= strcpy(objFilNam, (char *)pszFilNam);
 	                                                                             
-	if (!objFil.Open(pszFilNam, CStdioFile::modeRead | CStdioFile::typeBinary, pErr))
+	// Die Objektdatei wird eingeblendet und direkt in der Ansicht analysiert. Die Ansicht
+	// bleibt bis zur Freigabe des Objekts erhalten (Symbolnamen, Rohdaten der Sektionen).
+
+	objMapFil= new CMapFile();
+	if (!objMapFil-> Open(pszFilNam))
 	{
 		WriteMessageToPow(ERR_MSGI_OPN_OBJ, (char *)pszFilNam, NULL);
+		objMapFil-> ~CMapFile();
+		delete objMapFil;
+		objMapFil= NULL;
 		return FALSE;
 	}
 	else
 		WriteMessageToPow(INF_MSG_FIL_OPE_SUC, (char *)pszFilNam, NULL);
 		
-	objFilSiz= objFil.GetLength();
-	objFilBuf= (BYTE *) malloc(objFilSiz + 1);
-	objFil.ReadHuge(objFilBuf, objFilSiz);
-	objFil.Close();
-	objMemFil= new CMyMemFile();
- objMemFil-> SetBufferDirect(objFilBuf, objFilSiz);
-	lnkOK= AnalObjFileData(objMemFil, unResSymLst, pubSymLst);
- objMemFil-> ~CMyMemFile(); 
- delete objMemFil;
- objMemFil= NULL;
+	objFilBuf= (BYTE *)objMapFil-> ReadWithoutMemcpy();
 
-	return lnkOK;
+	return ParseObjFileData(objMapFil);
 }                                                                              
 
 /******************************************************************************************************/
@@ -237,11 +251,22 @@ BOOL CObjFile::LoadObjFileFromDisc(const char *pszFilNam, CMyPtrList *unResSymLs
 /***	(Rohdaten, Relokationen und Zeilennummern), sowie Aufarbeiten der Symboltabelle.															***/
 /******************************************************************************************************/
 
-BOOL CObjFile::AnalObjFileData(CMyMemFile *aMemFil, CMyPtrList *unResSymLst, CMyMapStringToPtr *pubSymLst)
+BOOL CObjFile::AnalObjFileData(CMyMemFile *aMemFil, CMyPtrList *unResSymLst, CMySymbolTable *pubSymLst)
+{
+	if (!ParseObjFileData(aMemFil))
+		return FALSE;
+
+	return AddObjFileData(unResSymLst, pubSymLst);
+}
+
+/******************************************************************************************************/
+/*** Zerlegen einer Objektdatei: Header, Sektionstabelle und Sektionen (Rohdaten, Relokationen,     ***/
+/*** Zeilennummern), sowie Dekodieren der Symboltabelle. Verndert nur Daten des Objekts selbst.    ***/
+/******************************************************************************************************/
+
+BOOL CObjFile::ParseObjFileData(CMyMemFile *aMemFil)
 {
-	CSectionFragmentEntry		*newSecFrg;
 	CObjFileSection								*newSec;
-	CObjFileSection								*txtSec;
 	mySymbolEntry										*nxtSymEnt;
 		
 	DWORD	actFilSekPos;
@@ -292,18 +317,6 @@ BOOL CObjFile::AnalObjFileData(CMyMemFile *aMemFil, CMyPtrList *unResSymLst, CMy
  else
   incDllFun= FALSE;
 
- if (!incDllFun)										  
- {
-  for(i= 0; i < objCofHdr.secNum; i++)
-	 {
-	 	newSec= (CObjFileSection *)secLst-> GetAt(i);
-   if (newSec-> actSecTab-> rawDatSiz) 
-    lnkOK= newSec-> WrapFromObj2Exe(this, ftrExeFil);  
-	 }
-		if (!lnkOK)
-			return lnkOK;
-	}
-
 	// Einlesen der Symboltabelle
  
  strTabPtr= objCofHdr.symTabPtr + objCofHdr.symNum * SYM_TAB_LEN;
@@ -315,19 +328,57 @@ BOOL CObjFile::AnalObjFileData(CMyMemFile *aMemFil, CMyPtrList *unResSymLst, CMy
 	aMemFil-> Seek(objCofHdr.symTabPtr, CFile::begin);
 
  DWORD symEntSiz= sizeof(mySymbolEntry);
- symEntBuf= (BYTE *) malloc (symEntSiz * objCofHdr.symNum);
+ symEntBuf= (BYTE *) CMyArena::AllocFrom(objAre, symEntSiz * objCofHdr.symNum);
  memset(symEntBuf, 0, symEntSiz * objCofHdr.symNum);
- newSymLst= (mySymbolEntry **) malloc (sizeof(mySymbolEntry*) * objCofHdr.symNum);
+ newSymLst= (mySymbolEntry **) CMyArena::AllocFrom(objAre, sizeof(mySymbolEntry*) * objCofHdr.symNum);
  memset(newSymLst, 0, sizeof(mySymbolEntry*) * objCofHdr.symNum);
  nxtSymEnt= (mySymbolEntry *)symEntBuf;
 	
 	while(actSymInd < objCofHdr.symNum)
 	{
   newSymLst[actSymInd]= (mySymbolEntry *)nxtSymEnt;
-  actSymInd+= ReadSymEntData(nxtSymEnt, aMemFil, strTabPtr, this, unResSymLst, pubSymLst);		
+  actSymInd+= ReadSymEntData(nxtSymEnt, aMemFil, strTabPtr, this);		
 		nxtSymEnt= (mySymbolEntry *)symEntBuf + actSymInd;
 	}	
 
+	return lnkOK;
+}
+
+/******************************************************************************************************/
+/*** Eintragen einer zerlegten Objektdatei: Zuordnen der Sektionen zu den Sektionen der PE-Datei,   ***/
+/*** Eintragen der Symbole in die gemeinsamen Symbollisten und Ermitteln der Daten eines DLL-Imports.***/
+/*** Die Objektdateien mssen in der Reihenfolge des Linkaufrufs eingetragen werden.                ***/
+/******************************************************************************************************/
+
+BOOL CObjFile::AddObjFileData(CMyPtrList *unResSymLst, CMySymbolTable *pubSymLst)
+{
+	CSectionFragmentEntry		*newSecFrg;
+	CObjFileSection								*newSec;
+	CObjFileSection								*txtSec;
+		
+	DWORD	actSymInd;
+	WORD		i;													
+	BOOL		lnkOK= TRUE;
+
+ if (!incDllFun)										  
+ {
+  for(i= 0; i < objCofHdr.secNum; i++)
+	 {
+	 	newSec= (CObjFileSection *)secLst-> GetAt(i);
+   if (newSec-> actSecTab-> rawDatSiz) 
+    lnkOK= newSec-> WrapFromObj2Exe(this, ftrExeFil);  
+	 }
+		if (!lnkOK)
+			return lnkOK;
+	}
+
+	actSymInd= 0;
+	while(actSymInd < objCofHdr.symNum)
+	{
+		AddSymEnt(newSymLst[actSymInd], unResSymLst, pubSymLst);
+		actSymInd+= newSymLst[actSymInd]-> actSymTab-> auxSymNum + 1;
+	}
+
  // berpfen ob Dll Import und ermitteln der Funktionsdaten
 
 	if (incDllFun)
@@ -482,10 +533,9 @@ void CObjFile::WriteSymToFile()
 /******************************************************************************************************/
 
 DWORD CObjFile::ReadSymEntData(mySymbolEntry *actSymEnt, CMyMemFile *actObjRawDat, DWORD ptrToStrTab, 
-                               CObjFile *actObjFil, CMyPtrList *unResSymLst, CMyMapStringToPtr *pubSymLst)
+                               CObjFile *actObjFil)
 {
  mySymbolTable *actSymTab;
- mySymbolEntry *resSymEnt;
  
  DWORD sekPos;		
 
@@ -499,13 +549,16 @@ DWORD CObjFile::ReadSymEntData(mySymbolEntry *actSymEnt, CMyMemFile *actObjRawDa
 
 		if (actSymTab-> val && (actSymTab-> strTabOff / 0x1000000 > 0)) // berprfen ob 8.Byte nicht sowieso Null enthlt.
 		{
-			actSymEnt-> symNam= (char *)malloc(2 * sizeof(DWORD) + 1);
+			actSymEnt-> symNam= (char *)CMyArena::AllocFrom(objAre, 2 * sizeof(DWORD) + 1);
 			memset(actSymEnt-> symNam, 0x00, 2 * sizeof(DWORD) + 1);
 			strncpy(actSymEnt-> symNam, (char *)actSymTab, 2 * sizeof(DWORD));
-			if (!freSymNamLst)
-				freSymNamLst= new CMyPtrList(50);
+			if (!objAre)
+			{
+				if (!freSymNamLst)
+					freSymNamLst= new CMyPtrList(50);
 
-			freSymNamLst-> AddTail(actSymEnt-> symNam);
+				freSymNamLst-> AddTail(actSymEnt-> symNam);
+			}
 		}
 		else
 			actSymEnt-> symNam= (char *)actSymTab;
@@ -524,13 +577,33 @@ DWORD CObjFile::ReadSymEntData(mySymbolEntry *actSymEnt, CMyMemFile *actObjRawDa
 	{
 		if (!srcFilNam)
 		{
-			srcFilNam= (char *) malloc(actSymTab-> auxSymNum * SYM_TAB_LEN + 1);
+			srcFilNam= (char *) CMyArena::AllocFrom(objAre, actSymTab-> auxSymNum * SYM_TAB_LEN + 1);
 			memset(srcFilNam, 0x00, actSymTab-> auxSymNum * SYM_TAB_LEN + 1);
 			sekPos= actObjRawDat-> GetPosition();
 			actObjRawDat-> Read(srcFilNam, actSymTab-> auxSymNum * SYM_TAB_LEN);
 			actObjRawDat-> Seek(sekPos, CFile::begin);
 		}
 	}
+
+	// berlesen der Hilfssymboleintrge
+
+	actObjRawDat-> Seek(actSymTab->  auxSymNum * SYM_TAB_LEN, CFile::current);
+ 
+	return actSymTab->  auxSymNum + 1;
+}
+
+/******************************************************************************************************/
+/*** Eintragen eines gelesenen Symbols in die Liste der ffentlichen oder der unaufgelsten Symbole ***/
+/******************************************************************************************************/
+
+void CObjFile::AddSymEnt(mySymbolEntry *actSymEnt, CMyPtrList *unResSymLst, CMySymbolTable *pubSymLst)
+{
+ mySymbolTable *actSymTab;
+ mySymbolEntry *resSymEnt;
+ CObjFile      *actObjFil;
+
+ actSymTab= actSymEnt-> actSymTab;
+ actObjFil= actSymEnt-> symObjFil;
 	
  if (actSymTab-> secNum) // Zeiger in Sektion desselben Objectfiles --> mgl. Debug Information
 	{
@@ -570,11 +643,9 @@ DWORD CObjFile::ReadSymEntData(mySymbolEntry *actSymEnt, CMyMemFile *actObjRawDa
     if (actSymTab-> storClass == IMAGE_SYM_CLASS_WEAK_EXTERNAL) // Weak External
     {
      mySymbolTable *weakExt;
-     sekPos= actObjRawDat-> GetPosition();
-     weakExt= (mySymbolTable *)actObjRawDat-> ReadWithoutMemcpy(SYM_TAB_LEN);
+     weakExt= (mySymbolTable *)((BYTE *)actSymTab + SYM_TAB_LEN);   // Erster Hilfssymboleintrag
      actSymEnt-> resSym= (mySymbolEntry *)symEntBuf + weakExt-> zero;
      unResSymLst-> AddTail(actSymEnt);		
-     actObjRawDat-> Seek(sekPos, CFile::begin);
     }
     else
     {
@@ -599,10 +670,4 @@ DWORD CObjFile::ReadSymEntData(mySymbolEntry *actSymEnt, CMyMemFile *actObjRawDa
 			}
 		}
 	}
-
-	// berlesen der Hilfssymboleintrge
-
-	actObjRawDat-> Seek(actSymTab->  auxSymNum * SYM_TAB_LEN, CFile::current);
- 
-	return actSymTab->  auxSymNum + 1;
 }
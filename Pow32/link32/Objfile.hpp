@@ -40,6 +40,7 @@ class CObjFile : public CObject
 	friend class CExeFileDebugSection;
 	friend class CObj2Exe;
 	friend class CSectionFragmentEntry;
+	friend class CLinkState;
 
 	public:
 		CDllExportEntry *incExpEnt;
@@ -49,6 +50,7 @@ class CObjFile : public CObject
 	 char	*libFilNam;
   BYTE *symEntBuf;
 		BYTE *objFilBuf;
+		CMyArena *objAre;   // Linkspeicher fr Namen und Symboleintrge, NULL --> malloc
 		
   WORD libFilInd;
 		WORD	cvModInd;
@@ -65,6 +67,7 @@ class CObjFile : public CObject
   myCoffHeader 		  objCofHdr; 
 
   CMyMemFile       *objMemFil;
+  CMapFile         *objMapFil;   // Eingeblendete Objektdatei, objFilBuf zeigt in die Ansicht
 		CMyPtrList							*freSymNamLst;		/* Liste aller freizugebender Symbolnamen die 8 Zeichen */
 																																			/* lang sind, und bei denen das nchste Byte im Record  */
 																																			/* nicht (val) nicht Null ist																											*/	
@@ -81,8 +84,11 @@ class CObjFile : public CObject
 
 		void FreeUsedMemory();
 
-	 BOOL LoadObjFileFromDisc(const char *pszFilNam, CMyPtrList *unResSymLst, CMyMapStringToPtr *pubSymLst);
-	 BOOL AnalObjFileData(CMyMemFile *aMemFil, CMyPtrList *unResSymst, CMyMapStringToPtr *pubSymLst);
+	 BOOL LoadObjFileFromDisc(const char *pszFilNam, CMyPtrList *unResSymLst, CMySymbolTable *pubSymLst);
+	 BOOL AnalObjFileData(CMyMemFile *aMemFil, CMyPtrList *unResSymst, CMySymbolTable *pubSymLst);
+	 BOOL ReadObjFileFromDisc(const char *pszFilNam);
+	 BOOL ParseObjFileData(CMyMemFile *aMemFil);
+	 BOOL AddObjFileData(CMyPtrList *unResSymLst, CMySymbolTable *pubSymLst);
 	 BOOL SplitObjSec(CExeFile *aExeFil);
 	 void SetExeFile(CExeFile *ftrExeFil);
 	 void WriteSymToFile();
@@ -91,7 +97,8 @@ class CObjFile : public CObject
 
  private:
   DWORD CObjFile::ReadSymEntData(mySymbolEntry *actSymEnt, CMyMemFile *actObjRawDat, DWORD ptrToStrTab, 
-                                 CObjFile *actObjFil, CMyPtrList *unResSymLst, CMyMapStringToPtr *pubSymLst);
+                                 CObjFile *actObjFil);
+  void AddSymEnt(mySymbolEntry *actSymEnt, CMyPtrList *unResSymLst, CMySymbolTable *pubSymLst);
 };
 
 #endif
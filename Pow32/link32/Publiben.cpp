@@ -28,14 +28,15 @@ extern void WriteMessageToPow(WORD msgNr, char *str1, char *str2);
 
 extern BYTE chrBuf00[];
  
-extern void FreeCResUniCodeString(CResUniCodeString *aCResUniCodeString);
-extern void FreeCMyMemFile(CMyMemFile *aCMyMemFile);
 extern void FreeCMyObList(CMyObList *aCMyObList);
 
 extern	FILE		*logFil;
 extern	char		*logFilNam;        
 extern 	int			logOn;   
 
+extern CMyArena *lnkAre;  // In Linker.cpp definiert
+extern BOOL incLnk;       // In Linker.cpp definiert
+
 IMPLEMENT_DYNAMIC(CDllExportEntry, CObject)
 IMPLEMENT_DYNAMIC(CSectionFragmentEntry, CObject)
 IMPLEMENT_DYNAMIC(CResUniCodeString, CObject)
@@ -176,7 +177,9 @@ CSectionFragmentEntry::CSectionFragmentEntry()
 	secFrgRelBuf= NULL;
 	rawDat= NULL;
 	rawDatSiz= 0;
+	frgCap= 0;
 	secFrgAln= 16;
+	frgRef= TRUE;
 }
 
 /**************************************************************************************************/
@@ -192,8 +195,10 @@ CSectionFragmentEntry::CSectionFragmentEntry(CExeFileDataSection *exeSec, DWORD
 	secFrgRelBuf= homSec-> secRelBuf;
 	rawDat= homSec-> secRawDat;
 	rawDatSiz= homSec-> actSecTab-> rawDatSiz;
+	frgCap= rawDatSiz;
 	secFrgObjFil= frgObjFil;
 	secFrgAln= sFrgAln;
+	frgRef= TRUE;
 }	
 
 /**************************************************************************************************/
@@ -213,6 +218,24 @@ CSectionFragmentEntry::~CSectionFragmentEntry()
 /**************************************************************************************************/
 /**************************************************************************************************/
 
+void *CSectionFragmentEntry::operator new(size_t objSiz)
+{
+	return CMyArena::NewObject(lnkAre, objSiz);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CSectionFragmentEntry::operator delete(void *aObj)
+{
+	CMyArena::DeleteObject(aObj);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
 void CSectionFragmentEntry::FreeUsedMemory()
 {
 	actExeSec= NULL;
@@ -221,6 +244,7 @@ void CSectionFragmentEntry::FreeUsedMemory()
 	rawDat= NULL;
 	secFrgOff= 0;
 	rawDatSiz= 0;
+	frgCap= 0;
 	secFrgAln= 0;	
 }
 
@@ -242,10 +266,356 @@ DWORD CSectionFragmentEntry::GetRawDataSize()
  return rawDatSiz;
 }
 
+/**************************************************************************************************/
+/*** Festlegen des Platzes, den das Fragment in der PE-Datei Sektion belegt. Beim inkrementel-  ***/
+/*** len Linken erhalten die Fragmente der Objektdateien des Linkaufrufs eine Reserve, in die   ***/
+/*** sie beim nchsten Linkvorgang hineinwachsen knnen, ohne da die folgenden Fragmente ver-  ***/
+/*** schoben werden mssen. Der Platz ist ein Vielfaches von frgAln.                            ***/
+/**************************************************************************************************/
+
+void CSectionFragmentEntry::SetFragCapacity(WORD frgAln)
+{
+	DWORD frgSlk;
+
+	frgCap= rawDatSiz;
+	if (!incLnk || secFrgObjFil-> libObjFil)
+		return;
+
+	frgSlk= max(rawDatSiz / INC_LNK_SLK_DIV, INC_LNK_SLK_MIN);
+	frgCap+= frgSlk;
+	if (frgAln && frgCap % frgAln)
+		frgCap+= frgAln - frgCap % frgAln;
+}
+
+/**************************************************************************************************/
+/*** Rckgabe des Platzes des Sektionsfragments in der PE-Datei Sektion                         ***/
+/**************************************************************************************************/
+
+DWORD CSectionFragmentEntry::GetFragCapacity()
+{
+ return frgCap;
+}
+
+/**************************************************************************************************/
+/*** Behandlungsroutinen der einzelnen Relokationstypen, siehe myRelFixup in PubLibEn.hpp       ***/
+/**************************************************************************************************/
+
+typedef void (*RelFixupHdl)(myRelFixup *relFix);
+
+/*** DIR32 ***/
+
+static void RelFixupDir32(myRelFixup *relFix)
+{
+	relFix-> relNed= TRUE;
+	if (!relFix-> dllSym)
+	{
+		if (relFix-> resSym)
+		{
+			if (relFix-> resSym-> bssOff)
+				relFix-> adrBuf+= relFix-> resSym-> bssOff;
+			else
+			{
+				relFix-> adrBuf+= relFix-> imBase + relFix-> resSymSecFrgOff + relFix-> resSym-> val;
+				if (!relFix-> imBase)
+					relFix-> relNed= FALSE;
+			}
+		}
+		else
+		{
+			if (relFix-> actSym-> bssOff)
+				relFix-> adrBuf+= relFix-> actSym-> bssOff;
+			else
+			{
+				WriteMessageToPow(ERR_MSGR_DIR32, relFix-> actSym-> symNam, NULL);
+				relFix-> relNed= FALSE;
+			}
+		}
+	}	
+	else
+	{
+		relFix-> adrBuf= relFix-> dllLokUpTabOff;
+		relFix-> relNed= FALSE;
+	}
+}
+
+/*** DIR32NB ***/
+
+static void RelFixupDir32NB(myRelFixup *relFix)
+{
+	if (!relFix-> dllSym)
+	{
+		if (relFix-> resSym)
+		{
+			if (relFix-> resSym-> bssOff)
+				relFix-> adrBuf+= relFix-> resSym-> bssOff;
+			else
+				relFix-> adrBuf+= relFix-> resSymSecFrgOff + relFix-> resSym-> val;					
+		}
+		else
+			WriteMessageToPow(ERR_MSGR_DIR32NB, relFix-> actSym-> symNam, NULL);
+	}
+}
+
+/*** SECREL ***/
+
+static void RelFixupSecRel(myRelFixup *relFix)
+{
+	if (!relFix-> dllSym)
+	{
+		if (relFix-> resSym)
+			relFix-> adrBuf+= relFix-> resSymSecFrgOff + relFix-> resSym-> val;
+		else
+			WriteMessageToPow(ERR_MSGR_SECREL, relFix-> actSym-> symNam, NULL);
+	}
+}
+
+/*** SECTION, wird wie bisher anschlieend noch wie SECREL behandelt ***/
+
+static void RelFixupSection(myRelFixup *relFix)
+{
+	if (!relFix-> dllSym)
+	{
+		if (relFix-> resSym)
+			relFix-> adrBuf+= relFix-> resSymSecFrgOff + relFix-> resSym-> val;
+		else
+			WriteMessageToPow(ERR_MSGR_SECTION, relFix-> actSym-> symNam, NULL);
+	}
+	RelFixupSecRel(relFix);
+}
+
+/*** REL32 ***/
+
+static void RelFixupRel32(myRelFixup *relFix)
+{
+	if (!relFix-> dllSym)
+	{
+		if (relFix-> resSym)
+			relFix-> adrBuf+= relFix-> resSymSecFrgOff + relFix-> resSym-> val - (relFix-> nxtInsAdr + relFix-> adrBuf);
+		else
+			WriteMessageToPow(ERR_MSGR_REL32, relFix-> actSym-> symNam, NULL);
+	}
+	else
+		relFix-> adrBuf= relFix-> dllTxtSegOff - (relFix-> nxtInsAdr + relFix-> adrBuf);
+}
+
+/*** Behandlungsroutinen nach Relokationstyp, NULL fr nicht untersttzte Typen ***/
+
+#define REL_TYP_NUM 0x15
+
+static RelFixupHdl relFixupHdlTab[REL_TYP_NUM]=
+{
+	NULL, NULL, NULL, NULL, NULL, NULL,
+	RelFixupDir32,                        // 0x0006 DIR32
+	RelFixupDir32NB,                      // 0x0007 DIR32NB
+	NULL, NULL,
+	RelFixupSection,                      // 0x000A SECTION
+	RelFixupSecRel,                       // 0x000B SECREL
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	RelFixupRel32                         // 0x0014 REL32
+};
+
+/**************************************************************************************************/
+/*** Anwenden einer Relokation des Typs relTyp auf relFix. Rckgabe FALSE, wenn der Typ nicht   ***/
+/*** untersttzt wird. Wird auch beim inkrementellen Linken verwendet, siehe CLinkState.        ***/
+/**************************************************************************************************/
+
+BOOL CSectionFragmentEntry::FixupRelocation(WORD relTyp, myRelFixup *relFix)
+{
+	RelFixupHdl relHdl;
+
+	relHdl= relTyp < REL_TYP_NUM ? relFixupHdlTab[relTyp] : NULL;
+	if (!relHdl)
+		return FALSE;
+
+	relHdl(relFix);
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Markieren des Fragments, in dem ein Symbol liegt. Ein neu markiertes Fragment wird an      ***/
+/*** wrkLst angehngt, damit auch seine Relokationen verfolgt werden. Rckgabe TRUE, wenn das   ***/
+/*** Fragment bisher nicht markiert war.                                                        ***/
+/**************************************************************************************************/
+
+BOOL CSectionFragmentEntry::MarkSymFrag(mySymbolEntry *aSym, CMyPtrList *wrkLst)
+{
+	CObjFileSection       *symSec;
+	CSectionFragmentEntry *symFrg;
+
+	if ((short) aSym-> actSymTab-> secNum <= 0)	// ABS, Debug und .bss Variablen liegen in keinem Fragment
+		return FALSE;
+
+	symSec= (CObjFileSection *) (aSym-> symObjFil-> secLst-> GetAt(aSym-> actSymTab-> secNum - 1));
+	symFrg= symSec-> actFrgEnt;
+	if (!symFrg || symFrg-> frgRef)
+		return FALSE;
+
+	symFrg-> frgRef= TRUE;
+	wrkLst-> AddTail(symFrg);
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Markieren aller Fragmente, auf die die Relokationen dieses Fragments verweisen. DLL Importe***/
+/*** werden ber die .IDATA Sektion aufgelst und liegen in keinem Fragment.                    ***/
+/**************************************************************************************************/
+
+DWORD CSectionFragmentEntry::MarkRelFrags(CMyPtrList *wrkLst)
+{
+	myRelocationEntry *relEnt;
+	mySymbolEntry		 		*actSym;
+
+	DWORD relInd;
+	DWORD refNum= 0;
+
+	if (!secFrgRelBuf)
+		return 0;
+
+	for(relInd= 0; relInd < myHomSec-> actSecTab-> relNum; relInd++)
+	{
+		relEnt= (myRelocationEntry *)(secFrgRelBuf + 10 * relInd);
+		actSym= (mySymbolEntry *)secFrgObjFil-> newSymLst[relEnt-> symTabInd];
+		if (!actSym-> dllExpEnt && actSym-> resSym)
+			if (MarkSymFrag(actSym-> resSym, wrkLst))
+				refNum++;
+	}
+
+	return refNum;
+}
+
+/**************************************************************************************************/
+/*** Ziel einer Relokation fr den Vergleich identischer Fragmente. Bei Symbolen in einem Frag- ***/
+/*** ment ist das Ziel das (eventuell schon zusammengefate) Fragment und der Offset darin,     ***/
+/*** sonst das Symbol oder der DLL Exporteintrag selbst.                                        ***/
+/**************************************************************************************************/
+
+void CSectionFragmentEntry::GetRelTarget(myRelocationEntry *relEnt, void *&tgtKey, DWORD &tgtOff)
+{
+	CObjFileSection *resSymSec;
+	mySymbolEntry   *actSym;
+	mySymbolEntry   *resSym;
+
+	actSym= (mySymbolEntry *)secFrgObjFil-> newSymLst[relEnt-> symTabInd];
+	resSym= actSym-> resSym;
+	tgtOff= 0;
+
+	if (actSym-> dllExpEnt)
+	{
+		tgtKey= actSym-> dllExpEnt;
+		return;
+	}
+
+	tgtKey= resSym;
+	if (!resSym || (short) resSym-> actSymTab-> secNum <= 0)
+		return;
+
+	resSymSec= (CObjFileSection *) (resSym-> symObjFil-> secLst-> GetAt(resSym-> actSymTab-> secNum - 1));
+	if (resSymSec-> actFrgEnt)
+	{
+		tgtKey= resSymSec-> actFrgEnt;
+		tgtOff= resSym-> val;
+	}
+}
+
+/**************************************************************************************************/
+/*** Nur bernommene, schreibgeschtzte Fragmente mit Rohdaten, die nicht schon in ein anderes  ***/
+/*** Fragment zusammengefat wurden, kommen fr das Zusammenfassen in Frage.                    ***/
+/**************************************************************************************************/
+
+BOOL CSectionFragmentEntry::CanFold()
+{
+	return frgRef && rawDat && rawDatSiz && myHomSec-> actFrgEnt == this &&
+								!(myHomSec-> actSecTab-> chr & IMAGE_SCN_MEM_WRITE);
+}
+
+/**************************************************************************************************/
+/*** Hashwert (FNV-1a) ber die Rohdaten und die Relokationen samt ihrer Ziele. Gleiche Frag-   ***/
+/*** mente haben gleiche Hashwerte, die Umkehrung prft IsFoldEqual.                            ***/
+/**************************************************************************************************/
+
+DWORD CSectionFragmentEntry::GetFoldHash()
+{
+	myRelocationEntry *relEnt;
+	BYTE              *rawBuf;
+	void              *tgtKey;
+
+	DWORD tgtOff;
+	DWORD relInd;
+	DWORD i;
+	DWORD hshVal= 2166136261;
+
+	rawBuf= rawDat-> GetBufferStart();
+	for(i= 0; i < rawDatSiz; i++)
+	{
+		hshVal^= rawBuf[i];
+		hshVal*= 16777619;
+	}
+
+	for(relInd= 0; relInd < myHomSec-> actSecTab-> relNum; relInd++)
+	{
+		relEnt= (myRelocationEntry *)(secFrgRelBuf + 10 * relInd);
+		GetRelTarget(relEnt, tgtKey, tgtOff);
+		hshVal= (hshVal ^ relEnt-> off) * 16777619;
+		hshVal= (hshVal ^ relEnt-> typ) * 16777619;
+		hshVal= (hshVal ^ (DWORD) tgtKey) * 16777619;
+		hshVal= (hshVal ^ tgtOff) * 16777619;
+	}
+
+	return hshVal;
+}
+
+/**************************************************************************************************/
+/*** Vergleich zweier Fragmente: gleiche Rohdaten und Relokationen gleichen Typs an gleicher    ***/
+/*** Stelle mit gleichem Ziel.                                                                  ***/
+/**************************************************************************************************/
+
+BOOL CSectionFragmentEntry::IsFoldEqual(CSectionFragmentEntry *aFrgEnt)
+{
+	myRelocationEntry *relEnt;
+	myRelocationEntry *aRelEnt;
+	void              *tgtKey;
+	void              *aTgtKey;
+
+	DWORD tgtOff;
+	DWORD aTgtOff;
+	DWORD relInd;
+
+	if (rawDatSiz != aFrgEnt-> rawDatSiz || myHomSec-> actSecTab-> relNum != aFrgEnt-> myHomSec-> actSecTab-> relNum)
+		return FALSE;
+
+	if (memcmp(rawDat-> GetBufferStart(), aFrgEnt-> rawDat-> GetBufferStart(), rawDatSiz))
+		return FALSE;
+
+	for(relInd= 0; relInd < myHomSec-> actSecTab-> relNum; relInd++)
+	{
+		relEnt= (myRelocationEntry *)(secFrgRelBuf + 10 * relInd);
+		aRelEnt= (myRelocationEntry *)(aFrgEnt-> secFrgRelBuf + 10 * relInd);
+		if (relEnt-> off != aRelEnt-> off || relEnt-> typ != aRelEnt-> typ)
+			return FALSE;
+		GetRelTarget(relEnt, tgtKey, tgtOff);
+		aFrgEnt-> GetRelTarget(aRelEnt, aTgtKey, aTgtOff);
+		if (tgtKey != aTgtKey || tgtOff != aTgtOff)
+			return FALSE;
+	}
+
+	return TRUE;
+}
+
+/**************************************************************************************************/
+/*** Zusammenfassen mit einem gleichen Fragment. Das Fragment wird nicht mehr bernommen, alle  ***/
+/*** Symbole seiner Objektdateisektion werden ber canFrgEnt aufgelst.                         ***/
+/**************************************************************************************************/
+
+void CSectionFragmentEntry::FoldInto(CSectionFragmentEntry *canFrgEnt)
+{
+	frgRef= FALSE;
+	myHomSec-> actFrgEnt= canFrgEnt;
+}
+
 /**************************************************************************************************/
 /*** Auflsen aller noch offenen Adressen eines Sektionsfragments, Ermitteln dabei anfallender		***/
 /*** Debuginformationen, sowie Schreiben der in die .RELOC Sektion einzufgenden Adressen in    ***/
-/*** die entsprechende Liste.																																																																			***/
+/*** die entsprechende Liste. Die Adressen werden direkt im Puffer von rawDat gepatcht.         ***/
 /**************************************************************************************************/
 
 BOOL CSectionFragmentEntry::ResRel(CDWordArray *relLst, DWORD imgBas, DWORD virSecAdr, WORD secNum)
@@ -255,15 +625,20 @@ BOOL CSectionFragmentEntry::ResRel(CDWordArray *relLst, DWORD imgBas, DWORD virS
 	myRelocationEntry *relEnt;
 	mySymbolEntry		 		*actSym;
 	mySymbolEntry			 	*resSym;
+	myRelFixup        relFix;
+	BYTE              *rawBuf;
+	BYTE              *relAdr;
 	
-	DWORD	adrBuf;
-	DWORD	resSymSecFrgOff;
-	DWORD	imBase;
+	DWORD	adrSizDif;
  DWORD secFrgRelInd= 0; 
+	char  hexBuf[9];
 
- BOOL 	relNed= FALSE;
+	BOOL  shtFrg;
 	BOOL		lnkOK= TRUE;
  
+	rawBuf= rawDat-> GetBufferStart();
+	relFix.resSymSecFrgOff= 0;
+	relFix.imBase= 0;
 
 	while(secFrgRelInd < myHomSec-> actSecTab-> relNum)
 	{
@@ -274,6 +649,11 @@ BOOL CSectionFragmentEntry::ResRel(CDWordArray *relLst, DWORD imgBas, DWORD virS
 
 		resDllEnt= actSym-> dllExpEnt;
 
+		relFix.actSym= actSym;
+		relFix.resSym= resSym;
+		relFix.relNed= FALSE;
+		relFix.dllSym= resDllEnt != NULL;
+
 		if (!resDllEnt)
 		{
 			if ((short) resSym-> actSymTab-> secNum > 0) // int, weil sonst keine Zahlen zustande kommen
@@ -282,20 +662,20 @@ BOOL CSectionFragmentEntry::ResRel(CDWordArray *relLst, DWORD imgBas, DWORD virS
 				resSymSec= (CObjFileSection *) (resSym-> symObjFil-> secLst-> GetAt(resSym-> actSymTab-> secNum - 1));
 
 				if (resSymSec-> actFrgEnt)
-					resSymSecFrgOff= ((resSymSec-> actFrgEnt)-> actExeSec)-> virSecAdr + (resSymSec-> actFrgEnt)-> secFrgOff;
+					relFix.resSymSecFrgOff= ((resSymSec-> actFrgEnt)-> actExeSec)-> virSecAdr + (resSymSec-> actFrgEnt)-> secFrgOff;
 				else
 				{
 					WriteMessageToPow(ERR_MSGR_NO_SEC_FRG, resSym-> symNam, NULL);
 					lnkOK= FALSE;
 				}
-				imBase= imgBas;
+				relFix.imBase= imgBas;
 			}
 			else
 			{
 				if ((short) resSym-> actSymTab-> secNum < 0)
 				{
-					resSymSecFrgOff= 0;
-					imBase= 0;
+					relFix.resSymSecFrgOff= 0;
+					relFix.imBase= 0;
 				}
 				else	// .bssEintrag
 				{
@@ -303,107 +683,32 @@ BOOL CSectionFragmentEntry::ResRel(CDWordArray *relLst, DWORD imgBas, DWORD virS
 				}
 			}
 		}
-
-		rawDat-> Seek(relEnt-> off, CFile::begin);
-		rawDat-> Read(&adrBuf, sizeof(DWORD));
-		switch (relEnt-> typ)
+		else
 		{
-			case 0x0006:		// DIR32 
-				relNed= TRUE;
-				if (!resDllEnt)
-				{
-					if (resSym)
-					{
-						if (resSym-> bssOff)
-							adrBuf+= resSym-> bssOff;
-						else
-						{
-							adrBuf+= imBase + resSymSecFrgOff + resSym-> val;
-							if (!imBase)
-								relNed= FALSE;
-						}
-					}
-					else
-					{
-						if (actSym-> bssOff)
-							adrBuf+= actSym-> bssOff;
-						else
-						{
-							WriteMessageToPow(ERR_MSGR_DIR32, actSym-> symNam, NULL);
-							relNed= FALSE;
-						}
-					}
-				}	
-				else
-    {
-					adrBuf= resDllEnt-> idataLookupTabOff;
-     relNed= FALSE;
-    }
-							
-				break;
-
-			case 0x0007:	// DIR32NB
-				if (!resDllEnt)
-				{
-					if (resSym)
-					{
-						if (resSym-> bssOff)
-							adrBuf+= resSym-> bssOff;
-						else
-							adrBuf+= resSymSecFrgOff + resSym-> val;					
-					}
-					else
-							WriteMessageToPow(ERR_MSGR_DIR32NB, actSym-> symNam, NULL);
-				}
-				
-				break;
-				
-			case 0x000A:	// SECTION
-				if (!resDllEnt)
-				{
-					if (resSym)
-						adrBuf+= resSymSecFrgOff + resSym-> val;
-					else
-						WriteMessageToPow(ERR_MSGR_SECTION, actSym-> symNam, NULL);
-				}
-				
-			case 0x000B:	// SECREL
-				if (!resDllEnt)
-				{
-					if (resSym)
-						adrBuf+= resSymSecFrgOff + resSym-> val;
-					else
-						WriteMessageToPow(ERR_MSGR_SECREL, actSym-> symNam, NULL);
-				}
-				
-				break;
-			
-			case 0x0014:	//REL32
-			
-				if (!resDllEnt)
-				{
-					if (resSym)
-						adrBuf+= resSymSecFrgOff + resSym-> val - 
-											 (virSecAdr + secFrgOff + adrBuf + relEnt-> off + sizeof(DWORD));
-					else
-						WriteMessageToPow(ERR_MSGR_REL32, actSym-> symNam, NULL);
-				}
-				else
-					adrBuf= resDllEnt-> textSegOff - (virSecAdr + secFrgOff + adrBuf + 
-													relEnt-> off + sizeof(DWORD));
-			
-				break;
+			relFix.dllTxtSegOff= resDllEnt-> textSegOff;
+			relFix.dllLokUpTabOff= resDllEnt-> idataLookupTabOff;
+		}
 
-			default:
-				char *hexBuf;
+		// Laden der zu patchenden Adresse, am Ende eines zu kurzen Fragments nur die vorhandenen Bytes
+		relAdr= rawBuf + relEnt-> off;
+		adrSizDif= this-> rawDatSiz - relEnt-> off - sizeof(DWORD);
+		shtFrg= adrSizDif > 0xFFFFFFFC;
+		if (shtFrg)
+		{
+			relFix.adrBuf= 0;
+			memcpy(&relFix.adrBuf, relAdr, this-> rawDatSiz - relEnt-> off);
+		}
+		else
+			relFix.adrBuf= *(DWORD UNALIGNED *)relAdr;
 
-				hexBuf= (char *)malloc(sizeof(WORD));
-				_itoa(relEnt-> typ, hexBuf,16);
-				WriteMessageToPow(ERR_MSGR_NEW_REL, hexBuf, NULL);
-				free(hexBuf);
-				lnkOK= FALSE;
+		relFix.nxtInsAdr= virSecAdr + secFrgOff + relEnt-> off + sizeof(DWORD);
 
-		}				
+		if (!FixupRelocation(relEnt-> typ, &relFix))
+		{
+			_itoa(relEnt-> typ, hexBuf, 16);
+			WriteMessageToPow(ERR_MSGR_NEW_REL, hexBuf, NULL);
+			lnkOK= FALSE;
+		}
 
 		/* Debug Information	- wird auch fr nicht bentigte Symbole berechnet */
 		
@@ -442,29 +747,19 @@ BOOL CSectionFragmentEntry::ResRel(CDWordArray *relLst, DWORD imgBas, DWORD virS
 			}
 		}
 
-		rawDat-> Seek(relEnt-> off, CFile::begin);
-
-		DWORD adrSizDif;
-
-		adrSizDif= this-> rawDatSiz - relEnt-> off - sizeof(DWORD);
-		if (adrSizDif > 0xFFFFFFFC)
+		if (shtFrg)
 		{
 			WriteMessageToPow(WRN_MSGR_SMA_FRG, NULL, NULL);
-			rawDat-> Write(&adrBuf, sizeof(WORD));
-			if (adrSizDif == 0xFFFF)
-				rawDat-> Write(&chrBuf00, sizeof(BYTE));
+			memcpy(relAdr, &relFix.adrBuf, min(sizeof(WORD), this-> rawDatSiz - relEnt-> off));
 		}
 		else
-			rawDat-> Write(&adrBuf, sizeof(DWORD));
+			*(DWORD UNALIGNED *)relAdr= relFix.adrBuf;
 
 		relEnt-> off+= virSecAdr + secFrgOff; // Wird fr FPO-Information bentigt			
 
 
-		if (relNed)
-		{
+		if (relFix.relNed)
 			relLst-> Add(relEnt-> off);
-			relNed= FALSE;
-		}		
 	}
 
 	return lnkOK;
@@ -550,10 +845,8 @@ CResFileEntry::CResFileEntry()
 	resAddHdr1.hdrSiz= 0x0;
 	typIdtId.chr= 0xFFFF;
 	typIdtId.typ= 0x0;
-	typIdtUCStr= NULL;
 	namIdtId.chr= 0xFFFF;
 	namIdtId.nam= 0x0;
-	namIdtUCStr= NULL;
 	resAddHdr2.datVer= 0x0;
 	resAddHdr2.memFlg= 0x0;
 	resAddHdr2.lngId= 0x0;
@@ -581,116 +874,90 @@ CResFileEntry::~CResFileEntry()
 
 void CResFileEntry::FreeUsedMemory()
 {
-	if (typIdtUCStr)
-	{
-	 FreeCResUniCodeString(typIdtUCStr);
-		delete typIdtUCStr;
-		typIdtUCStr= NULL;
-	}
-	if (namIdtUCStr) 
-	{
-		FreeCResUniCodeString(namIdtUCStr);
-		delete namIdtUCStr;
-		namIdtUCStr= NULL;
-	}
-	if (resRawDat)
+	// Namen und Rohdaten gehren zur eingeblendeten .RES Datei und werden mit ihr freigegeben
+
+	typIdtUCStr.FreeUsedMemory();
+	namIdtUCStr.FreeUsedMemory();
+	resRawDat= NULL;
+}
+
+/**************************************************************************************************/
+/*** Lesen eines Typ- oder Namensbezeichners ab actFilPos. Ein Bezeichner ist entweder 0xFFFF   ***/
+/*** mit folgender Nummer oder ein nullterminierter Unicode String, der hchstens bis strEndPos ***/
+/*** reicht. Zurckgegeben wird die Position hinter dem Bezeichner.                             ***/
+/**************************************************************************************************/
+
+DWORD CResFileEntry::ReadResIdentifier(BYTE *resFilBuf, DWORD actFilPos, DWORD strEndPos, WORD &idtChr, WORD &idtNum,
+                                       CResUniCodeString &idtUCStr)
+{
+	WORD	*uCStr;
+	DWORD	uCStrMax;
+
+	uCStr= (WORD *)(resFilBuf + actFilPos);
+	idtChr= uCStr[0];
+	idtNum= uCStr[1];
+
+	if (idtChr == 0xFFFF)
 	{
-	 FreeCMyMemFile(resRawDat);
-		delete resRawDat;
-		resRawDat= NULL;
+		idtUCStr.idtUCStr= NULL;
+		idtUCStr.idtUCStrLen= 0;
+		return actFilPos + 2 * sizeof(WORD);
 	}
+
+	uCStrMax= (strEndPos - actFilPos) / sizeof(WORD);
+	idtUCStr.idtUCStr= uCStr;
+	idtUCStr.idtUCStrLen= 0;
+	while(idtUCStr.idtUCStrLen < uCStrMax && uCStr[idtUCStr.idtUCStrLen])
+		idtUCStr.idtUCStrLen++;
+
+	return actFilPos + (idtUCStr.idtUCStrLen + 1) * sizeof(WORD);
 }
 
 /**************************************************************************************************/
-/*** Lesen und Verarbeiten eines Ressourceneintrags																																													***/
+/*** Lesen eines Ressourceneintrags direkt aus der eingeblendeten .RES Datei ab resFilPos. Es   ***/
+/*** wird nichts kopiert, resFilPos steht danach hinter den Rohdaten des Eintrags. FALSE, wenn  ***/
+/*** kein vollstndiger Eintrag mehr folgt.                                                     ***/
 /**************************************************************************************************/
 
-int CResFileEntry::ReadResFileEntry(CFile *actResFil)
+BOOL CResFileEntry::ReadResFileEntry(BYTE *resFilBuf, DWORD &resFilPos, DWORD resFilSiz)
 {
 	DWORD	actFilPos;
 	DWORD	hdrEndPos;
- WORD  uniCodChrBuf;
-	BYTE		*rawDatBuf;
-	WORD  actAln;
+	DWORD	strEndPos;
 
-	// Untersuchen ob aktuelle FilePos dem Align entspricht
-	// angenommenes Align ist DWORD
+	// Die Eintrge beginnen auf DWORD Grenzen
 
-	actFilPos= actResFil-> GetPosition();
-	actAln= sizeof(DWORD);
-	if (actFilPos - actAln * (actFilPos / actAln))
-		actResFil-> Seek(actFilPos + actAln - (actFilPos - actAln * (actFilPos / actAln)), CFile::begin);
+	actFilPos= resFilPos;
+	if (actFilPos % sizeof(DWORD))
+		actFilPos+= sizeof(DWORD) - actFilPos % sizeof(DWORD);
+
+	if (actFilPos >= resFilSiz || resFilSiz - actFilPos < 0x20)
+		return FALSE;
 	
 	// Lesen der Hdr Informationen	
 	
-	actResFil-> Read(&resAddHdr1, 8);
-	actFilPos= actResFil->  GetPosition();
-	hdrEndPos= actFilPos + resAddHdr1.hdrSiz - 8;
-	actResFil-> Read(&typIdtId, sizeof(DWORD));
-
-	// Lesen der Typ und String Information
-
-	if (typIdtId.chr != 0xFFFF)
-	{	 
-		actResFil-> Seek(actFilPos, CFile::begin);
-		typIdtUCStr= new CResUniCodeString();
-  typIdtUCStr-> idtUCStrLen= 1;
-  actResFil-> Read(&uniCodChrBuf,	sizeof(WORD));	
-  while(uniCodChrBuf)
-  {
-   actResFil-> Read(&uniCodChrBuf,	sizeof(WORD));	   
-   typIdtUCStr-> idtUCStrLen++;
-  }
-  typIdtUCStr-> idtUCStrLen*= 2; 
-		typIdtUCStr-> idtUCStr= new WORD[typIdtUCStr-> idtUCStrLen];
-		typIdtUCStr-> uCResAdr= 0;
-  actResFil-> Seek(actFilPos, CFile::begin);
-		actResFil-> Read(typIdtUCStr-> idtUCStr, typIdtUCStr-> idtUCStrLen);
-  
-  // Ausgleichen eines mglichen Alignments
-
-  if (typIdtUCStr-> idtUCStrLen % sizeof(WORD))
-   actResFil-> Read(&uniCodChrBuf,	sizeof(WORD));	      
-	}
+	memcpy(&resAddHdr1, resFilBuf + actFilPos, sizeof(myResourceAddHeader1));
+	if (resAddHdr1.hdrSiz < 0x20 || resAddHdr1.hdrSiz > resFilSiz - actFilPos ||
+	    resAddHdr1.datSiz > resFilSiz - actFilPos - resAddHdr1.hdrSiz)
+		return FALSE;
 
-	actFilPos= actResFil->  GetPosition();
- actResFil-> Read(&namIdtId, sizeof(DWORD));
+	hdrEndPos= actFilPos + resAddHdr1.hdrSiz;
+	strEndPos= hdrEndPos - sizeof(myResourceAddHeader2);
+	actFilPos+= sizeof(myResourceAddHeader1);
 
-	if (namIdtId.chr != 0xFFFF)
-	{
-		actResFil-> Seek(actFilPos, CFile::begin);
-		namIdtUCStr= new CResUniCodeString();	
-  namIdtUCStr-> idtUCStrLen= 1;
-  actResFil-> Read(&uniCodChrBuf,	sizeof(WORD));	
-  while(uniCodChrBuf)
-  {
-   actResFil-> Read(&uniCodChrBuf,	sizeof(WORD));	   
-   namIdtUCStr-> idtUCStrLen++;
-  }
-  namIdtUCStr-> idtUCStrLen*= 2;
-  namIdtUCStr-> idtUCStr= new WORD[namIdtUCStr-> idtUCStrLen];
-  actResFil-> Seek(actFilPos, CFile::begin);
-		actResFil-> Read(namIdtUCStr-> idtUCStr,	namIdtUCStr-> idtUCStrLen);	
-
-  // Ausgleichen eines mglichen Alignments
-
-  if (namIdtUCStr-> idtUCStrLen % sizeof(WORD))
-   actResFil-> Read(&uniCodChrBuf,	sizeof(WORD));	      
-	}
-	
-	actResFil-> Seek(hdrEndPos - 0x10, CFile::begin);
-	actResFil-> Read(&resAddHdr2, 16);
+	// Lesen der Typ und Namen Information
+
+	actFilPos= ReadResIdentifier(resFilBuf, actFilPos, strEndPos, typIdtId.chr, typIdtId.typ, typIdtUCStr);
+	if (actFilPos + 2 * sizeof(WORD) > strEndPos)
+		return FALSE;
+	ReadResIdentifier(resFilBuf, actFilPos, strEndPos, namIdtId.chr, namIdtId.nam, namIdtUCStr);
+
+	memcpy(&resAddHdr2, resFilBuf + strEndPos, sizeof(myResourceAddHeader2));
 	
-	if (resAddHdr1.datSiz != 0)
-	{
-		resRawDat= new CMyMemFile();	
-		rawDatBuf= new BYTE[resAddHdr1.datSiz];
-		actResFil-> Read(rawDatBuf, resAddHdr1.datSiz);
-		resRawDat-> Write(rawDatBuf, resAddHdr1.datSiz);
-		delete[] rawDatBuf;
-	}
+	resRawDat= resAddHdr1.datSiz ? resFilBuf + hdrEndPos : NULL;
+	resFilPos= hdrEndPos + resAddHdr1.datSiz;
 	 
-	return 1;
+	return TRUE;
 }
 
 /*################################################################################################*/
@@ -727,6 +994,6 @@ CResUniCodeString::~CResUniCodeString()
 
 void CResUniCodeString::FreeUsedMemory()
 {
-	if (idtUCStr) delete[] idtUCStr;
 	idtUCStr= NULL;
+	idtUCStrLen= 0x0;
 }
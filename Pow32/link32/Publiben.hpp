@@ -31,6 +31,7 @@ class CDllExportEntry : public CObject
 	friend class CExeFileTextSection;
 	friend class CExeFileDebugSection;
 	friend class CSectionFragmentEntry;
+	friend class CLinkState;
 
 	public:
 		WORD	expOrd;
@@ -69,6 +70,25 @@ class CDllExportEntry : public CObject
 		void WriteDataToFile();
 };
 
+/**************************************************************************************************/
+/*** Daten einer einzelnen Relokation, die an die Behandlungsroutinen des jeweiligen            ***/
+/*** Relokationstyps bergeben werden. adrBuf enthlt den Inhalt der zu patchenden Adresse.     ***/
+/**************************************************************************************************/
+
+struct myRelFixup
+{
+ mySymbolEntry *actSym;
+ mySymbolEntry *resSym;
+ BOOL          dllSym;          // Symbol wird aus einer DLL importiert
+ DWORD         dllTxtSegOff;    // textSegOff des DLL Exporteintrags
+ DWORD         dllLokUpTabOff;  // idataLookupTabOff des DLL Exporteintrags
+ DWORD         resSymSecFrgOff;
+ DWORD         imBase;
+ DWORD         nxtInsAdr;       // Adresse nach dem zu patchenden DWORD (fr REL32)
+ DWORD         adrBuf;
+ BOOL          relNed;
+};
+
 /**************************************************************************************************/
 /*** Die Klasse CSectionFragmentEntry kapselt alle notwendigen Daten eines Sektionsfragments    ***/
 /*** .TEXT, .BSS, .RDATA und .DATA Sektion. Weiters erfolgt mittels der Methode ResRel(...)     ***/
@@ -84,9 +104,11 @@ class CSectionFragmentEntry : public CObject
 	friend class CExeFileBssSection;
  friend class CExeFileExportSection;
 	friend class CExeFileDebugSection;
+	friend class CLinkState;
 
 	public:
 		DWORD			secFrgOff;
+		BOOL			frgRef;			// Fragment wird in die PE-Datei bernommen, siehe CExeFile::MarkReferencedSections
 
 	private:
 		CExeFileDataSection	*actExeSec;
@@ -97,9 +119,12 @@ class CSectionFragmentEntry : public CObject
 
 		DWORD	rawDatSiz;	
 		DWORD	secSiz;
+		DWORD	frgCap;		// Platz des Fragments in der PE-Datei, mit Reserve beim inkrementellen Linken
 		
 		WORD		secFrgAln;
 
+		void GetRelTarget(myRelocationEntry *relEnt, void *&tgtKey, DWORD &tgtOff);
+
 	public:
 		CSectionFragmentEntry();
 		CSectionFragmentEntry(CExeFileDataSection *exeSec, DWORD frgOff, CObjFileSection *homSec,
@@ -107,11 +132,25 @@ class CSectionFragmentEntry : public CObject
 
 		~CSectionFragmentEntry();
 
+		// Whrend eines Linkvorgangs liegen die Objekte im Linkspeicher (lnkAre)
+
+		void *operator new(size_t objSiz);
+		void operator delete(void *aObj);
+
 		void FreeUsedMemory();
 	
 		void SetFragOffset(DWORD secOff);
 		DWORD GetRawDataSize();
+		void SetFragCapacity(WORD frgAln);
+		DWORD GetFragCapacity();
+		DWORD MarkRelFrags(CMyPtrList *wrkLst);
+		static BOOL MarkSymFrag(mySymbolEntry *aSym, CMyPtrList *wrkLst);
+		BOOL CanFold();
+		DWORD GetFoldHash();
+		BOOL IsFoldEqual(CSectionFragmentEntry *aFrgEnt);
+		void FoldInto(CSectionFragmentEntry *canFrgEnt);
 		BOOL ResRel(CDWordArray *relLst, DWORD	imBas, DWORD virSecAdr, WORD secNum);
+		static BOOL FixupRelocation(WORD relTyp, myRelFixup *relFix);
 		void WriteFragDataToFile();															
 		
 		// Hilfsfunktion zum Debuggen
@@ -121,7 +160,9 @@ class CSectionFragmentEntry : public CObject
 
 /**************************************************************************************************/
 /*** Die Klasse CResUniCodeString dient als Datenkapsel eines Unicode Strings, wie er in den    ***/
-/*** Microsoft Win32 Ressourcedateien verwendet wird.																																											***/
+/*** Microsoft Win32 Ressourcedateien verwendet wird. Der String wird nicht kopiert, idtUCStr   ***/
+/*** zeigt in die eingeblendete .RES Datei, idtUCStrLen ist die Anzahl der Zeichen ohne die     ***/
+/*** abschlieende Null.                                                                        ***/
 /**************************************************************************************************/
 
 class CResUniCodeString : public CObject
@@ -144,8 +185,9 @@ class CResUniCodeString : public CObject
 };
 
 /**************************************************************************************************/
-/*** Die Klasse CResFileEntry kapselt die Daten eines Ressourceeintrags und liest sie durch die ***/
-/*** Methode ReadResFileEntry in die entsprechenden Instanzvariablen ein.																							***/
+/*** Die Klasse CResFileEntry kapselt die Daten eines Ressourceeintrags. ReadResFileEntry liest ***/
+/*** den Header direkt aus der eingeblendeten .RES Datei, Namen und Rohdaten verweisen in die   ***/
+/*** Ansicht.                                                                                   ***/
 /**************************************************************************************************/
 
 class CResFileEntry : public CObject
@@ -157,19 +199,22 @@ class CResFileEntry : public CObject
 	protected:
 		myResourceAddHeader1	resAddHdr1;
 		myTypeIdentifier					typIdtId;
-		CResUniCodeString				*typIdtUCStr;
+		CResUniCodeString				typIdtUCStr;
 		myNameIdentifier					namIdtId;
-		CResUniCodeString				*namIdtUCStr;
+		CResUniCodeString				namIdtUCStr;
 		myResourceAddHeader2	resAddHdr2;
 
-		CMyMemFile	*resRawDat;
+		BYTE	*resRawDat;		// resAddHdr1.datSiz Bytes in der eingeblendeten .RES Datei
+
+		DWORD ReadResIdentifier(BYTE *resFilBuf, DWORD actFilPos, DWORD strEndPos, WORD &idtChr, WORD &idtNum,
+		                        CResUniCodeString &idtUCStr);
 	public:
 		CResFileEntry();
 		~CResFileEntry();
 
 		void FreeUsedMemory();
 
-		int ReadResFileEntry(CFile *actResFil);
+		BOOL ReadResFileEntry(BYTE *resFilBuf, DWORD &resFilPos, DWORD resFilSiz);
 };
 
 #endif
@@ -44,6 +44,7 @@ extern void WriteMessageToPow(WORD msgNr, char *str1, char *str2);
 
 extern DWORD	CalcTimeDateStamp();
 extern void FreeCResFileEntry(CResFileEntry *aCResFileEntry);
+extern void FreeCMapFile(CMapFile *aCMapFile);
 extern void FreeCMyObList(CMyObList *aCObList);
 extern void FreeCMyMapStringToOb(CMyMapStringToOb *aCMyMapStringToOb);
 extern void FreeCMyMapStringToPtr(CMyMapStringToPtr *aCMyMapStringToPtr);
@@ -62,6 +63,9 @@ extern 	int			logOn;
 extern BYTE chrBufCC[];
 extern BYTE chrBuf00[];
 
+extern CMyArena *lnkAre;  // In Linker.cpp definiert
+extern BOOL incLnk;       // In Linker.cpp definiert
+
 IMPLEMENT_DYNAMIC(CSection, CObject)
 IMPLEMENT_DYNAMIC(CObjFileSection, CSection)
 IMPLEMENT_DYNAMIC(CExeFileDataSection, CSection)
@@ -313,6 +317,24 @@ CObjFileSection::~CObjFileSection()
 /**************************************************************************************************/
 /**************************************************************************************************/
 
+void *CObjFileSection::operator new(size_t objSiz)
+{
+	return CMyArena::NewObject(lnkAre, objSiz);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
+void CObjFileSection::operator delete(void *aObj)
+{
+	CMyArena::DeleteObject(aObj);
+}
+
+/**************************************************************************************************/
+/**************************************************************************************************/
+/**************************************************************************************************/
+
 void CObjFileSection::FreeUsedMemory()
 {
 	actSecTab= NULL;
@@ -361,10 +383,10 @@ BOOL CObjFileSection::ReadSecData(CMyMemFile *actObjRawDat, DWORD sekPos, CObjFi
 																																						// secNam auch mit \0 abgeschlossen, wenn der Name 8 Zeichen lang ist.
 		if (actSecTab-> virSiz && actSecTab-> secNam[7] != 0x00)
 		{
-			secNam= (char *)malloc(2 * sizeof(DWORD) + 1);
+			secNam= (char *)CMyArena::AllocFrom(secObjFil-> objAre, 2 * sizeof(DWORD) + 1);
 			memset(secNam, 0x00, 2 * sizeof(DWORD) + 1);
 			memcpy(secNam, (char *)actSecTab-> secNam, 2 * sizeof(DWORD));
-			freSecNam= TRUE;
+			freSecNam= !secObjFil-> objAre;
 		}
  }
 	
@@ -811,10 +833,42 @@ BOOL CExeFileDataSection::AddSecFrag(CSectionFragmentEntry *aSecFrg)
 	return TRUE;
 }
 
+/**************************************************************************************************/
+/*** Sortiereintrag eines Sektionsfragments beim Festlegen der Reihenfolge in der PE-Datei      ***/
+/*** Sektion. Sortiert wird nach Sektionsname, Objektdatei und der Reihenfolge des Einfgens.   ***/
+/*** Gruppierte Sektionen (.CRT$XCA, .CRT$XCU, .idata$2, ...) werden so ber alle Objektdateien ***/
+/*** hinweg nach dem Teil hinter dem '$' geordnet, wie es das PE Format verlangt.               ***/
+/**************************************************************************************************/
+
+struct mySecFrgSorEnt
+{
+ DWORD                 objInd;
+ LPCTSTR               frgNam;
+ DWORD                 seqNum;
+ CSectionFragmentEntry *secFrgEnt;
+};
+
+static int __cdecl CompareSecFrgSorEnt(const void *aSorEnt, const void *bSorEnt)
+{
+	mySecFrgSorEnt *aEnt= (mySecFrgSorEnt *)aSorEnt;
+	mySecFrgSorEnt *bEnt= (mySecFrgSorEnt *)bSorEnt;
+	int            cmpRes;
+
+	cmpRes= strcmp(aEnt-> frgNam, bEnt-> frgNam);
+	if (cmpRes)
+		return cmpRes;
+
+	if (aEnt-> objInd != bEnt-> objInd)
+		return aEnt-> objInd < bEnt-> objInd ? -1 : 1;
+
+	return aEnt-> seqNum < bEnt-> seqNum ? -1 : (aEnt-> seqNum > bEnt-> seqNum ? 1 : 0);
+}
+
 /**************************************************************************************************/
 /*** Erstellen der Rohdaten der .DATA Sektion aus den Sektionsfragmentslisten. Dabei wird die   ***/
 /*** Beginnadresse des Sektionsfragments in der PE-Datei .DATA Sektion, und die Lnge zuzglich ***/
-/*** etwaiger Alignmentanforderungen berechnet.																																																	***/
+/*** etwaiger Alignmentanforderungen berechnet. Alle Fragmente werden zuerst in ein Feld        ***/
+/*** gesammelt und einmal sortiert, danach werden die Offsets in einem Durchlauf vergeben.      ***/
 /**************************************************************************************************/
 
 BOOL CExeFileDataSection::BuildSecRawDataBlockParts(CMyMapStringToOb *actUnSorLst, CMyStringList *namLst)
@@ -822,23 +876,21 @@ BOOL CExeFileDataSection::BuildSecRawDataBlockParts(CMyMapStringToOb *actUnSorLs
 	CSectionFragmentEntry *aSecFrgEnt;
 	CMyMapStringToOb 					*aSecFrgLst;
 	CMyObList							 					*aFrgLst;
-	CMyStringList 								*sorKeyLst;
+	mySecFrgSorEnt        *sorEntLst;
 
 	LPCTSTR objFilNam;
 	LPCTSTR keyFrgNam;
-	LPCTSTR sorFrgNam;
 																							
 	POSITION	objStrLst;
 	POSITION	secFrgLstPos;
-	POSITION	sorKeyPos;
-	POSITION oldSorKeyPos;
+	POSITION	frgPos;
 
-	DWORD	frgEntNum;
+	DWORD	sorEntNum= 0;
+	DWORD	sorEntMax= 64;
 	DWORD	i;
 	DWORD objFilNamInd= 0;
-	BOOL		ins;
 		
-	sorKeyLst= new CMyStringList();
+	sorEntLst= (mySecFrgSorEnt *) malloc(sorEntMax * sizeof(mySecFrgSorEnt));
 	objStrLst= namLst-> GetHeadPosition();
 	
 	while(objStrLst)
@@ -849,45 +901,44 @@ BOOL CExeFileDataSection::BuildSecRawDataBlockParts(CMyMapStringToOb *actUnSorLs
 		while(secFrgLstPos)
 		{
 			aSecFrgLst-> GetNextAssoc(secFrgLstPos, keyFrgNam, (CObject *&) aFrgLst);
-			sorKeyPos= sorKeyLst-> GetHeadPosition();
-			ins= FALSE;
-			while(sorKeyPos)
+			frgPos= aFrgLst-> GetHeadPosition();
+			while(frgPos)
 			{
-				oldSorKeyPos= sorKeyPos;
-				sorFrgNam= sorKeyLst-> GetNext(sorKeyPos);
-				if (strcmp(sorFrgNam, keyFrgNam) == 1)
+				if (sorEntNum == sorEntMax)
 				{
-					sorKeyLst-> InsertBefore(oldSorKeyPos, keyFrgNam);
-					ins= TRUE;
-					sorKeyPos= NULL;
+					sorEntMax*= 2;
+					sorEntLst= (mySecFrgSorEnt *) realloc(sorEntLst, sorEntMax * sizeof(mySecFrgSorEnt));
 				}
+				sorEntLst[sorEntNum].objInd= objFilNamInd;
+				sorEntLst[sorEntNum].frgNam= keyFrgNam;
+				sorEntLst[sorEntNum].seqNum= sorEntNum;
+				sorEntLst[sorEntNum++].secFrgEnt= (CSectionFragmentEntry *)aFrgLst-> GetNext(frgPos);
 			}
-			if (!ins) sorKeyLst-> AddTail(keyFrgNam);
 		}
-		frgEntNum= sorKeyLst-> GetCount();
+		objFilNamInd++;
+	}
 
-		for(i= 0; i < frgEntNum; i++)
-		{
-			sorFrgNam= sorKeyLst-> RemoveHead();
-			aSecFrgLst-> Lookup(sorFrgNam, (CObject *&)aFrgLst);
-			
-			secFrgLstPos= aFrgLst-> GetHeadPosition();
+	qsort(sorEntLst, sorEntNum, sizeof(mySecFrgSorEnt), CompareSecFrgSorEnt);
 
-			while(secFrgLstPos)
-			{
-				aSecFrgEnt= (CSectionFragmentEntry *)aFrgLst-> GetNext(secFrgLstPos);
-				// Es wird hier nicht das Alignment der einzelnen Fragmente sondern der ganzen Sektion verwendet
-				if (BytesTillAlignEnd(secRawDatSiz, secAln))
-					secRawDatSiz+= BytesTillAlignEnd(secRawDatSiz, secAln);
-				aSecFrgEnt-> SetFragOffset(secRawDatSiz);
-				secFrgLst-> AddTail(aSecFrgEnt);
-				secRawDatSiz+= aSecFrgEnt-> GetRawDataSize();
-			}
-		}
+	for(i= 0; i < sorEntNum; i++)
+	{
+		aSecFrgEnt= sorEntLst[i].secFrgEnt;
+		if (!aSecFrgEnt-> frgRef)	// Nicht referenziert, siehe CExeFile::MarkReferencedSections
+			continue;
+		// Es wird hier nicht das Alignment der einzelnen Fragmente sondern der ganzen Sektion verwendet
+		if (BytesTillAlignEnd(secRawDatSiz, secAln))
+			secRawDatSiz+= BytesTillAlignEnd(secRawDatSiz, secAln);
+		// Reserve fr das inkrementelle Linken nur bei Fragmenten mit dem Namen der Sektion, die
+		// gruppierten Fragmente (.CRT$XCU, ...) bilden Tabellen, die keine Lcken haben drfen
+		if (actUnSorLst == unSorObjSecFrgLst)
+			aSecFrgEnt-> SetFragCapacity(secAln);
+		aSecFrgEnt-> SetFragOffset(secRawDatSiz);
+		secFrgLst-> AddTail(aSecFrgEnt);
+		secRawDatSiz+= aSecFrgEnt-> GetFragCapacity();
 	}
+
 	actSecTab-> virSiz= secRawDatSiz;
-	sorKeyLst-> ~CMyStringList();
-	delete sorKeyLst;
+	free(sorEntLst);
 
 	return TRUE;
 }	
@@ -938,21 +989,22 @@ BOOL CExeFileDataSection::GiveSecRawDataBlock(CMyMemFile *exeFilRawDat, WORD fAl
 		{
 			curFrgEnt= (CSectionFragmentEntry *)secFrgLst-> GetNext(frgPos);
 			// Ausfllen der Alignment Leerstellen und reservieren des Platzes des Debugdirectories
-			exeFilRawDat-> Write(chrBuf00, curFrgEnt-> secFrgOff - lstFrgEnd);
+			exeFilRawDat-> WriteZero(curFrgEnt-> secFrgOff - lstFrgEnd);
 		
 			curFrgEnt-> rawDat-> SeekToBegin();
 			rawDatBuf= (BYTE *) curFrgEnt-> rawDat-> ReadWithoutMemcpy(curFrgEnt-> rawDatSiz);
 			exeFilRawDat-> Write((char *)rawDatBuf, curFrgEnt-> rawDatSiz);
-			lstFrgEnd+= curFrgEnt-> secFrgOff - lstFrgEnd + curFrgEnt-> rawDatSiz;
+			exeFilRawDat-> WriteZero(curFrgEnt-> frgCap - curFrgEnt-> rawDatSiz);
+			lstFrgEnd+= curFrgEnt-> secFrgOff - lstFrgEnd + curFrgEnt-> frgCap;
 		}
 	}
 	else
-		exeFilRawDat-> Write(chrBuf00, sizeof(myDebugDirectory) * DBG_DIR_ENT_MAX); // Debugdirectory, wenn keine sonstigen Daten
+		exeFilRawDat-> WriteZero(sizeof(myDebugDirectory) * DBG_DIR_ENT_MAX); // Debugdirectory, wenn keine sonstigen Daten
 
 	bytTilSecEnd= BytesTillAlignEnd(exeFilRawDat-> GetPosition(), fAln);
 
 	if (bytTilSecEnd)
-		exeFilRawDat-> Write(chrBuf00, bytTilSecEnd);
+		exeFilRawDat-> WriteZero(bytTilSecEnd);
 	
 	actSecTab-> rawDatSiz= exeFilRawDat-> GetPosition() - actSecTab-> rawDatPtr;
 
@@ -1018,6 +1070,231 @@ BOOL CExeFileDataSection::ResRel(CDWordArray *relLst, DWORD	imBas)
 	return lnkOK;
 }
 
+/**************************************************************************************************/
+/*** Auflsen der Adressen von frgNum Sektionsfragmenten ab frgPos. Wird von den Threads beim   ***/
+/*** parallelen Auflsen der Relokationen aufgerufen (CExeFile::ResolveRelocations).            ***/
+/**************************************************************************************************/
+
+BOOL CExeFileDataSection::ResRel(CDWordArray *relLst, DWORD	imBas, POSITION frgPos, WORD frgNum)
+{
+	CSectionFragmentEntry		*actSecFrgEnt;	
+
+	BOOL	lnkOK= TRUE;
+
+	while(frgPos && frgNum--)
+	{
+		actSecFrgEnt= (CSectionFragmentEntry *)secFrgLst-> GetNext(frgPos);
+		if (actSecFrgEnt-> secFrgRelBuf)
+			if (!actSecFrgEnt-> ResRel(relLst, imBas, virSecAdr, secNum))
+				lnkOK= FALSE;
+	}
+
+	return lnkOK;
+}
+
+/**************************************************************************************************/
+/*** Aufteilen der Sektionsfragmente in Teilauftrge zu je frgPerJob Fragmenten in der Reihen-  ***/
+/*** folge der Fragmentliste.                                                                   ***/
+/**************************************************************************************************/
+
+void CExeFileDataSection::GiveResRelJobs(CMyPtrList *jobLst, WORD frgPerJob)
+{
+	myResRelJob *newJob= NULL;
+	POSITION				secFragPos;
+
+	secFragPos= secFrgLst-> GetHeadPosition();
+	
+	while(secFragPos)
+	{
+		if (!newJob)
+		{
+			newJob= (myResRelJob *) malloc(sizeof(myResRelJob));
+			newJob-> exeSec= this;
+			newJob-> frgPos= secFragPos;
+			newJob-> frgNum= 0;
+			newJob-> relLst= new CDWordArray();
+			newJob-> lnkOK= TRUE;
+			jobLst-> AddTail(newJob);
+		}
+		secFrgLst-> GetNext(secFragPos);
+		if (++newJob-> frgNum == frgPerJob)
+			newJob= NULL;
+	}
+}
+
+/**************************************************************************************************/
+/*** Vorbereiten der Markierung fr das Entfernen nicht referenzierter Fragmente. Fragmente     ***/
+/*** mit dem Namen der PE-Datei Sektion (.text, .data, .rdata) gelten als unbenutzt, bis sie    ***/
+/*** erreicht werden. Alle anderen (.CRT$XCU, ...) werden oft nur ber die Sortierung ihres     ***/
+/*** Namens angesprochen, bleiben daher immer erhalten und werden als Wurzeln an wrkLst         ***/
+/*** angehngt. Rckgabe der Anzahl der Fragmente, die entfernt werden knnen.                  ***/
+/**************************************************************************************************/
+
+DWORD CExeFileDataSection::MarkSecFrags(CMyPtrList *wrkLst)
+{
+	CSectionFragmentEntry *aSecFrgEnt;
+	CMyMapStringToOb 					*actUnSorLst;
+	CMyMapStringToOb 					*aSecFrgLst;
+	CMyObList							 					*aFrgLst;
+
+	LPCTSTR keyObjNam;
+	LPCTSTR keyFrgNam;
+
+	POSITION	objPos;
+	POSITION	secFrgLstPos;
+	POSITION	frgPos;
+
+	DWORD	canNum= 0;
+	WORD		i;
+	BOOL	canRmv;
+
+	for(i= 0; i < 2; i++)
+	{
+		canRmv= !i;
+		actUnSorLst= canRmv ? unSorObjSecFrgLst : unSorOthObjSecFrgLst;
+		objPos= actUnSorLst-> GetStartPosition();
+		while(objPos)
+		{
+			actUnSorLst-> GetNextAssoc(objPos, keyObjNam, (CObject *&) aSecFrgLst);
+			secFrgLstPos= aSecFrgLst-> GetStartPosition();
+			while(secFrgLstPos)
+			{
+				aSecFrgLst-> GetNextAssoc(secFrgLstPos, keyFrgNam, (CObject *&) aFrgLst);
+				frgPos= aFrgLst-> GetHeadPosition();
+				while(frgPos)
+				{
+					aSecFrgEnt= (CSectionFragmentEntry *)aFrgLst-> GetNext(frgPos);
+					aSecFrgEnt-> frgRef= !canRmv;
+					if (canRmv)
+						canNum++;
+					else
+						wrkLst-> AddTail(aSecFrgEnt);
+				}
+			}
+		}
+	}
+
+	return canNum;
+}
+
+/**************************************************************************************************/
+/*** Eintrag beim Zusammenfassen identischer Fragmente, sortiert nach Hashwert und bei gleichem ***/
+/*** Hashwert nach der Reihenfolge der Objektdateien.                                           ***/
+/**************************************************************************************************/
+
+struct mySecFrgFldEnt
+{
+ DWORD                 hshVal;
+ DWORD                 seqNum;
+ CSectionFragmentEntry *secFrgEnt;
+};
+
+static int __cdecl CompareSecFrgFldEnt(const void *aFldEnt, const void *bFldEnt)
+{
+	mySecFrgFldEnt *aEnt= (mySecFrgFldEnt *)aFldEnt;
+	mySecFrgFldEnt *bEnt= (mySecFrgFldEnt *)bFldEnt;
+
+	if (aEnt-> hshVal != bEnt-> hshVal)
+		return aEnt-> hshVal < bEnt-> hshVal ? -1 : 1;
+
+	return aEnt-> seqNum < bEnt-> seqNum ? -1 : (aEnt-> seqNum > bEnt-> seqNum ? 1 : 0);
+}
+
+/**************************************************************************************************/
+/*** Zusammenfassen identischer schreibgeschtzter Fragmente (wie /OPT:ICF). Betrachtet werden  ***/
+/*** nur Fragmente mit dem Namen der PE-Datei Sektion, die Reihenfolge der Fragmente mit beson- ***/
+/*** deren Namen (.CRT$XCU, ...) ist bedeutsam. Von gleichen Fragmenten bleibt das erste in der ***/
+/*** Reihenfolge der Objektdateien erhalten. Da die Ziele der Relokationen in den Vergleich     ***/
+/*** eingehen, wird wiederholt, bis kein Fragment mehr zusammengefat wird. Rckgabe der Anzahl ***/
+/*** der zusammengefaten Fragmente.                                                            ***/
+/**************************************************************************************************/
+
+DWORD CExeFileDataSection::FoldSecFrags()
+{
+	CSectionFragmentEntry *aSecFrgEnt;
+	CMyMapStringToOb 					*aSecFrgLst;
+	CMyObList							 					*aFrgLst;
+	mySecFrgFldEnt        *fldEntLst;
+
+	LPCTSTR objFilNam;
+	LPCTSTR keyFrgNam;
+
+	POSITION	objStrLst;
+	POSITION	secFrgLstPos;
+	POSITION	frgPos;
+
+	DWORD	fldEntNum= 0;
+	DWORD	fldEntMax= 64;
+	DWORD	fldNum= 0;
+	DWORD	pasFldNum;
+	DWORD	i;
+	DWORD	j;
+	DWORD	k;
+
+	fldEntLst= (mySecFrgFldEnt *) malloc(fldEntMax * sizeof(mySecFrgFldEnt));
+	objStrLst= objNamLst-> GetHeadPosition();
+
+	while(objStrLst)
+	{
+		objFilNam= objNamLst-> GetNext(objStrLst);
+		unSorObjSecFrgLst-> Lookup(objFilNam, (CObject *&) aSecFrgLst);
+		secFrgLstPos= aSecFrgLst-> GetStartPosition();
+		while(secFrgLstPos)
+		{
+			aSecFrgLst-> GetNextAssoc(secFrgLstPos, keyFrgNam, (CObject *&) aFrgLst);
+			frgPos= aFrgLst-> GetHeadPosition();
+			while(frgPos)
+			{
+				aSecFrgEnt= (CSectionFragmentEntry *)aFrgLst-> GetNext(frgPos);
+				if (!aSecFrgEnt-> CanFold())
+					continue;
+				if (fldEntNum == fldEntMax)
+				{
+					fldEntMax*= 2;
+					fldEntLst= (mySecFrgFldEnt *) realloc(fldEntLst, fldEntMax * sizeof(mySecFrgFldEnt));
+				}
+				fldEntLst[fldEntNum].seqNum= fldEntNum;
+				fldEntLst[fldEntNum++].secFrgEnt= aSecFrgEnt;
+			}
+		}
+	}
+
+	do
+	{
+		pasFldNum= 0;
+		for(i= 0; i < fldEntNum; i++)
+			fldEntLst[i].hshVal= fldEntLst[i].secFrgEnt-> GetFoldHash();
+
+		qsort(fldEntLst, fldEntNum, sizeof(mySecFrgFldEnt), CompareSecFrgFldEnt);
+
+		for(i= 0; i < fldEntNum; i++)
+		{
+			if (!fldEntLst[i].secFrgEnt-> frgRef)
+				continue;
+			for(j= i + 1; j < fldEntNum && fldEntLst[j].hshVal == fldEntLst[i].hshVal; j++)
+			{
+				aSecFrgEnt= fldEntLst[j].secFrgEnt;
+				if (aSecFrgEnt-> frgRef && aSecFrgEnt-> IsFoldEqual(fldEntLst[i].secFrgEnt))
+				{
+					aSecFrgEnt-> FoldInto(fldEntLst[i].secFrgEnt);
+					pasFldNum++;
+				}
+			}
+		}
+
+		// Zusammengefate Fragmente entfernen, die Reihenfolge der brigen bleibt erhalten
+		for(i= k= 0; i < fldEntNum; i++)
+			if (fldEntLst[i].secFrgEnt-> frgRef)
+				fldEntLst[k++]= fldEntLst[i];
+		fldEntNum= k;
+		fldNum+= pasFldNum;
+	}
+	while(pasFldNum);
+
+	free(fldEntLst);
+	return fldNum;
+}
+
 /**************************************************************************************************/
 /*** Hilfsmethode zum Debuggen																																																																		***/
 /**************************************************************************************************/
@@ -1215,6 +1492,24 @@ BOOL CExeFileTextSection::IncDllForChainRel(CMyMapStringToOb *dllImpLstLst, CDWo
 	return TRUE;
 }
 
+/**************************************************************************************************/
+/*** Schreiben von filLen Fllbytes (0xCC) zwischen und hinter die .TEXT Sektionsfragmente. Die ***/
+/*** Lcken knnen grer sein als der Puffer chrBufCC, z.B. die Reserve eines Fragments beim   ***/
+/*** inkrementellen Linken.                                                                     ***/
+/**************************************************************************************************/
+
+static void WriteTextFill(CMyMemFile *exeFilRawDat, DWORD filLen)
+{
+	DWORD wrtLen;
+
+	while(filLen)
+	{
+		wrtLen= min(filLen, 0x200);
+		exeFilRawDat-> Write(chrBufCC, wrtLen);
+		filLen-= wrtLen;
+	}
+}
+
 /**************************************************************************************************/
 /*** Pyhsisches Zusammensetzen der .TEXT Sektionsfragmente zu einem Speicherblock. Gleich-						***/
 /*** zeitig wird auch die Adresse des Codeeinsprungspunktes berechnet.																										***/
@@ -1246,11 +1541,12 @@ BOOL CExeFileTextSection::GiveSecRawDataBlock(CMyMemFile *exeFilRawDat, CMyMapSt
  while(frgPos)
 	{
 		curFrgEnt= (CSectionFragmentEntry *)secFrgLst-> GetNext(frgPos);
-		exeFilRawDat-> Write(chrBufCC, curFrgEnt-> secFrgOff - lstFrgEnd);
+		WriteTextFill(exeFilRawDat, curFrgEnt-> secFrgOff - lstFrgEnd);
 	
 		curFrgEnt-> rawDat-> SeekToBegin();
 		rawDatBuf= (BYTE *) curFrgEnt-> rawDat-> ReadWithoutMemcpy(curFrgEnt-> rawDatSiz);
 		exeFilRawDat-> Write((char *)rawDatBuf, curFrgEnt-> rawDatSiz);
+		WriteTextFill(exeFilRawDat, curFrgEnt-> frgCap - curFrgEnt-> rawDatSiz);
 		lstFrgEnd= exeFilRawDat-> GetPosition() - actSecTab-> rawDatPtr;
 	}
 
@@ -1282,7 +1578,7 @@ BOOL CExeFileTextSection::GiveSecRawDataBlock(CMyMemFile *exeFilRawDat, CMyMapSt
 	bytTilSecEnd= exeFilRawDat-> GetPosition() - fAln * (exeFilRawDat-> GetPosition() / fAln);
 	
 	if (bytTilSecEnd)
-		exeFilRawDat-> Write(chrBuf00, fAln - bytTilSecEnd);
+		exeFilRawDat-> WriteZero(fAln - bytTilSecEnd);
 	
 	actSecTab-> rawDatSiz= exeFilRawDat-> GetPosition() - actSecTab-> rawDatPtr;
 
@@ -1400,7 +1696,8 @@ BOOL CExeFileBssSection::AddSecFrag(CSectionFragmentEntry *aSecFrg)
 	//	secRawDatSiz+= aSecFrg-> secFrgAln - (secRawDatSiz / aSecFrg-> secFrgAln) * aSecFrg-> secFrgAln;
 
 	secFrgLst-> AddTail(aSecFrg);
-	secRawDatSiz+= aSecFrg-> GetRawDataSize();
+	aSecFrg-> SetFragCapacity(aSecFrg-> secFrgAln);
+	secRawDatSiz+= aSecFrg-> GetFragCapacity();
 
 	return TRUE;
 }
@@ -1478,7 +1775,7 @@ BOOL CExeFileBssSection::SetBssVarOff(DWORD imBas, WORD fAln)
 		if (varStartOff - (varStartOff / aSecFrgEnt-> secFrgAln) * aSecFrgEnt-> secFrgAln)
 			varStartOff+= aSecFrgEnt-> secFrgAln -	(varStartOff - (varStartOff / aSecFrgEnt-> secFrgAln) * aSecFrgEnt-> secFrgAln);
 		aSecFrgEnt-> SetFragOffset(varStartOff);
-		varStartOff+= aSecFrgEnt-> GetRawDataSize();
+		varStartOff+= aSecFrgEnt-> GetFragCapacity();
 	}
 	actSecTab-> virSiz= varStartOff;
  secRawDatSiz= varStartOff + BytesTillAlignEnd(varStartOff, fAln);
@@ -1638,7 +1935,7 @@ void CExeFileImportSection::SetVirSecAdr(DWORD vSecAdr)
 /*** dabei anfallender Debuginformationen																																																							***/
 /**************************************************************************************************/
 
-DWORD CExeFileImportSection::BuildDllImpSec(CMyMapStringToPtr *pubSymLst, WORD fAln, DWORD imBas, 
+DWORD CExeFileImportSection::BuildDllImpSec(CMySymbolTable *pubSymLst, WORD fAln, DWORD imBas, 
 																																												DWORD actEntSecTxtOff, BOOL incDbgInf)
 {
 	myImportDirectoryTable	impDirTabEnt;
@@ -3760,9 +4057,9 @@ void CExeFileExportSection::WriteExpSecToFile()
 
 CExeFileRsrcSection::CExeFileRsrcSection() : CSection()
 {
-	hdrResFilEnt= NULL;
-	resTypMap= NULL;
- resTypStrMap= NULL;
+	resMapFil= NULL;
+	resEntArr= NULL;
+	resEntSrtArr= NULL;
 	resEntNum= 0;
 	aln= 1;
 }
@@ -3773,9 +4070,9 @@ CExeFileRsrcSection::CExeFileRsrcSection() : CSection()
 
 CExeFileRsrcSection::CExeFileRsrcSection(char *aSecNam, WORD sNum) : CSection(aSecNam, sNum)
 {
-	hdrResFilEnt= NULL;
-	resTypMap= NULL;
- resTypStrMap= NULL;
+	resMapFil= NULL;
+	resEntArr= NULL;
+	resEntSrtArr= NULL;
 	resEntNum= 0;
 	aln= sizeof(DWORD);
  actSecTab= (mySectionTable *) malloc(sizeof(mySectionTable));
@@ -3804,379 +4101,324 @@ CExeFileRsrcSection::~CExeFileRsrcSection()
 void CExeFileRsrcSection::FreeUsedMemory()
 {
 	CSection::FreeUsedMemory();
-	if (hdrResFilEnt)
+	FreeResFile();
+	aln= 0;
+}
+
+/**************************************************************************************************/
+/*** Freigeben der Eintrge und der eingeblendeten .RES Datei, auf die sie verweisen            ***/
+/**************************************************************************************************/
+
+void CExeFileRsrcSection::FreeResFile()
+{
+	if (resEntArr)
 	{
-	 FreeCResFileEntry(hdrResFilEnt);
-		delete hdrResFilEnt;
-		hdrResFilEnt=NULL;
+		delete[] resEntArr;
+		resEntArr= NULL;
 	}
-	if (resTypMap)
+	if (resEntSrtArr)
 	{
-	 FreeCMapWordToOb(resTypMap);
-		delete resTypMap;
-		resTypMap= NULL;
+		free(resEntSrtArr);
+		resEntSrtArr= NULL;
 	}
-	if (resTypStrMap)
+	if (resMapFil)
 	{
-	 FreeCMyMapStringToOb(resTypStrMap);
-		delete resTypStrMap;
-		resTypStrMap= NULL;
+		FreeCMapFile(resMapFil);
+		delete resMapFil;
+		resMapFil= NULL;
 	}
 	resEntNum= 0;
-	aln= 0;
 }
 
 /**************************************************************************************************/
-/*** Einlesen und Aufarbeiten der Daten der .RES Datei in der die Ressourcendaten stehen								***/
+/*** Vergleich zweier Typ- oder Namensbezeichner in der Reihenfolge, die das Ressourcen-        ***/
+/*** verzeichnis verlangt: Strings vor Nummern, Strings zeichenweise, Nummern aufsteigend.      ***/
+/**************************************************************************************************/
+
+int CExeFileRsrcSection::CompareResIdentifier(CResUniCodeString *uCStr1, WORD idtNum1, CResUniCodeString *uCStr2, WORD idtNum2)
+{
+	DWORD chrInd;
+
+	if (!uCStr1-> idtUCStr || !uCStr2-> idtUCStr)
+	{
+		if (uCStr1-> idtUCStr) return -1;
+		if (uCStr2-> idtUCStr) return 1;
+		if (idtNum1 != idtNum2) return (idtNum1 < idtNum2) ? -1 : 1;
+		return 0;
+	}
+
+	for(chrInd= 0; chrInd < uCStr1-> idtUCStrLen && chrInd < uCStr2-> idtUCStrLen; chrInd++)
+	{
+		if (uCStr1-> idtUCStr[chrInd] != uCStr2-> idtUCStr[chrInd])
+			return (uCStr1-> idtUCStr[chrInd] < uCStr2-> idtUCStr[chrInd]) ? -1 : 1;
+	}
+	if (uCStr1-> idtUCStrLen != uCStr2-> idtUCStrLen)
+		return (uCStr1-> idtUCStrLen < uCStr2-> idtUCStrLen) ? -1 : 1;
+	return 0;
+}
+
+/**************************************************************************************************/
+/*** Sortierschlssel der Eintrge: Typ, Name, Sprache und zuletzt die Reihenfolge in der Datei ***/
+/**************************************************************************************************/
+
+int __cdecl CExeFileRsrcSection::CompareResFileEntry(const void *resEnt1, const void *resEnt2)
+{
+	CResFileEntry *resFilEnt1= *(CResFileEntry **)resEnt1;
+	CResFileEntry *resFilEnt2= *(CResFileEntry **)resEnt2;
+	int           cmpRes;
+
+	cmpRes= CompareResIdentifier(&resFilEnt1-> typIdtUCStr, resFilEnt1-> typIdtId.typ,
+	                             &resFilEnt2-> typIdtUCStr, resFilEnt2-> typIdtId.typ);
+	if (cmpRes) return cmpRes;
+
+	cmpRes= CompareResIdentifier(&resFilEnt1-> namIdtUCStr, resFilEnt1-> namIdtId.nam,
+	                             &resFilEnt2-> namIdtUCStr, resFilEnt2-> namIdtId.nam);
+	if (cmpRes) return cmpRes;
+
+	if (resFilEnt1-> resAddHdr2.lngId != resFilEnt2-> resAddHdr2.lngId)
+		return (resFilEnt1-> resAddHdr2.lngId < resFilEnt2-> resAddHdr2.lngId) ? -1 : 1;
+
+	if (resFilEnt1 != resFilEnt2)
+		return (resFilEnt1 < resFilEnt2) ? -1 : 1;
+	return 0;
+}
+
+/**************************************************************************************************/
+/*** Einlesen der .RES Datei. Die Datei wird eingeblendet und direkt in der Ansicht analysiert, ***/
+/*** die Eintrge verweisen mit Namen und Rohdaten hinein. Sie bleibt bis zum Ende von          ***/
+/*** BuildResSecRawData eingeblendet. Die Eintrge werden in ein Feld gelesen und sortiert.     ***/
 /**************************************************************************************************/
 
 BOOL CExeFileRsrcSection::ReadResFile(const char *pszResFilNam)
 {	
-	CFileException	*pErr= NULL;
-	CResFileEntry		*aResFilEnt;
-	CMyObList								*resTypEntLst;
-	CBuffFile						  *actResFil;
-	CMyMemFile							*actResMemFil;
-
-	DWORD	filLen;
-	DWORD actResFilSiz;
-	BYTE		*actResFilBuf;
- char		*uCStrBuf= NULL;
+	CResFileEntry	hdrResFilEnt;
+	CResFileEntry	*actResFilEnt;
+
+	DWORD	resFilSiz;
+	DWORD	resFilPos= 0;
+	DWORD	fstEntPos;
+	DWORD	entNum;
+	BYTE		*resFilBuf;
 	
-	actResFil= new CBuffFile();
+	resMapFil= new CMapFile();
 
-	if (!actResFil-> Open(pszResFilNam, CFile::modeRead | CFile::typeBinary, pErr))
+	if (!resMapFil-> Open(pszResFilNam))
 	{
 		WriteMessageToPow(ERR_MSGC_OPN_RES, (char *)pszResFilNam, NULL);
+		FreeResFile();
 		return FALSE;
 	}
 	else
 		WriteMessageToPow(INF_MSG_FIL_OPE_SUC, (char *)pszResFilNam, NULL);
 
-	actResFilSiz= actResFil-> GetLength();
-	actResFilBuf= new BYTE[actResFilSiz + 1];
-	actResFil-> ReadHuge(actResFilBuf, actResFilSiz);
-	actResFil-> Close();
-	actResFil-> ~CBuffFile();
-	delete actResFil;
-
-	actResMemFil= new CMyMemFile();
-	actResMemFil-> WriteHuge(actResFilBuf, actResFilSiz);
-	actResMemFil-> SeekToBegin();
-	delete[] actResFilBuf;
-	
-	hdrResFilEnt= new CResFileEntry();
-	hdrResFilEnt-> ReadResFileEntry(actResMemFil);
+	resFilSiz= resMapFil-> GetLength();
+	resFilBuf= (BYTE *)resMapFil-> ReadWithoutMemcpy();
 
-	if (hdrResFilEnt-> resAddHdr1.hdrSiz == 0x20)
+	// Eine Win32 .RES Datei beginnt mit einem leeren Eintrag mit 32 Byte Header
+
+	if (!hdrResFilEnt.ReadResFileEntry(resFilBuf, resFilPos, resFilSiz) || hdrResFilEnt.resAddHdr1.hdrSiz != 0x20)
 	{
-		filLen= actResMemFil-> GetLength();
-		resTypMap= new CMapWordToOb();
-		resTypStrMap= new CMyMapStringToOb();
-		
-		while(actResMemFil-> GetPosition() < filLen - 0x20)
-		{
-			aResFilEnt= new CResFileEntry();
-			aResFilEnt-> ReadResFileEntry(actResMemFil);
+		WriteMessageToPow(ERR_MSGC_OPN_RES, (char *)pszResFilNam, NULL);
+		FreeResFile();
+		return FALSE;
+	}
 
-			if (aResFilEnt-> typIdtId.typ != 0x11)
-			{
+	// Zhlen der Eintrge, damit das Feld nur einmal angelegt wird
 
-				// Typ Eintrag durch einen String oder durch einen Id ?
-   
-				if (!aResFilEnt-> typIdtUCStr)
-				{
-					if (!resTypMap-> Lookup(aResFilEnt-> typIdtId.typ, (CObject *&)resTypEntLst))
-					{
-			 			resTypEntLst= new CMyObList(10);
-			 			resTypMap-> SetAt(aResFilEnt-> typIdtId.typ, resTypEntLst);
-					}
-				}
-				else
-				{
-					// Umwandeln des Unicode String in einen normalen
-   
-					uCStrBuf= (char *) malloc(aResFilEnt-> typIdtUCStr-> idtUCStrLen/0x2);					
-	  			wcstombs(uCStrBuf, aResFilEnt-> typIdtUCStr-> idtUCStr, aResFilEnt-> typIdtUCStr-> idtUCStrLen/0x2); 
-					uCStrBuf[aResFilEnt-> typIdtUCStr-> idtUCStrLen/0x2]= '\0';
-
-					if (!resTypStrMap-> Lookup(uCStrBuf, (CObject *&)resTypEntLst))    
-					{
-						resTypEntLst= new CMyObList(10);
-						resTypStrMap-> SetAt(uCStrBuf, resTypEntLst);
-					}
-				}
+	fstEntPos= resFilPos;
+	entNum= 0;
+	while(hdrResFilEnt.ReadResFileEntry(resFilBuf, resFilPos, resFilSiz))
+		entNum++;
 
-				resTypEntLst-> AddTail(aResFilEnt);
-				resEntNum++;
-			}				
-		}
-	}
-	else
+	resEntArr= new CResFileEntry[entNum + 1];
+	resEntSrtArr= (CResFileEntry **) malloc((entNum + 1) * sizeof(CResFileEntry *));
+
+	resFilPos= fstEntPos;
+	resEntNum= 0;
+	actResFilEnt= resEntArr;
+	while(resEntNum < entNum && actResFilEnt-> ReadResFileEntry(resFilBuf, resFilPos, resFilSiz))
 	{
-		WriteMessageToPow(ERR_MSGC_OPN_RES, (char *)pszResFilNam, NULL);
-	
-		FreeCMyMemFile(actResMemFil);
-		delete actResMemFil;
-	
-		return FALSE;
+		// Eintrge vom Typ 0x11 (DLGINCLUDE) gehren nicht in die .RSRC Sektion, der Platz im Feld
+		// wird fr den nchsten Eintrag verwendet
+
+		if (actResFilEnt-> typIdtUCStr.idtUCStr || actResFilEnt-> typIdtId.typ != 0x11)
+		{
+			resEntSrtArr[resEntNum++]= actResFilEnt;
+			actResFilEnt++;
+		}
 	}
 
-	FreeCMyMemFile(actResMemFil);
-	delete actResMemFil;
+	qsort(resEntSrtArr, resEntNum, sizeof(CResFileEntry *), CompareResFileEntry);
 	
 	return TRUE;
 }
 
 /**************************************************************************************************/
-/*** Erstellen der .RSRC Sektion der PE-Datei																																																			***/
+/*** Schreiben eines Verzeichniseintrags bei entPos. Ein Name wird bei strPos als Unicode String***/
+/*** mit vorangestellter Lnge abgelegt, die Zhler der Verzeichnistabelle werden erhht.       ***/
 /**************************************************************************************************/
 
-int CExeFileRsrcSection::BuildResSecRawData()
+void CExeFileRsrcSection::WriteResDirEntry(BYTE *resSecBuf, DWORD entPos, myResourceDirectoryTable *dirTab,
+                                           CResUniCodeString *idtUCStr, WORD idtNum, DWORD subAdr, DWORD &strPos)
 {
-	CResUniCodeString	*aUCString;
-	CResFileEntry					*actResFilEnt;
-	CMyMapStringToOb		*uCStrMap;
-	CMyPtrList        *resTypPtrLst;
-	CMyObList									*resTypEntLst;
- 
-	POSITION	entPosPtrLst;
- POSITION	entPos;
-				
-	DWORD	nxtDirAdr;
-	DWORD	nxtResDirStrAdr;
-	DWORD	fstResRawDatEntAdr;
-	DWORD	nxtResRawDatEntAdr;
-	DWORD	dWrdBuf;
-	DWORD	actFilPos;
-	DWORD	resDirTabPos;
-	DWORD	resRawDatBufLen;
-	DWORD	uniCodStrLen;
-	WORD  actResTyp;
-	WORD		resDirEntNum;
-	WORD		namEntNum;
-	WORD		idEntNum;
-	BYTE		*resRawDatBuf;
-	char		*uCStrBuf= NULL;
+	DWORD *dirEnt= (DWORD *)(resSecBuf + entPos);
+
+	if (idtUCStr-> idtUCStr)
+	{
+		dirEnt[0]= 0x80000000 + strPos;
+		*(WORD *)(resSecBuf + strPos)= (WORD )idtUCStr-> idtUCStrLen;
+		memcpy(resSecBuf + strPos + sizeof(WORD), idtUCStr-> idtUCStr, idtUCStr-> idtUCStrLen * sizeof(WORD));
+		strPos+= (idtUCStr-> idtUCStrLen + 1) * sizeof(WORD);
+		dirTab-> namEntNum++;
+	}
+	else
+	{
+		dirEnt[0]= idtNum;
+		dirTab-> idEntNum++;
+	}
+	dirEnt[1]= subAdr;
+}
+
+/**************************************************************************************************/
+/*** Erstellen der .RSRC Sektion der PE-Datei. Aus dem sortierten Feld der Eintrge werden      ***/
+/*** zuerst die Gren der Verzeichnisebenen bestimmt, danach werden Verzeichnisse, Daten-      ***/
+/*** beschreibungen, Namen und Rohdaten in einem Durchgang in den vorab angelegten Puffer       ***/
+/*** geschrieben.                                                                               ***/
+/**************************************************************************************************/
 
+int CExeFileRsrcSection::BuildResSecRawData()
+{
 	myResourceDirectoryTable	actDirTab;
+	myResourceDirectoryTable	*rootDirTab;
+	myResourceDirectoryTable	*typDirTab;
+	myResourceDirectoryTable	*namDirTab;
+	CResFileEntry								*actResFilEnt;
+	CResFileEntry								*prvResFilEnt;
+
+	DWORD	entInd;
+	DWORD	typNum= 0;
+	DWORD	namNum= 0;
+	DWORD	strSiz= 0;
+	DWORD	rawDatSiz= 0;
+	DWORD	rootEntPos;
+	DWORD	typDirPos;
+	DWORD	namDirPos;
+	DWORD	datEntPos;
+	DWORD	strPos;
+	DWORD	rawDatPos;
+	DWORD	secSiz;
+	DWORD	*datEnt;
+	BOOL		newTyp;
+	BOOL		newNam;
+	BYTE		*resSecBuf;
 
 	if (!ReadResFile(resFilNam))
 		return FALSE;
 
-	actDirTab.chr= 0x0;
-	actDirTab.timDatStp= CalcTimeDateStamp();
-	actDirTab.majVer= 0x0;
-	actDirTab.minVer= 0x0;
-
-	secRawDat= new CMyMemFile();
-		
-	actDirTab.namEntNum= (WORD )resTypStrMap-> GetCount();
-	actDirTab.idEntNum= (WORD )resTypMap-> GetCount();
- resDirEntNum= (WORD )(actDirTab.namEntNum + actDirTab.idEntNum);
- secRawDat-> Write(&actDirTab, sizeof(myResourceDirectoryTable));
-
-	nxtDirAdr= 0x10 + resDirEntNum * 0x8;
-	nxtResDirStrAdr= 0x10 + resDirEntNum * (0x8 + 0x10) +	resEntNum * (0x10 + 0x10 + 0x10);
-	
-	// Erstellen der Typ Information
-
- resTypPtrLst= new CMyPtrList();
-	uCStrMap= new CMyMapStringToOb();
+	// Bestimmen der Anzahl der Typen und Namen und der Gre der Strings und Rohdaten
 
- entPos= resTypStrMap-> GetStartPosition();
-
- while (entPos)
-	{
- 	resTypStrMap-> GetNextAssoc(entPos, uCStrBuf, (CObject *&)resTypEntLst);
-  resTypPtrLst-> AddTail(resTypEntLst);
-		
-  dWrdBuf= 0x80000000 + nxtResDirStrAdr;
-		secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-		dWrdBuf= 0x80000000 + nxtDirAdr;
-		secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-		nxtDirAdr+= 0x10 + resTypEntLst-> GetCount() * 0x8;
-		
-  actResFilEnt= (CResFileEntry *)resTypEntLst-> GetHead();
-  
-  actResFilEnt-> typIdtUCStr-> uCResAdr= nxtResDirStrAdr;
-		uCStrMap-> SetAt(uCStrBuf, actResFilEnt-> typIdtUCStr);
-		uniCodStrLen= actResFilEnt-> typIdtUCStr-> idtUCStrLen / 0x02 - 0x01;
-  actFilPos= secRawDat-> GetPosition();
-		secRawDat-> Seek(nxtResDirStrAdr, CFile::begin);
-		secRawDat-> Write(&uniCodStrLen, 0x02);
-		secRawDat-> Write(actResFilEnt-> typIdtUCStr-> idtUCStr, actResFilEnt-> typIdtUCStr-> idtUCStrLen);
-		secRawDat-> Seek(actFilPos, CFile::begin);
-		nxtResDirStrAdr+= actResFilEnt-> typIdtUCStr-> idtUCStrLen;			 						
- }
-		
-	
- // Erstellen der typ Information	
- // Durchgehen aller mglicher Restypen, ermitteln der Anzahl
-
- actResTyp= 0x0001;
-
-	while (actResTyp <= HIGH_RES_TYP_NUM)
+	prvResFilEnt= NULL;
+	for(entInd= 0; entInd < resEntNum; entInd++)
 	{
-		if (resTypMap-> Lookup(actResTyp, (CObject *&)resTypEntLst))
+		actResFilEnt= resEntSrtArr[entInd];
+		newTyp= !prvResFilEnt || CompareResIdentifier(&prvResFilEnt-> typIdtUCStr, prvResFilEnt-> typIdtId.typ,
+		                                              &actResFilEnt-> typIdtUCStr, actResFilEnt-> typIdtId.typ);
+		newNam= newTyp || CompareResIdentifier(&prvResFilEnt-> namIdtUCStr, prvResFilEnt-> namIdtId.nam,
+		                                       &actResFilEnt-> namIdtUCStr, actResFilEnt-> namIdtId.nam);
+		if (newTyp)
+		{
+			typNum++;
+			if (actResFilEnt-> typIdtUCStr.idtUCStr)
+				strSiz+= (actResFilEnt-> typIdtUCStr.idtUCStrLen + 1) * sizeof(WORD);
+		}
+		if (newNam)
 		{
-			resTypPtrLst-> AddTail(resTypEntLst);
-			secRawDat-> Write(&actResTyp, sizeof(WORD));
-			secRawDat-> Write(chrBuf00, sizeof(WORD));
-			dWrdBuf= 0x80000000 + nxtDirAdr;
-			secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-			nxtDirAdr+= 0x10 + resTypEntLst-> GetCount() * 0x8;
+			namNum++;
+			if (actResFilEnt-> namIdtUCStr.idtUCStr)
+				strSiz+= (actResFilEnt-> namIdtUCStr.idtUCStrLen + 1) * sizeof(WORD);
 		}
-		actResTyp++;
+		rawDatSiz+= actResFilEnt-> resAddHdr1.datSiz + BytesTillAlignEnd(actResFilEnt-> resAddHdr1.datSiz, aln);
+		prvResFilEnt= actResFilEnt;
 	}
 
-	// Erstellen der Nam Information
+	// Aufbau: Wurzelverzeichnis, Typverzeichnisse, Namensverzeichnisse (je eine Sprachebene),
+	// Datenbeschreibungen, Namen und auf 8 Byte ausgerichtet die Rohdaten
 
-	entPosPtrLst= resTypPtrLst-> GetHeadPosition();
+	rootEntPos= sizeof(myResourceDirectoryTable);
+	typDirPos= rootEntPos + typNum * 2 * sizeof(DWORD);
+	namDirPos= typDirPos + typNum * sizeof(myResourceDirectoryTable) + namNum * 2 * sizeof(DWORD);
+	datEntPos= namDirPos + namNum * sizeof(myResourceDirectoryTable) + resEntNum * 2 * sizeof(DWORD);
+	strPos= datEntPos + resEntNum * 4 * sizeof(DWORD);
+	rawDatPos= strPos + strSiz;
+	rawDatPos+= BytesTillAlignEnd(rawDatPos, 0x08);
+	secSiz= rawDatPos + rawDatSiz;
 
- while (entPosPtrLst)
-	{
-		resTypEntLst= (CMyObList *)resTypPtrLst-> GetNext(entPosPtrLst);
-		namEntNum= 0;
-		idEntNum= 0;
-		resDirTabPos= secRawDat-> GetPosition();
-		secRawDat-> Seek(resDirTabPos + 0x10, CFile::begin);
-		entPos= resTypEntLst-> GetHeadPosition();
-	
-		while(entPos)
-		{
-			actResFilEnt= (CResFileEntry *)resTypEntLst-> GetNext(entPos);
-			if (actResFilEnt-> namIdtId.chr == 0xFFFF)
-   {
-					dWrdBuf= (DWORD)actResFilEnt-> namIdtId.nam;
-     idEntNum++;
-   }
-			else
-			{
-				// Umwandeln des UniCodeStrings in einen normalen String
+	secRawDat= new CMyMemFile();
+	secRawDat-> SetLength(secSiz);
+	resSecBuf= secRawDat-> GetBufferStart();
+	memset(resSecBuf, 0, secSiz);
 
-				uCStrBuf= (char *) malloc(actResFilEnt-> namIdtUCStr-> idtUCStrLen/0x2 * 2);
-				
-				wcstombs(uCStrBuf, actResFilEnt-> namIdtUCStr-> idtUCStr, actResFilEnt-> namIdtUCStr-> idtUCStrLen/0x2); 
-				uCStrBuf[actResFilEnt-> namIdtUCStr-> idtUCStrLen/0x2]= '\0';
-				if (uCStrMap-> Lookup(uCStrBuf, (CObject *&)aUCString))
-					dWrdBuf= 0x80000000 + aUCString-> uCResAdr;
-				else
-				{
-					dWrdBuf= 0x80000000 + nxtResDirStrAdr;
-					actResFilEnt-> namIdtUCStr-> uCResAdr= nxtResDirStrAdr;
-					uCStrMap-> SetAt(uCStrBuf, actResFilEnt-> namIdtUCStr);
-					actFilPos= secRawDat-> GetPosition();
-					secRawDat-> Seek(nxtResDirStrAdr, CFile::begin);
-					uniCodStrLen= actResFilEnt-> namIdtUCStr-> idtUCStrLen / 0x02 - 0x01;
-					secRawDat-> Write(&uniCodStrLen, 0x02);
-					secRawDat-> Write(actResFilEnt-> namIdtUCStr-> idtUCStr, actResFilEnt-> namIdtUCStr-> idtUCStrLen);
-					secRawDat-> Seek(actFilPos, CFile::begin);
-					nxtResDirStrAdr+= actResFilEnt-> namIdtUCStr-> idtUCStrLen;			 						
-				}
-								
-				free(uCStrBuf);
-    namEntNum++;
-			}
-			secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-			dWrdBuf= 0x80000000 + nxtDirAdr;
-			secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-			nxtDirAdr+= 0x18;
-		}
-		actDirTab.namEntNum= namEntNum;
-		actDirTab.idEntNum= idEntNum;
-		actFilPos= secRawDat-> GetPosition();
-		secRawDat-> Seek(resDirTabPos, CFile::begin);
-		secRawDat-> Write(&actDirTab, sizeof(myResourceDirectoryTable));		
-		secRawDat-> Seek(actFilPos, CFile::begin);
-	}		
-
-	uCStrMap-> ~CMyMapStringToOb();
-	delete uCStrMap;
-	
-	// Erstellen der Language Information
+	actDirTab.chr= 0x0;
+	actDirTab.timDatStp= CalcTimeDateStamp();
+	actDirTab.majVer= 0x0;
+	actDirTab.minVer= 0x0;
+	actDirTab.namEntNum= 0x0;
+	actDirTab.idEntNum= 0x0;
 
-	entPosPtrLst= resTypPtrLst-> GetHeadPosition();
+	rootDirTab= (myResourceDirectoryTable *)resSecBuf;
+	*rootDirTab= actDirTab;
+	typDirTab= NULL;
+	namDirTab= NULL;
 
- while (entPosPtrLst)
+	prvResFilEnt= NULL;
+	for(entInd= 0; entInd < resEntNum; entInd++)
 	{
-		resTypEntLst= (CMyObList *)resTypPtrLst-> GetNext(entPosPtrLst);
-		entPos= resTypEntLst-> GetHeadPosition();	
-		while(entPos)
+		actResFilEnt= resEntSrtArr[entInd];
+		newTyp= !prvResFilEnt || CompareResIdentifier(&prvResFilEnt-> typIdtUCStr, prvResFilEnt-> typIdtId.typ,
+		                                              &actResFilEnt-> typIdtUCStr, actResFilEnt-> typIdtId.typ);
+		newNam= newTyp || CompareResIdentifier(&prvResFilEnt-> namIdtUCStr, prvResFilEnt-> namIdtId.nam,
+		                                       &actResFilEnt-> namIdtUCStr, actResFilEnt-> namIdtId.nam);
+		if (newTyp)
 		{
-			actResFilEnt= (CResFileEntry *)resTypEntLst-> GetNext(entPos);
-			actDirTab.namEntNum= 0x0;
-			actDirTab.idEntNum= 0x1;
-			secRawDat-> Write(&actDirTab, sizeof(myResourceDirectoryTable));		
-			dWrdBuf= (DWORD)actResFilEnt-> resAddHdr2.lngId;
-			secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-			dWrdBuf= nxtDirAdr;
-			secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-			nxtDirAdr+= 0x10;	
-		}	
-	}
-						
+			WriteResDirEntry(resSecBuf, rootEntPos, rootDirTab, &actResFilEnt-> typIdtUCStr, actResFilEnt-> typIdtId.typ,
+			                 0x80000000 + typDirPos, strPos);
+			rootEntPos+= 2 * sizeof(DWORD);
+			typDirTab= (myResourceDirectoryTable *)(resSecBuf + typDirPos);
+			*typDirTab= actDirTab;
+			typDirPos+= sizeof(myResourceDirectoryTable);
+		}
+		if (newNam)
+		{
+			WriteResDirEntry(resSecBuf, typDirPos, typDirTab, &actResFilEnt-> namIdtUCStr, actResFilEnt-> namIdtId.nam,
+			                 0x80000000 + namDirPos, strPos);
+			typDirPos+= 2 * sizeof(DWORD);
+			namDirTab= (myResourceDirectoryTable *)(resSecBuf + namDirPos);
+			*namDirTab= actDirTab;
+			namDirPos+= sizeof(myResourceDirectoryTable);
+		}
 
-	// Einfgen der Resource Directory Tables
-	
-	nxtResRawDatEntAdr= fstResRawDatEntAdr= 0x08 * (nxtResDirStrAdr / 0x08) + 0x08;
-	
-	entPosPtrLst= resTypPtrLst-> GetHeadPosition();
+		// Sprachebene und Datenbeschreibung
 
- while (entPosPtrLst)
-	{
-  resTypEntLst= (CMyObList *)resTypPtrLst-> GetNext(entPosPtrLst);
-		entPos= resTypEntLst-> GetHeadPosition();	
-		while(entPos)
-		{
-			actResFilEnt= (CResFileEntry *)resTypEntLst-> GetNext(entPos);
-			dWrdBuf= nxtResRawDatEntAdr + actSecTab-> rVAdrPtr;
-			secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-			dWrdBuf= (DWORD)actResFilEnt-> resAddHdr1.datSiz;
-			secRawDat-> Write(&dWrdBuf, sizeof(DWORD));
-			nxtResRawDatEntAdr+= dWrdBuf;
-			secRawDat-> Write(chrBuf00, 2 * sizeof(DWORD));
-			if (BytesTillAlignEnd(nxtResRawDatEntAdr, aln))
-				nxtResRawDatEntAdr+= BytesTillAlignEnd(nxtResRawDatEntAdr, aln);					
-		}	
-	}		
-
-	// Einfgen von Nullen bis zum Beginn der Resourcen Raw Daten
-	
-	secRawDat-> Seek(nxtResDirStrAdr, CFile::begin);
-	actFilPos= nxtResDirStrAdr;
-	secRawDat-> Write(chrBuf00, fstResRawDatEntAdr - actFilPos);
-	
-	// Einfgen der Raw Daten der Resourcen
+		datEnt= (DWORD *)(resSecBuf + namDirPos);
+		datEnt[0]= actResFilEnt-> resAddHdr2.lngId;
+		datEnt[1]= datEntPos;
+		namDirTab-> idEntNum++;
+		namDirPos+= 2 * sizeof(DWORD);
 
-	entPosPtrLst= resTypPtrLst-> GetHeadPosition();
+		datEnt= (DWORD *)(resSecBuf + datEntPos);
+		datEnt[0]= rawDatPos + actSecTab-> rVAdrPtr;
+		datEnt[1]= actResFilEnt-> resAddHdr1.datSiz;
+		datEntPos+= 4 * sizeof(DWORD);
 
- while (entPosPtrLst)
-	{
-  resTypEntLst= (CMyObList *)resTypPtrLst-> GetNext(entPosPtrLst);
-		entPos= resTypEntLst-> GetHeadPosition();
-		while(entPos)
-		{
-			actResFilEnt= (CResFileEntry *)resTypEntLst-> GetNext(entPos);
-			resRawDatBufLen= (actResFilEnt-> resRawDat)-> GetLength();
-			resRawDatBuf= (BYTE *)malloc(resRawDatBufLen);
-			actResFilEnt-> resRawDat-> SeekToBegin();
-			actResFilEnt-> resRawDat-> Read(resRawDatBuf, resRawDatBufLen);
-			secRawDat-> Write(resRawDatBuf, resRawDatBufLen);
-			free(resRawDatBuf);
-			if (BytesTillAlignEnd(secRawDat-> GetPosition(), aln))
-				secRawDat-> Write(chrBuf00, BytesTillAlignEnd(secRawDat-> GetPosition(), aln));
-		  FreeCResFileEntry(actResFilEnt);
-			delete actResFilEnt;
-		}
-		FreeCMyObList(resTypEntLst);
-		delete resTypEntLst;
-		resTypEntLst= NULL;
-	}
+		if (actResFilEnt-> resAddHdr1.datSiz)
+			memcpy(resSecBuf + rawDatPos, actResFilEnt-> resRawDat, actResFilEnt-> resAddHdr1.datSiz);
+		rawDatPos+= actResFilEnt-> resAddHdr1.datSiz + BytesTillAlignEnd(actResFilEnt-> resAddHdr1.datSiz, aln);
 
+		prvResFilEnt= actResFilEnt;
+	}
 
- FreeCMyPtrList(resTypPtrLst);
- delete resTypPtrLst;
+	secRawDat-> SeekToEnd();
+	FreeResFile();
 
 	actSecTab-> virSiz= secRawDat-> GetLength();	
 	return actSecTab-> virSiz;
@@ -4308,12 +4550,17 @@ BOOL CExeFileRelocSection::BuildRelSec(WORD secAln, WORD filAln)
 	DWORD	virBlkPos;
 	DWORD relEntNum;
 	DWORD relPosNum;
+	DWORD relSlk;
 	DWORD i;
 	WORD		relWrtAdr;
 	
 	relEntNum= relLst-> GetSize();
 	relSec= new CMyMemFile();
 	relAdr= relLst-> GetAt(0);
+
+	// Obergrenze: ein WORD je Relokation, Blockkopf und Fll-WORD je Seite, Alignment am Ende
+	relSec-> Reserve(relEntNum * sizeof(WORD) + filAln +
+	                 ((relLst-> GetAt(relEntNum - 1) - relAdr) / secAln + 1) * (2 * sizeof(DWORD) + sizeof(WORD)));
 	virBlkAdr= secAln * (relAdr / secAln);
 	relSec-> Write(&virBlkAdr, sizeof(DWORD));
 	relPosNum= relSec-> GetPosition();
@@ -4362,6 +4609,14 @@ BOOL CExeFileRelocSection::BuildRelSec(WORD secAln, WORD filAln)
 	 actSecTab-> virSiz+= 2;
 
 	relSec-> Write(chrBuf00, BytesTillAlignEnd(relSec-> GetPosition(), filAln));
+
+	// Reserve fr das inkrementelle Linken, die Sektion liegt am Ende der PE-Datei und darf beim
+	// Ersetzen der Relokationen genderter Fragmente bis zu ihrer Rohdatengre wachsen
+	if (incLnk)
+	{
+		relSlk= relEntNum * sizeof(WORD) / INC_LNK_SLK_DIV + INC_LNK_SLK_MIN;
+		relSec-> WriteZero(relSlk + BytesTillAlignEnd(relSlk, filAln));
+	}
 	
 	secRawDatSiz= relSec-> GetLength();
 	secRawDat= relSec;
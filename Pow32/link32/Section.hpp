@@ -26,6 +26,7 @@ class CSection : public CObject
 	friend class CSectionFragmentEntry;
  friend class CExeFileExportSection;
  friend class CExeFileDebugSection;
+	friend class CLinkState;
 	
 	public:
 		char		*secNam;									 
@@ -73,6 +74,7 @@ class CObjFileSection : public CSection
 	friend class CExeFileTextSection;
  friend class CExeFileExportSection;
 	friend class CExeFileDebugSection;
+	friend class CLinkState;
 	
 	protected:
 		CSectionFragmentEntry *actFrgEnt;
@@ -86,6 +88,11 @@ class CObjFileSection : public CSection
 		
 		~CObjFileSection();
 
+		// Whrend eines Linkvorgangs liegen die Objekte im Linkspeicher (lnkAre)
+
+		void *operator new(size_t objSiz);
+		void operator delete(void *aObj);
+
 		virtual void FreeUsedMemory();
 		
 		void SetFragEntry(CSectionFragmentEntry *frgEnt);	
@@ -110,6 +117,7 @@ class CExeFileDataSection : public CSection
 
 	friend class CSectionFragmentEntry;
 	friend class CExeFileDebugSection;
+	friend class CLinkState;
 
 	protected:
 		CMyMapStringToOb	*unSorObjSecFrgLst;    // In diese Liste kommen alle Sectionfragmente, welche
@@ -134,6 +142,10 @@ class CExeFileDataSection : public CSection
 		virtual void FreeUsedMemory();
 		
 		BOOL ResRel(CDWordArray *relLst, DWORD	imBas);
+		BOOL ResRel(CDWordArray *relLst, DWORD	imBas, POSITION frgPos, WORD frgNum);
+		void GiveResRelJobs(CMyPtrList *jobLst, WORD frgPerJob);
+		DWORD MarkSecFrags(CMyPtrList *wrkLst);
+		DWORD FoldSecFrags();
 		BOOL BuildSecRawDataBlock();
 		virtual BOOL AddSecFrag(CSectionFragmentEntry *aSecFrg);
 		virtual BOOL BuildSecRawDataBlockParts(CMyMapStringToOb *actUnSortLst, CMyStringList *namLst);
@@ -147,6 +159,18 @@ class CExeFileDataSection : public CSection
 		void WriteResolvedSectionSymbols();
 };
 
+/*** Teilauftrag beim parallelen Auflsen der Relokationen: frgNum Sektionsfragmente ab         ***/
+/*** frgPos. Die .RELOC Adressen werden in der eigenen Liste relLst gesammelt.                  ***/
+
+struct myResRelJob
+{
+ CExeFileDataSection *exeSec;
+ POSITION            frgPos;
+ WORD                frgNum;
+ CDWordArray         *relLst;
+ BOOL                lnkOK;
+};
+
 /******************************************************************************************************/
 /*** Die Klasse CExeFileTextSection reprsentiert die .TEXT Sektion der PE-Datei. Sie ist von der  ***/
 /*** Klasse CEXEFileDataSection abgeleitet und hat zustzliche Instanzvariablen und Methoden fr   ***/
@@ -258,7 +282,7 @@ class CExeFileImportSection : public CSection
 	
 		virtual void FreeUsedMemory();
 		
-		DWORD BuildDllImpSec(CMyMapStringToPtr *pubSymLst, WORD fAln, DWORD imBas, DWORD actEntSecTxtOff,
+		DWORD BuildDllImpSec(CMySymbolTable *pubSymLst, WORD fAln, DWORD imBas, DWORD actEntSecTxtOff,
 																							BOOL incDbgInf);
 		virtual void SetVirSecAdr(DWORD vSecAdr);
 
@@ -281,6 +305,7 @@ class CExeFileExportSection : public CSection
 
 	friend class CSection;
 	friend class CExeFile;
+	friend class CLinkState;
 
 	protected:
 		myExportDirectoryTable actExpDirTab;
@@ -322,12 +347,18 @@ class CExeFileRsrcSection : public CSection
   LPSTR resFilNam;
 
 	protected:
-		CResFileEntry	   *hdrResFilEnt;
-		CMapWordToOb	    *resTypMap;
-  CMyMapStringToOb *resTypStrMap;
+		CMapFile        *resMapFil;
+		CResFileEntry   *resEntArr;
+		CResFileEntry   **resEntSrtArr;	// Nach Typ, Name und Sprache sortiert
 
 		DWORD	resEntNum;
 
+		void FreeResFile();
+		static int CompareResIdentifier(CResUniCodeString *uCStr1, WORD idtNum1, CResUniCodeString *uCStr2, WORD idtNum2);
+		static int __cdecl CompareResFileEntry(const void *resEnt1, const void *resEnt2);
+		static void WriteResDirEntry(BYTE *resSecBuf, DWORD entPos, myResourceDirectoryTable *dirTab,
+		                             CResUniCodeString *idtUCStr, WORD idtNum, DWORD subAdr, DWORD &strPos);
+
 	public:
 		CExeFileRsrcSection();							 
 		CExeFileRsrcSection(char *aSecNam, WORD sNum= 0);
@@ -357,6 +388,7 @@ class CExeFileRelocSection : public CSection
 	DECLARE_DYNAMIC(CExeFileRelocSection)
 
 	friend class CExeFile;
+	friend class CLinkState;
 
 	protected:
 		CDWordArray	*relLst;
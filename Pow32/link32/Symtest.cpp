@@ -0,0 +1,160 @@
+#include <afx.h>
+#include <stdio.h>
+
+#ifndef __MYCOLL_H__
+#include "MyColl.hpp"
+#endif
+
+/**************************************************************************************************/
+/***              S y m b o l v e r z e i c h n i s       B e n c h m a r k                     ***/
+/**************************************************************************************************/
+/*** Spielt eine mit symLogOn (Linker.cpp) aufgezeichnete Zugriffsfolge auf pubSymLst ('P')     ***/
+/*** und pubLibSymLst ('L') wiederholt mit CMyMapStringToPtr und CMySymbolTable ab und gibt die ***/
+/*** bentigten Zeiten aus. Zeilenformat: <Verzeichnis> <S|L> <Symbolname>                      ***/
+/**************************************************************************************************/
+
+#define SYM_REP_NUM 20
+
+struct mySymTestOp
+{
+ char  tabId;
+ char  opId;
+ char *symNam;
+};
+
+/*** Einlesen der aufgezeichneten Zugriffe ***/
+
+static int ReadSymLog(const char *logFilNam, mySymTestOp *&opLst)
+{
+ FILE *logFil;
+ char lineBuf[1024];
+ int  opNum= 0, opMax= 10000;
+ int  len;
+
+ logFil= fopen(logFilNam, "r");
+ if (!logFil)
+  return -1;
+
+ opLst= (mySymTestOp *) malloc(opMax * sizeof(mySymTestOp));
+
+ while (fgets(lineBuf, sizeof(lineBuf), logFil))
+ {
+  len= strlen(lineBuf);
+  while (len > 0 && (lineBuf[len - 1] == '\n' || lineBuf[len - 1] == '\r'))
+   lineBuf[--len]= '\0';
+  if (len < 5)
+   continue;
+
+  if (opNum == opMax)
+  {
+   opMax*= 2;
+   opLst= (mySymTestOp *) realloc(opLst, opMax * sizeof(mySymTestOp));
+  }
+  opLst[opNum].tabId= lineBuf[0];
+  opLst[opNum].opId= lineBuf[2];
+  opLst[opNum].symNam= strdup(lineBuf + 4);
+  opNum++;
+ }
+ fclose(logFil);
+ return opNum;
+}
+
+/*** Abspielen mit der bisherigen Hashtabelle (Initialisierung wie in CObj2Exe::InitLinker) ***/
+
+static DWORD ReplayOld(mySymTestOp *opLst, int opNum, DWORD &fndNum)
+{
+ CMyMapStringToPtr *pubSymLst, *pubLibSymLst, *actLst;
+ void  *symVal;
+ DWORD startTime;
+ int   i;
+
+ startTime= GetTickCount();
+ pubSymLst= new CMyMapStringToPtr(5000);
+ pubSymLst-> InitHashTable(500, TRUE);
+ pubLibSymLst= new CMyMapStringToPtr(10000);
+ pubLibSymLst-> InitHashTable(1000, TRUE);
+
+ fndNum= 0;
+ for (i= 0; i < opNum; i++)
+ {
+  actLst= opLst[i].tabId == 'P' ? pubSymLst : pubLibSymLst;
+  if (opLst[i].opId == 'S')
+   actLst-> SetAt(opLst[i].symNam, opLst[i].symNam);
+  else if (actLst-> Lookup(opLst[i].symNam, symVal))
+   fndNum++;
+ }
+
+ delete pubSymLst;
+ delete pubLibSymLst;
+ return GetTickCount() - startTime;
+}
+
+/*** Abspielen mit CMySymbolTable ***/
+
+static DWORD ReplayNew(mySymTestOp *opLst, int opNum, DWORD &fndNum)
+{
+ CMySymbolTable *pubSymLst, *pubLibSymLst, *actLst;
+ void  *symVal;
+ DWORD startTime;
+ int   i;
+
+ startTime= GetTickCount();
+ pubSymLst= new CMySymbolTable();
+ pubSymLst-> InitHashTable(5000, TRUE);
+ pubLibSymLst= new CMySymbolTable();
+ pubLibSymLst-> InitHashTable(10000, TRUE);
+
+ fndNum= 0;
+ for (i= 0; i < opNum; i++)
+ {
+  actLst= opLst[i].tabId == 'P' ? pubSymLst : pubLibSymLst;
+  if (opLst[i].opId == 'S')
+   actLst-> SetAt(opLst[i].symNam, opLst[i].symNam);
+  else if (actLst-> Lookup(opLst[i].symNam, symVal))
+   fndNum++;
+ }
+
+ delete pubSymLst;
+ delete pubLibSymLst;
+ return GetTickCount() - startTime;
+}
+
+/*** Hauptprogramm fr den Testaufruf ***/
+
+int main(int argc, char *argv[])
+{
+ mySymTestOp *opLst;
+ DWORD oldTim= 0, newTim= 0;
+ DWORD oldFnd, newFnd;
+ int   opNum, i;
+
+ if (argc != 2)
+ {
+  printf("Aufruf: symtest <Symbolprotokoll (C:\\LINKSYM.LOG)>\n");
+  return 1;
+ }
+
+ opNum= ReadSymLog(argv[1], opLst);
+ if (opNum < 0)
+ {
+  printf("Datei %s kann nicht geffnet werden\n", argv[1]);
+  return 1;
+ }
+
+ for (i= 0; i < SYM_REP_NUM; i++)
+ {
+  oldTim+= ReplayOld(opLst, opNum, oldFnd);
+  newTim+= ReplayNew(opLst, opNum, newFnd);
+ }
+
+ printf("Zugriffe:          %d (x %d)\n", opNum, SYM_REP_NUM);
+ printf("CMyMapStringToPtr: %6lu ms, %lu gefunden\n", oldTim, oldFnd);
+ printf("CMySymbolTable:    %6lu ms, %lu gefunden\n", newTim, newFnd);
+ if (oldFnd != newFnd)
+  printf("FEHLER: unterschiedliche Anzahl gefundener Symbole\n");
+
+ for (i= 0; i < opNum; i++)
+  free(opLst[i].symNam);
+ free(opLst);
+ return oldFnd != newFnd;
+}
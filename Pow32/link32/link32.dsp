@@ -126,10 +126,22 @@ SOURCE=.\Linker.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Lnkstate.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\Mycarena.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Mycbufil.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Mycmapf.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Mycmapst.cpp
 # End Source File
 # Begin Source File
@@ -158,6 +170,14 @@ SOURCE=.\Mycstlst.cpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Mycstrmf.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\Mycsymtb.cpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\OBJ2EXE.CPP
 # End Source File
 # Begin Source File
@@ -198,6 +218,10 @@ SOURCE=.\Linker.hpp
 # End Source File
 # Begin Source File
 
+SOURCE=.\Lnkstate.hpp
+# End Source File
+# Begin Source File
+
 SOURCE=.\Mycfile.hpp
 # End Source File
 # Begin Source File
@@ -36,6 +36,7 @@
 #include "powintro.h"
 #include "powdde.h"
 #include "powCompiler.h"
+#include "powcomp.h"
 
 #undef HIWORD
 #undef LOWORD
@@ -325,9 +326,8 @@ void FAR ExitConfig ()
         FreeLibrary(actDLL);
     }
   */                     
-    /* free dependency matrix */
-    if (hDep)
-        GlobalFree(hDep);
+    /* free dependency graph */
+    RemoveDependMatrix();
 }
 
 /***************************************************************************
@@ -13,6 +13,8 @@ CompChangeModuleNameProc*  compChangeModuleName;
 CompCheckDepProc*          compCheckDep; 
 CompCheckIfYoungerProc*    compCheckIfYounger;
 CompCompileProc*           compCompile;
+CompCompileStartProc*      compCompileStart;
+CompCompileEndProc*        compCompileEnd;
 CompCompOptProc*           compCompOpt;
 CompDirOptProc*            compDirOpt;
 CompExitProc*              compExit;
@@ -98,6 +100,11 @@ BOOL LoadCompilerInterface(LPSTR dllName,
     compFileWasCompiled=(CompFileWasCompiledProc*)GetProcAddress(compilerDLL,MAKEINTRESOURCE(DLL_FILEWASCOMPILED));
     compComment=(CompCommentProc*)GetProcAddress(compilerDLL,MAKEINTRESOURCE(DLL_EDITORCOMMENT));
     compKeyword=(CompKeywordProc*)GetProcAddress(compilerDLL,MAKEINTRESOURCE(DLL_EDITORSYNTAX));
+
+      /* optional: compilers running in a separate process may be started concurrently */
+    compCompileStart=(CompCompileStartProc*)GetProcAddress(compilerDLL,MAKEINTRESOURCE(DLL_COMPILESTART));
+    compCompileEnd=(CompCompileEndProc*)GetProcAddress(compilerDLL,MAKEINTRESOURCE(DLL_COMPILEEND));
+    if (!compCompileEnd) compCompileStart=0;
     
     if (!(compAbout &&
           compChangeModuleName &&
@@ -36,6 +36,8 @@
 #define DLL_CHECKIFYOUNGER   30
 #define DLL_GETHELPFILE      31
 #define DLL_GETTARGET        32
+#define DLL_COMPILESTART     33   /* optional */
+#define DLL_COMPILEEND       34   /* optional */
 
 /* compiler interface dll procedure types */
 typedef BOOL   FAR PASCAL CompAboutProc     (HANDLE,HWND);
@@ -43,6 +45,8 @@ typedef void   FAR PASCAL CompChangeModuleNameProc (HANDLE,HWND,FARPROC,LPSTR,LP
 typedef void   FAR PASCAL CompCheckDepProc (HANDLE,LPSTR,FARPROC,HWND,FARPROC,FARPROC,FARPROC,FARPROC,FARPROC,HANDLE);
 typedef BOOL   FAR PASCAL CompCheckIfYoungerProc (HANDLE,LPSTR,LPSTR);
 typedef BOOL   FAR PASCAL CompCompileProc (HANDLE,LPSTR,FARPROC,FARPROC,HWND,FARPROC,FARPROC,FARPROC,FARPROC,FARPROC,HANDLE);
+typedef HANDLE FAR PASCAL CompCompileStartProc (HANDLE,LPSTR,FARPROC);  // process handle of started compiler or 0
+typedef BOOL   FAR PASCAL CompCompileEndProc (HANDLE,LPSTR,HANDLE,FARPROC,FARPROC); // after process has ended
 typedef BOOL   FAR PASCAL CompCompOptProc (HANDLE,HWND);
 typedef BOOL   FAR PASCAL CompDirOptProc    (HANDLE,HWND);
 typedef void   FAR PASCAL CompExitProc      (HANDLE);
@@ -70,6 +74,8 @@ extern CompChangeModuleNameProc*  compChangeModuleName;
 extern CompCheckDepProc*          compCheckDep; 
 extern CompCheckIfYoungerProc*    compCheckIfYounger;
 extern CompCompileProc*           compCompile;
+extern CompCompileStartProc*      compCompileStart;
+extern CompCompileEndProc*        compCompileEnd;
 extern CompCompOptProc*           compCompOpt;
 extern CompDirOptProc*            compDirOpt;
 extern CompExitProc*              compExit;